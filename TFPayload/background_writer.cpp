@@ -0,0 +1,57 @@
+#include "pch.h"
+#include "background_writer.h"
+
+DWORD WINAPI BackgroundWriter::ThreadProc(LPVOID param) {
+    BackgroundWriter* self = static_cast<BackgroundWriter*>(param);
+    while (self->m_running) {
+        uint32_t requested = self->m_flushRequested.load(std::memory_order_acquire);
+        bool flush = requested != self->m_flushCompleted.load(std::memory_order_relaxed);
+        self->m_drain(flush);
+        if (flush) {
+            self->m_flushCompleted.store(requested, std::memory_order_release);
+        }
+        Sleep(self->m_wakeMs);
+    }
+
+    uint32_t requested = self->m_flushRequested.load(std::memory_order_acquire);
+    self->m_drain(true);
+    self->m_flushCompleted.store(requested, std::memory_order_release);
+    return 0;
+}
+
+bool BackgroundWriter::Start(DrainFn drain, DWORD wakeMs) {
+    if (m_thread != NULL) return true;
+
+    m_drain = drain;
+    m_wakeMs = wakeMs;
+    m_running = true;
+    m_thread = CreateThread(NULL, 0, ThreadProc, this, 0, NULL);
+    if (m_thread == NULL) {
+        m_running = false;
+        return false;
+    }
+    return true;
+}
+
+bool BackgroundWriter::Stop(DWORD timeoutMs) {
+    if (m_thread == NULL) return true;
+
+    m_running = false;
+    bool exited = WaitForSingleObject(m_thread, timeoutMs) == WAIT_OBJECT_0;
+    CloseHandle(m_thread);
+    m_thread = NULL;
+    return exited;
+}
+
+bool BackgroundWriter::Flush(DWORD timeoutMs) {
+    if (m_thread == NULL) return false;
+
+    uint32_t ticket = m_flushRequested.fetch_add(1, std::memory_order_acq_rel) + 1;
+    DWORD waited = 0;
+    while ((int32_t)(m_flushCompleted.load(std::memory_order_acquire) - ticket) < 0) {
+        if (waited >= timeoutMs) return false;
+        Sleep(5);
+        waited += 5;
+    }
+    return true;
+}
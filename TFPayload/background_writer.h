@@ -0,0 +1,38 @@
+#pragma once
+#include <Windows.h>
+#include <atomic>
+#include <cstdint>
+
+// Writer thread shared by the streaming loggers (SessionLog, PacketCapture)
+// The owner keeps its own queue and file; the thread calls its drain function every wakeMs,
+// and once more after Stop() asks it to exit. Flush() hands out a ticket and waits until a
+// drain that was told to flush has run past it, so a caller knows its data is on disk.
+
+class BackgroundWriter {
+public:
+    // Writer thread only. flush is true when a Flush() is waiting (and on the final drain);
+    // the function must have everything queued so far written out before returning then.
+    using DrainFn = void (*)(bool flush);
+
+    // Start the thread; false if it could not be created
+    bool Start(DrainFn drain, DWORD wakeMs);
+
+    // Final drain and exit. False if the thread did not exit in time - it may still be
+    // writing, so the owner must leave its file open.
+    bool Stop(DWORD timeoutMs = 2000);
+
+    // Block until everything queued before the call is written (or timeoutMs passes)
+    bool Flush(DWORD timeoutMs);
+
+    bool IsRunning() const { return m_thread != NULL; }
+
+private:
+    static DWORD WINAPI ThreadProc(LPVOID param);
+
+    DrainFn m_drain = nullptr;
+    DWORD m_wakeMs = 0;
+    volatile bool m_running = false;
+    HANDLE m_thread = NULL;
+    std::atomic<uint32_t> m_flushRequested{ 0 };
+    std::atomic<uint32_t> m_flushCompleted{ 0 };
+};
@@ -7,7 +7,9 @@
 #include "respawn.h"
 #include "logging.h"
 #include "keybindings.h"
+#include "game_thread.h"
 #include <Windows.h>
+#include <atomic>
 #include <unordered_map>
 
 namespace BikeSwap {
@@ -159,6 +161,7 @@ namespace BikeSwap {
     static DWORD g_swapRequestTime = 0;
     static const DWORD SWAP_COOLDOWN_MS = 500;  // Minimum time between swap attempts
     static SwapState g_swapState = SwapState::None;
+    static std::atomic<bool> g_pendingSwapCheckQueued{ false };   // ProcessPendingBikeSwap posted, not yet run
     
     // Track restart function pointer for safer bike swapping
     typedef void*(__cdecl* AllocateMemoryFunc)(int size);
@@ -1016,15 +1019,21 @@ namespace BikeSwap {
             return;
         }
 
-        // Process any pending bike swap (deferred execution)
-        ProcessPendingBikeSwap();
+        // Process any pending bike swap (deferred execution, on the game thread like the swap itself)
+        // Only one check is queued at a time so nothing piles up while frames are not rendering
+        if (!g_pendingSwapCheckQueued.exchange(true)) {
+            GameThread::Post("ProcessPendingBikeSwap", []() {
+                g_pendingSwapCheckQueued = false;
+                ProcessPendingBikeSwap();
+            });
+        }
 
         // [ key - Cycle to previous bike
         bool bracketLeftDown = (GetAsyncKeyState(VK_OEM_4) & 0x8000) != 0;
         if (bracketLeftDown && !g_bracketLeftPressed) {
             g_bracketLeftPressed = true;
             LOG_VERBOSE("[BikeSwap] '[' pressed - Cycling to previous bike");
-            CyclePreviousBike();
+            GameThread::Post("CyclePreviousBike", &CyclePreviousBike);
         } else if (!bracketLeftDown) {
             g_bracketLeftPressed = false;
         }
@@ -1034,7 +1043,7 @@ namespace BikeSwap {
         if (bracketRightDown && !g_bracketRightPressed) {
             g_bracketRightPressed = true;
             LOG_VERBOSE("[BikeSwap] ']' pressed - Cycling to next bike");
-            CycleNextBike();
+            GameThread::Post("CycleNextBike", &CycleNextBike);
         } else if (!bracketRightDown) {
             g_bracketRightPressed = false;
         }
@@ -1043,7 +1052,7 @@ namespace BikeSwap {
         bool backslashDown = (GetAsyncKeyState(VK_OEM_5) & 0x8000) != 0;
         if (backslashDown && !g_backslashPressed) {
             g_backslashPressed = true;
-            DebugDumpBikeState();
+            GameThread::Post("DebugDumpBikeState", &DebugDumpBikeState);
         } else if (!backslashDown) {
             g_backslashPressed = false;
         }
@@ -6,40 +6,50 @@
 #include <functional>
 #include <unordered_map>
 #include "keybindings.h"
+#include "tweakable_registry.h"
+#include "tweakable_search.h"
+#include "tweakable_journal.h"
 
 // Forward declarations
 class DevMenuNode;
 class DevMenuFolder;
 
-// Enum for tweakable types
-enum class TweakableType {
-    Float,
-    Int,
-    Bool,
-    Button,
-    Folder
-};
-
 // Base class for all tweakable items
-class TweakableItem {
+// Items describe the menu while DevMenu::Initialize builds it; once DevMenu flattens the tree
+// they are bound to a TweakableRegistry slot and their values live there instead.
+class TweakableItem : public TweakableListener {
 public:
     TweakableItem(int id, const std::string& name, TweakableType type)
-        : m_id(id), m_name(name), m_type(type) {}
+        : m_id(id), m_name(name), m_type(type), m_registry(nullptr), m_slot(0) {}
     
     virtual ~TweakableItem() = default;
     
     int GetId() const { return m_id; }
     const std::string& GetName() const { return m_name; }
-    void SetName(const std::string& name) { m_name = name; }
+    void SetName(const std::string& name) {
+        m_name = name;
+        if (m_registry) m_registry->SetName(m_slot, name.c_str());
+    }
     TweakableType GetType() const { return m_type; }
     
+    void Bind(TweakableRegistry* registry, uint32_t slot) {
+        m_registry = registry;
+        m_slot = slot;
+    }
+    bool IsBound() const { return m_registry != nullptr; }
+    
+    // Unbound items only (bound ones are drawn by TweakableRegistry::Render)
     virtual void Render() = 0;
     virtual void Reset() = 0;
+    
+    void OnTweakableChanged(TweakableRegistry&, uint32_t) override {}
 
 protected:
     int m_id;
     std::string m_name;
     TweakableType m_type;
+    TweakableRegistry* m_registry;
+    uint32_t m_slot;
 };
 
 // Float tweakable
@@ -54,19 +64,30 @@ public:
           m_maxValue(maxValue) {}
     
     void Render() override;
-    void Reset() override { m_value = m_defaultValue; }
+    void Reset() override { SetValue(m_defaultValue); }
     
-    float GetValue() const { return m_value; }
-    void SetValue(float value) { m_value = value; }
+    float GetValue() const { return m_registry ? m_registry->GetFloat(m_slot) : m_value; }
+    void SetValue(float value) {
+        if (m_registry) m_registry->SetFloat(m_slot, value);
+        else m_value = value;
+    }
+    float GetDefaultValue() const { return m_defaultValue; }
+    float GetMinValue() const { return m_minValue; }
+    float GetMaxValue() const { return m_maxValue; }
     
     void SetRange(float min, float max) {
         m_minValue = min;
         m_maxValue = max;
+        if (m_registry) m_registry->SetRange(m_slot, TweakableValue::Float(min), TweakableValue::Float(max));
     }
     
     void SetOnChangeCallback(std::function<void(float)> callback) {
         m_onChange = callback;
     }
+    
+    void OnTweakableChanged(TweakableRegistry&, uint32_t) override {
+        if (m_onChange) m_onChange(GetValue());
+    }
 
 private:
     float m_value;
@@ -88,19 +109,30 @@ public:
           m_maxValue(maxValue) {}
     
     void Render() override;
-    void Reset() override { m_value = m_defaultValue; }
+    void Reset() override { SetValue(m_defaultValue); }
     
-    int GetValue() const { return m_value; }
-    void SetValue(int value) { m_value = value; }
+    int GetValue() const { return m_registry ? m_registry->GetInt(m_slot) : m_value; }
+    void SetValue(int value) {
+        if (m_registry) m_registry->SetInt(m_slot, value);
+        else m_value = value;
+    }
+    int GetDefaultValue() const { return m_defaultValue; }
+    int GetMinValue() const { return m_minValue; }
+    int GetMaxValue() const { return m_maxValue; }
     
     void SetRange(int min, int max) {
         m_minValue = min;
         m_maxValue = max;
+        if (m_registry) m_registry->SetRange(m_slot, TweakableValue::Int(min), TweakableValue::Int(max));
     }
     
     void SetOnChangeCallback(std::function<void(int)> callback) {
         m_onChange = callback;
     }
+    
+    void OnTweakableChanged(TweakableRegistry&, uint32_t) override {
+        if (m_onChange) m_onChange(GetValue());
+    }
 
 private:
     int m_value;
@@ -119,14 +151,22 @@ public:
           m_defaultValue(defaultValue) {}
     
     void Render() override;
-    void Reset() override { m_value = m_defaultValue; }
+    void Reset() override { SetValue(m_defaultValue); }
     
-    bool GetValue() const { return m_value; }
-    void SetValue(bool value) { m_value = value; }
+    bool GetValue() const { return m_registry ? m_registry->GetBool(m_slot) : m_value; }
+    void SetValue(bool value) {
+        if (m_registry) m_registry->SetBool(m_slot, value);
+        else m_value = value;
+    }
+    bool GetDefaultValue() const { return m_defaultValue; }
     
     void SetOnChangeCallback(std::function<void(bool)> callback) {
         m_onChange = callback;
     }
+    
+    void OnTweakableChanged(TweakableRegistry&, uint32_t) override {
+        if (m_onChange) m_onChange(GetValue());
+    }
 
 private:
     bool m_value;
@@ -153,6 +193,8 @@ public:
             m_onClick();
         }
     }
+    
+    void OnTweakableChanged(TweakableRegistry&, uint32_t) override { TriggerClick(); }
 
 private:
     std::function<void()> m_onClick;
@@ -176,8 +218,11 @@ public:
         return m_children;
     }
     
-    bool IsOpen() const { return m_isOpen; }
-    void SetOpen(bool open) { m_isOpen = open; }
+    bool IsOpen() const { return m_registry ? m_registry->IsOpen(m_slot) : m_isOpen; }
+    void SetOpen(bool open) {
+        m_isOpen = open;
+        if (m_registry) m_registry->SetOpen(m_slot, open);
+    }
 
 private:
     std::vector<std::shared_ptr<TweakableItem>> m_children;
@@ -208,27 +253,31 @@ public:
     void HideKeybindingsWindow() { m_showKeybindingsWindow = false; }
     bool IsKeybindingsWindowVisible() const { return m_showKeybindingsWindow; }
     
+    // Toggle leaderboard analytics window visibility
+    void ToggleAnalyticsWindow() { m_showAnalyticsWindow = !m_showAnalyticsWindow; }
+    bool IsAnalyticsWindowVisible() const { return m_showAnalyticsWindow; }
+    
+    // Toggle the multiplayer hook latency overlay
+    void ToggleNetworkOverlay() { m_showNetworkOverlay = !m_showNetworkOverlay; }
+    bool IsNetworkOverlayVisible() const { return m_showNetworkOverlay; }
+    
+    // Toggle the per-packet-type network dashboard
+    void ToggleNetworkDashboard() { m_showNetworkDashboard = !m_showNetworkDashboard; }
+    bool IsNetworkDashboardVisible() const { return m_showNetworkDashboard; }
+    
+    // Toggle the per-frame tweakable sampler
+    void ToggleSamplerWindow() { m_showSamplerWindow = !m_showSamplerWindow; }
+    bool IsSamplerWindowVisible() const { return m_showSamplerWindow; }
+    
+    // Toggle the list of tweakables changed from their defaults
+    void ToggleChangesWindow() { m_showChangesWindow = !m_showChangesWindow; }
+    bool IsChangesWindowVisible() const { return m_showChangesWindow; }
+    
     // Reset all values to defaults
     void ResetAll();
     
     // Search functionality
-    void SetSearchFilter(const std::string& filter) { m_searchFilter = filter; }
-    
-    // Get tweakable by ID
-    template<typename T>
-    std::shared_ptr<T> GetTweakable(int id) {
-        auto it = m_tweakableMap.find(id);
-        if (it != m_tweakableMap.end()) {
-            return std::dynamic_pointer_cast<T>(it->second);
-        }
-        return nullptr;
-    }
-    
-    // Quick access to common tweakables
-    std::shared_ptr<TweakableFloat> GetFloat(int id);
-    std::shared_ptr<TweakableInt> GetInt(int id);
-    std::shared_ptr<TweakableBool> GetBool(int id);
-    std::shared_ptr<TweakableFolder> GetFolder(int id);
+    void SetSearchFilter(const std::string& filter);
     
     // Save/Load configurations
     void SaveConfig(const std::string& filename);
@@ -236,44 +285,14 @@ public:
     
     // Dump all tweakables from game memory (recursive)
     void DumpTweakablesData();
+    
+    // Flat storage for every tweakable value (filled at the end of Initialize)
+    TweakableRegistry& GetRegistry() { return m_registry; }
+    
+    // Edits of the game's tweakables; flushed to game memory once per frame
+    TweakableJournal& GetJournal() { return m_journal; }
 
 private:
-    void InitializeBikeSound();
-    void InitializeDynamicMusic();
-    void InitializeProgressionSystem();
-    void InitializeGarage();
-    void InitializeContentPack();
-    void InitializeDLC();
-    void InitializeEditor();
-    void InitializeMultiplayer();
-    void InitializeEvent();
-    void InitializeFMX();
-    void InitializeBike();
-    void InitializeRider();
-    void InitializeVibra();
-    void InitializeSoundSystem();
-    void InitializeReplayCRC();
-    void InitializeUtils();
-    void InitializeReplayCamera();
-    void InitializePhysics();
-    void InitializeFrameSkipper();
-    void InitializeGraphic();
-    void InitializePodium();
-    void InitializeXPSystem();
-    void InitializeTrackUpload();
-    void InitializeGameOption();
-    void InitializeGameSwf();
-    void InitializeGameTime();
-    void InitializeVariableFramerate();
-    void InitializeDebug();
-    void InitializeInGameHud();
-    void InitializeMainHub();
-    void InitializeMainMenu();
-    void InitializeFlash();
-    void InitializeGarbageCollector();
-    void InitializeSettings();
-    void InitializeDebugLocalization();
-    
     // NEW: Mod-specific tweakables (not synced to game)
     void InitializeMod();
     
@@ -282,19 +301,56 @@ private:
     
     // Helper functions
     void RegisterTweakable(std::shared_ptr<TweakableItem> item);
-    bool PassesFilter(const std::string& name);
-    
+    void BuildRegistry();
+    void AddToRegistry(const std::shared_ptr<TweakableItem>& item, uint32_t parent);
+    void ApplySearchFilter();
+    void UpdateKeybindLayout();
+    void RenderKeybindingsWindow();
+    void RenderAnalyticsWindow();
+    void RenderLocateSection(bool scannerBusy);
+    void RenderOutputDirectoryMenu();
+    void RenderNetworkOverlay();
+    void RenderNetworkDashboard();
+    void RenderSamplerWindow();
+    void RenderChangesWindow();
+    
+    // Mod tree built by InitializeMod, flattened into m_registry by BuildRegistry()
     std::vector<std::shared_ptr<TweakableFolder>> m_rootFolders;
-    std::unordered_map<int, std::shared_ptr<TweakableItem>> m_tweakableMap;
+    std::vector<std::shared_ptr<TweakableItem>> m_registered;
+    
+    TweakableRegistry m_registry;
+    std::vector<std::shared_ptr<TweakableItem>> m_slotItems;   // Keeps bound items alive, by slot (null for table rows)
+    TweakableSearchIndex m_searchIndex;                         // Built with the registry, queried when the filter text changes
+    TweakableJournal m_journal;                                 // Listener for the game's rows: batched writes and undo
     
     // Keybindings storage (separate from root folders)
     std::vector<std::shared_ptr<TweakableItem>> m_keybindingItems;
     std::vector<Keybindings::Action> m_keybindingActions; // Stores the Action for each keybinding button
     std::vector<int> m_keybindingDefaults; // Stores the default key for each keybinding button
+    
+    // Keybindings window rows, cached by UpdateKeybindLayout()
+    struct KeybindRow {
+        int key = 0;
+        bool overbound = false;         // Key shared with another action
+        float actionWidth = 0.0f;
+        std::string actionName;
+        std::string keyName;
+        std::string label;              // Padded "action: key##bind" button label
+    };
+    std::vector<KeybindRow> m_keybindRows;
+    float m_keybindButtonWidth = 0.0f;
+    float m_keybindFontSize = 0.0f;
+    uint32_t m_keybindGeneration = 0;
+    bool m_keybindLayoutValid = false;
     bool m_showKeybindingsWindow;
+    bool m_showAnalyticsWindow;
+    bool m_showNetworkOverlay;
+    bool m_showNetworkDashboard;
+    bool m_showSamplerWindow;
+    bool m_showChangesWindow;
     
     bool m_isVisible;
-    std::string m_searchFilter;
+    char m_searchFilter[TweakableSearchIndex::MAX_QUERY + 1];
     
     // UI state
     float m_menuWidth;
@@ -4,10 +4,41 @@
 #include "devMenuSync.h"
 #include "devMenu.h"
 #include "logging.h"
+#include <algorithm>
+#include <atomic>
+#include <emmintrin.h>
+#include <fstream>
+#include <mutex>
+#include <vector>
 
 namespace DevMenuSync {
     std::unordered_map<int, TweakableMemoryInfo> g_tweakableMemoryMap;
 
+    // Live sync: tracked values in registry order (built by BindRegistry while the poller is stopped)
+    static std::vector<uint32_t> s_trackedSlot;         // Registry slot per tracked index
+    static std::vector<void*> s_trackedAddress;         // Poller thread only while running
+    static std::vector<uint32_t> s_shadow[2];           // Snapshots, padded to a multiple of 4
+    static int s_shadowCurrent = 0;                     // Index of the latest snapshot
+
+    // Tracked indices the poller saw change, deduplicated until ApplyLiveChanges takes them
+    static std::mutex s_dirtyMutex;
+    static std::vector<uint8_t> s_dirty;
+    static std::vector<uint32_t> s_dirtyList;
+
+    static volatile bool s_pollRunning = false;
+    static HANDLE s_pollThread = NULL;
+    static std::atomic<DWORD> s_pollIntervalMs{ LIVE_SYNC_DEFAULT_INTERVAL_MS };
+
+    struct Counters {
+        std::atomic<uint64_t> polls{ 0 };
+        std::atomic<uint64_t> changes{ 0 };
+        std::atomic<uint64_t> applied{ 0 };
+        std::atomic<uint64_t> faults{ 0 };
+        std::atomic<uint32_t> lastPollMicros{ 0 };
+    };
+
+    static Counters s_counters;
+
     // Game addresses from devTweaks.cpp
     const uintptr_t INIT_DEV_MENU_DATA_ADDR = 0x00cef440;
     const uintptr_t BUILD_TWEAKABLES_LIST_ADDR = 0x00d623e0;
@@ -15,19 +46,101 @@ namespace DevMenuSync {
 
     typedef void* (__fastcall* InitializeDevMenuDataFunc)(int param_1);
 
+    // ========================================================================
+    // Memory map cache
+    // ========================================================================
+    // The id -> value address map from the last scan, stored relative to the module base and
+    // keyed by GetGameBuildHash(). It is trusted only after a few cached categories have been
+    // listed again through the game and still report the same ids, types and addresses.
+
+    const char* MEMORY_CACHE_PATH = "devmenu_tweakables.cache";
+    const uint32_t MEMORY_CACHE_MAGIC = 0x434D4654;     // "TFMC"
+    const uint16_t MEMORY_CACHE_VERSION = 2;
+    const int MEMORY_CACHE_SAMPLE_CATEGORIES = 4;
+
+#pragma pack(push, 1)
+    struct MemoryCacheHeader {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t headerSize;
+        uint32_t gameBuildHash;
+        uint32_t count;
+    };
+
+    struct MemoryCacheEntry {
+        int32_t id;
+        int32_t category;
+        uint32_t valueOffset;       // valuePtr - module base, 0 when not in the image
+        uint8_t type;
+        uint8_t isValid;
+        uint8_t inImage;            // 0: heap value, re-listed from its category on load
+        uint8_t reserved;
+    };
+#pragma pack(pop)
+
+    static_assert(sizeof(MemoryCacheHeader) == 16, "MemoryCacheHeader must stay 16 bytes");
+    static_assert(sizeof(MemoryCacheEntry) == 16, "MemoryCacheEntry must stay 16 bytes");
+
+    // Game tweakable type codes (TweakableMemoryInfo::type) per registry type
+    static int GetMemoryType(TweakableType type) {
+        switch (type) {
+        case TweakableType::Bool: return 1;
+        case TweakableType::Int: return 2;
+        case TweakableType::Float: return 3;
+        default: return 0;
+        }
+    }
+
+    // Store each found game address in its registry slot so SyncFromGame is a flat walk,
+    // and list the same slots for the live sync poller
+    static int BindRegistry() {
+        TweakableRegistry& registry = g_DevMenu->GetRegistry();
+        int bound = 0;
+
+        s_trackedSlot.clear();
+        s_trackedAddress.clear();
+
+        for (uint32_t slot = 0, count = registry.GetCount(); slot < count; slot++) {
+            registry.SetGameValue(slot, nullptr);
+
+            auto* info = GetMemoryInfo(registry.GetId(slot));
+            if (!info || !info->isValid || !info->valuePtr) continue;
+            if (info->type != GetMemoryType(registry.GetType(slot))) continue;
+
+            registry.SetGameValue(slot, info->valuePtr);
+            s_trackedSlot.push_back(slot);
+            s_trackedAddress.push_back(info->valuePtr);
+            bound++;
+        }
+        return bound;
+    }
+
+    static bool LoadMemoryCache();
+    static void SaveMemoryCache();
+
     bool Initialize() {
         LOG_VERBOSE("[DevMenuSync] Initializing sync system...");
+
+        // The poller reads the tracked list that BindRegistry rebuilds
+        StopLiveSync();
         
-        if (!ScanGameMemory()) {
-            LOG_ERROR("[DevMenuSync] Failed to scan game memory!");
-            return false;
+        if (!LoadMemoryCache()) {
+            if (!ScanGameMemory()) {
+                LOG_ERROR("[DevMenuSync] Failed to scan game memory!");
+                return false;
+            }
+            SaveMemoryCache();
         }
 
-        LOG_VERBOSE("[DevMenuSync] Sync system initialized! Found " << g_tweakableMemoryMap.size() << " tweakables.");
+        int bound = g_DevMenu ? BindRegistry() : 0;
+
+        LOG_VERBOSE("[DevMenuSync] Sync system initialized! Found " << g_tweakableMemoryMap.size() << " tweakables ("
+            << bound << " in the menu).");
         return true;
     }
 
     void Shutdown() {
+        StopLiveSync();
         g_tweakableMemoryMap.clear();
     }
 
@@ -39,8 +152,8 @@ namespace DevMenuSync {
         return nullptr;
     }
 
-    // Recursive function to scan a category and all its children
-    void ScanCategoryRecursive(void* devMenuData, uintptr_t buildTweakablesListAddr, int categoryId) {
+    // The game's tweakable objects directly under one category (BuildTweakablesList)
+    static void ListCategory(void* devMenuData, uintptr_t buildTweakablesListAddr, int categoryId, std::vector<void*>& out) {
         int outputArray[3] = { 0, 2, 0 };
         void* arrayData = malloc(8);
         outputArray[2] = (int)arrayData;
@@ -54,25 +167,42 @@ namespace DevMenuSync {
         }
 
         void** tweakablePointers = (void**)outputArray[2];
+        out.assign(tweakablePointers, tweakablePointers + outputArray[0]);
+
+        free(arrayData);
+    }
+
+    // Fields of a listed tweakable object
+    static int GetObjectType(void* tweakablePtr) { return ((int*)tweakablePtr)[1]; }      // +0x04
+    static int GetObjectId(void* tweakablePtr) { return ((int*)tweakablePtr)[2]; }        // +0x08
+    static void* GetObjectValue(void* tweakablePtr) { return *(void**)((uint8_t*)tweakablePtr + 0x1bc); }
 
-        for (int i = 0; i < outputArray[0]; i++) {
-            void* tweakablePtr = tweakablePointers[i];
+    // Store the memory location of a listed non-folder tweakable
+    static void StoreObject(void* tweakablePtr, int categoryId) {
+        void* valuePtr = GetObjectValue(tweakablePtr);
 
+        TweakableMemoryInfo info;
+        info.valuePtr = valuePtr;
+        info.type = GetObjectType(tweakablePtr);
+        info.category = categoryId;
+        info.isValid = (valuePtr != nullptr);
+
+        g_tweakableMemoryMap[GetObjectId(tweakablePtr)] = info;
+    }
+
+    // Recursive function to scan a category and all its children
+    void ScanCategoryRecursive(void* devMenuData, uintptr_t buildTweakablesListAddr, int categoryId) {
+        std::vector<void*> tweakablePointers;
+        ListCategory(devMenuData, buildTweakablesListAddr, categoryId, tweakablePointers);
+
+        for (void* tweakablePtr : tweakablePointers) {
             if (tweakablePtr != nullptr) {
-                unsigned int* data = (unsigned int*)tweakablePtr;
-                int type = data[1];  // +0x04
-                int id = data[2];     // +0x08
+                int type = GetObjectType(tweakablePtr);
+                int id = GetObjectId(tweakablePtr);
 
                 // For non-folder types, store the memory location
                 if (type >= 1 && type <= 3) {
-                    void** valuePtr = (void**)(data + 0x1bc/4);
-                    
-                    TweakableMemoryInfo info;
-                    info.valuePtr = *valuePtr;
-                    info.type = type;
-                    info.isValid = (*valuePtr != nullptr);
-
-                    g_tweakableMemoryMap[id] = info;
+                    StoreObject(tweakablePtr, categoryId);
                 }
 
                 // If it's a folder, recursively scan it
@@ -81,13 +211,10 @@ namespace DevMenuSync {
                 }
             }
         }
-
-        free(arrayData);
     }
 
-    bool ScanGameMemory() {
-        LOG_VERBOSE("[DevMenuSync] Scanning game memory for tweakables...");
-
+    // The game's dev menu data, created through the game if it doesn't exist yet
+    static void* GetDevMenuData() {
         uintptr_t baseAddress = (uintptr_t)GetModuleHandle(NULL);
 
         // Get pointer to global dev menu data
@@ -103,11 +230,21 @@ namespace DevMenuSync {
 
         if (devMenuData == nullptr) {
             LOG_ERROR("[DevMenuSync] Failed to initialize dev menu data!");
+        }
+        return devMenuData;
+    }
+
+    bool ScanGameMemory() {
+        LOG_VERBOSE("[DevMenuSync] Scanning game memory for tweakables...");
+
+        void* devMenuData = GetDevMenuData();
+        if (devMenuData == nullptr) {
             return false;
         }
 
         LOG_VERBOSE("[DevMenuSync] Dev menu data @ 0x" << std::hex << (uintptr_t)devMenuData);
 
+        uintptr_t baseAddress = (uintptr_t)GetModuleHandle(NULL);
         uintptr_t buildTweakablesListAddr = baseAddress + BUILD_TWEAKABLES_LIST_ADDR - 0x700000;
 
         // Clear existing map
@@ -120,6 +257,212 @@ namespace DevMenuSync {
         return true;
     }
 
+    uint32_t GetGameBuildHash() {
+        static const uint32_t s_hash = []() {
+            const uint8_t* base = (const uint8_t*)GetModuleHandleA(NULL);
+            const IMAGE_DOS_HEADER* dos = (const IMAGE_DOS_HEADER*)base;
+            const IMAGE_NT_HEADERS* nt = (const IMAGE_NT_HEADERS*)(base + dos->e_lfanew);
+            const uint32_t fields[] = {
+                nt->FileHeader.TimeDateStamp,
+                nt->OptionalHeader.SizeOfImage,
+                nt->OptionalHeader.CheckSum,
+                nt->OptionalHeader.AddressOfEntryPoint,
+            };
+
+            // FNV-1a
+            uint32_t hash = 2166136261u;
+            const uint8_t* bytes = (const uint8_t*)fields;
+            for (size_t i = 0; i < sizeof(fields); i++) {
+                hash = (hash ^ bytes[i]) * 16777619u;
+            }
+            return hash;
+        }();
+        return s_hash;
+    }
+
+    // Only values inside the game image sit at the same offset every launch; heap values don't
+    static bool IsInGameImage(const void* address) {
+        static const uintptr_t s_imageSize = []() {
+            const uint8_t* base = (const uint8_t*)GetModuleHandleA(NULL);
+            const IMAGE_DOS_HEADER* dos = (const IMAGE_DOS_HEADER*)base;
+            const IMAGE_NT_HEADERS* nt = (const IMAGE_NT_HEADERS*)(base + dos->e_lfanew);
+            return (uintptr_t)nt->OptionalHeader.SizeOfImage;
+        }();
+        uintptr_t baseAddress = (uintptr_t)GetModuleHandle(NULL);
+        return address && (uintptr_t)address - baseAddress < s_imageSize;
+    }
+
+    // Re-list categories through the game (non-recursive) and take their values as listed
+    static bool RelistCategories(const std::vector<int>& categories) {
+        void* devMenuData = GetDevMenuData();
+        if (devMenuData == nullptr) {
+            return false;
+        }
+
+        uintptr_t baseAddress = (uintptr_t)GetModuleHandle(NULL);
+        uintptr_t buildTweakablesListAddr = baseAddress + BUILD_TWEAKABLES_LIST_ADDR - 0x700000;
+
+        std::vector<void*> tweakablePointers;
+        for (int category : categories) {
+            ListCategory(devMenuData, buildTweakablesListAddr, category, tweakablePointers);
+            for (void* tweakablePtr : tweakablePointers) {
+                if (tweakablePtr == nullptr) continue;
+                int type = GetObjectType(tweakablePtr);
+                if (type >= 1 && type <= 3) {
+                    StoreObject(tweakablePtr, category);
+                }
+            }
+        }
+        return true;
+    }
+
+    // Re-list a few cached categories through the game (non-recursive) and compare every value
+    // they report with the map; any difference means the cache is stale
+    static bool ValidateMemoryMap(const std::vector<int>& categories) {
+        void* devMenuData = GetDevMenuData();
+        if (devMenuData == nullptr) {
+            return false;
+        }
+
+        uintptr_t baseAddress = (uintptr_t)GetModuleHandle(NULL);
+        uintptr_t buildTweakablesListAddr = baseAddress + BUILD_TWEAKABLES_LIST_ADDR - 0x700000;
+
+        std::vector<void*> tweakablePointers;
+        for (int category : categories) {
+            ListCategory(devMenuData, buildTweakablesListAddr, category, tweakablePointers);
+
+            size_t listed = 0;
+            for (void* tweakablePtr : tweakablePointers) {
+                if (tweakablePtr == nullptr) continue;
+                int type = GetObjectType(tweakablePtr);
+                if (type < 1 || type > 3) continue;
+
+                auto* info = GetMemoryInfo(GetObjectId(tweakablePtr));
+                if (!info || info->category != category || info->type != type || info->valuePtr != GetObjectValue(tweakablePtr)) {
+                    LOG_VERBOSE("[DevMenuSync] Cache mismatch for tweakable " << GetObjectId(tweakablePtr) << " in category " << category);
+                    return false;
+                }
+                listed++;
+            }
+
+            // Nothing removed from the category either
+            size_t cached = 0;
+            for (const auto& pair : g_tweakableMemoryMap) {
+                if (pair.second.category == category) cached++;
+            }
+            if (cached != listed) {
+                LOG_VERBOSE("[DevMenuSync] Cache lists " << cached << " values in category " << category << ", game lists " << listed);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool LoadMemoryCache() {
+        std::ifstream file(MEMORY_CACHE_PATH, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        MemoryCacheHeader header;
+        if (!file.read((char*)&header, sizeof(header)) || header.magic != MEMORY_CACHE_MAGIC ||
+            header.version != MEMORY_CACHE_VERSION || header.headerSize != sizeof(MemoryCacheHeader)) {
+            LOG_WARNING("[DevMenuSync] Ignoring unreadable memory map cache " << MEMORY_CACHE_PATH);
+            return false;
+        }
+        if (header.gameBuildHash != GetGameBuildHash()) {
+            LOG_VERBOSE("[DevMenuSync] Memory map cache is for another game build, rescanning");
+            return false;
+        }
+
+        std::vector<MemoryCacheEntry> entries(header.count);
+        if (header.count == 0 || !file.read((char*)entries.data(), entries.size() * sizeof(MemoryCacheEntry))) {
+            LOG_WARNING("[DevMenuSync] Memory map cache " << MEMORY_CACHE_PATH << " is truncated");
+            return false;
+        }
+
+        uintptr_t baseAddress = (uintptr_t)GetModuleHandle(NULL);
+        std::vector<int> relisted;
+        g_tweakableMemoryMap.clear();
+        g_tweakableMemoryMap.reserve(entries.size());
+        for (const MemoryCacheEntry& entry : entries) {
+            TweakableMemoryInfo info;
+            info.valuePtr = entry.inImage ? (void*)(baseAddress + entry.valueOffset) : nullptr;
+            info.type = entry.type;
+            info.category = entry.category;
+            info.isValid = entry.inImage && entry.isValid != 0;
+            g_tweakableMemoryMap[entry.id] = info;
+
+            if (!entry.inImage && std::find(relisted.begin(), relisted.end(), entry.category) == relisted.end()) {
+                relisted.push_back(entry.category);
+            }
+        }
+
+        // Heap values moved since the cache was written - ask the game where they are now
+        if (!relisted.empty() && !RelistCategories(relisted)) {
+            g_tweakableMemoryMap.clear();
+            return false;
+        }
+
+        // Sample categories spread over the cache
+        std::vector<int> categories;
+        for (int i = 0; i < MEMORY_CACHE_SAMPLE_CATEGORIES; i++) {
+            int category = entries[entries.size() * i / MEMORY_CACHE_SAMPLE_CATEGORIES].category;
+            if (std::find(categories.begin(), categories.end(), category) == categories.end()) {
+                categories.push_back(category);
+            }
+        }
+
+        if (!ValidateMemoryMap(categories)) {
+            LOG_INFO("[DevMenuSync] Memory map cache is stale, rescanning");
+            g_tweakableMemoryMap.clear();
+            return false;
+        }
+
+        LOG_VERBOSE("[DevMenuSync] Memory map loaded from cache: " << g_tweakableMemoryMap.size() << " tweakables ("
+            << categories.size() << " categories checked, " << relisted.size() << " re-listed for heap values)");
+        return true;
+    }
+
+    static void SaveMemoryCache() {
+        if (g_tweakableMemoryMap.empty()) {
+            return;
+        }
+
+        MemoryCacheHeader header;
+        header.magic = MEMORY_CACHE_MAGIC;
+        header.version = MEMORY_CACHE_VERSION;
+        header.headerSize = sizeof(MemoryCacheHeader);
+        header.gameBuildHash = GetGameBuildHash();
+        header.count = (uint32_t)g_tweakableMemoryMap.size();
+
+        // Sorted by id, so the file is the same for the same game
+        uintptr_t baseAddress = (uintptr_t)GetModuleHandle(NULL);
+        std::vector<MemoryCacheEntry> entries;
+        entries.reserve(g_tweakableMemoryMap.size());
+        for (const auto& pair : g_tweakableMemoryMap) {
+            MemoryCacheEntry entry;
+            entry.id = pair.first;
+            entry.category = pair.second.category;
+            entry.inImage = IsInGameImage(pair.second.valuePtr) ? 1 : 0;
+            entry.valueOffset = entry.inImage ? (uint32_t)((uintptr_t)pair.second.valuePtr - baseAddress) : 0;
+            entry.type = (uint8_t)pair.second.type;
+            entry.isValid = pair.second.isValid ? 1 : 0;
+            entry.reserved = 0;
+            entries.push_back(entry);
+        }
+        std::sort(entries.begin(), entries.end(), [](const MemoryCacheEntry& a, const MemoryCacheEntry& b) { return a.id < b.id; });
+
+        std::ofstream file(MEMORY_CACHE_PATH, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            LOG_WARNING("[DevMenuSync] Failed to write memory map cache " << MEMORY_CACHE_PATH);
+            return;
+        }
+        file.write((const char*)&header, sizeof(header));
+        file.write((const char*)entries.data(), entries.size() * sizeof(MemoryCacheEntry));
+        LOG_VERBOSE("[DevMenuSync] Memory map cached to " << MEMORY_CACHE_PATH);
+    }
+
     // Helper function to safely read from game memory
     template<typename T>
     bool SafeReadMemory(void* address, T& outValue) {
@@ -132,49 +475,47 @@ namespace DevMenuSync {
         }
     }
 
+    // Copy one game value into its registry slot; on a failed read the slot stops syncing
+    static bool RefreshSlot(TweakableRegistry& registry, uint32_t slot) {
+        void* address = registry.GetGameValue(slot);
+        if (!address) return false;
+
+        bool ok = false;
+        switch (registry.GetType(slot)) {
+        case TweakableType::Bool: {
+            int gameValue = 0;
+            if ((ok = SafeReadMemory(address, gameValue))) registry.SetBool(slot, gameValue != 0);
+            break;
+        }
+        case TweakableType::Int: {
+            int gameValue = 0;
+            if ((ok = SafeReadMemory(address, gameValue))) registry.SetInt(slot, gameValue);
+            break;
+        }
+        case TweakableType::Float: {
+            float gameValue = 0.0f;
+            if ((ok = SafeReadMemory(address, gameValue))) registry.SetFloat(slot, gameValue);
+            break;
+        }
+        default:
+            break;
+        }
+
+        if (!ok) {
+            registry.SetGameValue(slot, nullptr);
+            auto* info = GetMemoryInfo(registry.GetId(slot));
+            if (info) info->isValid = false;
+        }
+        return ok;
+    }
+
     void SyncFromGame() {
         if (!g_DevMenu) return;
 
-        // Iterate through all tweakables in the ImGui menu and update them from game memory
-        for (auto& pair : g_tweakableMemoryMap) {
-            int id = pair.first;
-            auto& memInfo = pair.second;
-
-            if (!memInfo.isValid || !memInfo.valuePtr) continue;
-
-            if (memInfo.type == 1) {  // Bool
-                auto tweakable = g_DevMenu->GetBool(id);
-                if (tweakable) {
-                    int gameValue = 0;
-                    if (SafeReadMemory(memInfo.valuePtr, gameValue)) {
-                        tweakable->SetValue(gameValue != 0);
-                    } else {
-                        memInfo.isValid = false;
-                    }
-                }
-            }
-            else if (memInfo.type == 2) {  // Int
-                auto tweakable = g_DevMenu->GetInt(id);
-                if (tweakable) {
-                    int gameValue = 0;
-                    if (SafeReadMemory(memInfo.valuePtr, gameValue)) {
-                        tweakable->SetValue(gameValue);
-                    } else {
-                        memInfo.isValid = false;
-                    }
-                }
-            }
-            else if (memInfo.type == 3) {  // Float
-                auto tweakable = g_DevMenu->GetFloat(id);
-                if (tweakable) {
-                    float gameValue = 0.0f;
-                    if (SafeReadMemory(memInfo.valuePtr, gameValue)) {
-                        tweakable->SetValue(gameValue);
-                    } else {
-                        memInfo.isValid = false;
-                    }
-                }
-            }
+        // Walk the registry in slot order; slots without a game address are skipped
+        TweakableRegistry& registry = g_DevMenu->GetRegistry();
+        for (uint32_t slot = 0, count = registry.GetCount(); slot < count; slot++) {
+            RefreshSlot(registry, slot);
         }
     }
 
@@ -182,4 +523,228 @@ namespace DevMenuSync {
         // This is handled by the onChange callbacks set up during initialization
         // See SetupSyncCallbacks() function
     }
+
+    // Write values [begin, count); returns the index that faulted, or count. SEH only.
+    static size_t WriteRange(void* const* addresses, const uint32_t* values, size_t begin, size_t count, size_t* written) {
+        volatile size_t i = begin;
+        __try {
+            for (; i < count; i++) {
+                uint32_t* address = (uint32_t*)addresses[i];
+                if (!address) continue;
+                *address = values[i];
+                (*written)++;
+            }
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER) {
+            return i;
+        }
+        return count;
+    }
+
+    size_t WriteBatch(void* const* addresses, const uint32_t* values, size_t count) {
+        size_t written = 0;
+        size_t begin = 0;
+        while ((begin = WriteRange(addresses, values, begin, count, &written)) < count) {
+            LOG_WARNING("[DevMenuSync] Batch write failed at " << addresses[begin] << ", skipped");
+            begin++;
+        }
+        return written;
+    }
+
+    // ============================================================================
+    // Live sync
+    // ============================================================================
+
+    // Copy tracked values [begin, count) into out, keeping the previous value for dropped
+    // addresses. Returns the index that faulted, or count. SEH only - no destructors here.
+    static size_t SnapshotRange(void* const* addresses, const uint32_t* previous, uint32_t* out, size_t begin, size_t count) {
+        volatile size_t i = begin;
+        __try {
+            for (; i < count; i++) {
+                const uint32_t* address = (const uint32_t*)addresses[i];
+                out[i] = address ? *address : previous[i];
+            }
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER) {
+            return i;
+        }
+        return count;
+    }
+
+    // Append the indices where the snapshots differ; paddedCount is a multiple of 4
+    static void CollectChanges(const uint32_t* current, const uint32_t* previous, size_t paddedCount, std::vector<uint32_t>& changed) {
+        for (size_t i = 0; i < paddedCount; i += 4) {
+            __m128i a = _mm_loadu_si128((const __m128i*)(current + i));
+            __m128i b = _mm_loadu_si128((const __m128i*)(previous + i));
+            int equal = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+            if (equal == 0xF) continue;
+
+            for (int lane = 0; lane < 4; lane++) {
+                if (!(equal & (1 << lane))) changed.push_back((uint32_t)(i + lane));
+            }
+        }
+    }
+
+    // Full snapshot into the other shadow buffer
+    static void TakeSnapshot() {
+        size_t count = s_trackedAddress.size();
+        const std::vector<uint32_t>& previous = s_shadow[s_shadowCurrent];
+        std::vector<uint32_t>& current = s_shadow[s_shadowCurrent ^ 1];
+
+        size_t begin = 0;
+        while ((begin = SnapshotRange(s_trackedAddress.data(), previous.data(), current.data(), begin, count)) < count) {
+            LOG_WARNING("[DevMenuSync] Live sync stopped tracking tweakable slot " << s_trackedSlot[begin]
+                << " (read failed)");
+            s_trackedAddress[begin] = nullptr;
+            current[begin] = previous[begin];
+            s_counters.faults.fetch_add(1, std::memory_order_relaxed);
+            begin++;
+        }
+        s_shadowCurrent ^= 1;
+    }
+
+    static void MarkDirty(const std::vector<uint32_t>& indices) {
+        std::lock_guard<std::mutex> lock(s_dirtyMutex);
+        for (uint32_t index : indices) {
+            if (!s_dirty[index]) {
+                s_dirty[index] = 1;
+                s_dirtyList.push_back(index);
+            }
+        }
+    }
+
+    static DWORD WINAPI PollThread(LPVOID) {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        std::vector<uint32_t> changed;
+        changed.reserve(s_trackedSlot.size());
+
+        while (s_pollRunning) {
+            LARGE_INTEGER start, end;
+            QueryPerformanceCounter(&start);
+
+            TakeSnapshot();
+            changed.clear();
+            CollectChanges(s_shadow[s_shadowCurrent].data(), s_shadow[s_shadowCurrent ^ 1].data(),
+                s_shadow[s_shadowCurrent].size(), changed);
+            if (!changed.empty()) {
+                MarkDirty(changed);
+                s_counters.changes.fetch_add(changed.size(), std::memory_order_relaxed);
+            }
+
+            QueryPerformanceCounter(&end);
+            s_counters.lastPollMicros.store((uint32_t)((end.QuadPart - start.QuadPart) * 1000000 / frequency.QuadPart),
+                std::memory_order_relaxed);
+            s_counters.polls.fetch_add(1, std::memory_order_relaxed);
+
+            Sleep(s_pollIntervalMs.load(std::memory_order_relaxed));
+        }
+        return 0;
+    }
+
+    bool StartLiveSync(DWORD intervalMs) {
+        SetLiveSyncInterval(intervalMs);
+        if (s_pollThread != NULL) return true;
+
+        if (s_trackedSlot.empty()) {
+            LOG_WARNING("[DevMenuSync] Live sync not started: no tweakables bound to game memory");
+            return false;
+        }
+
+        size_t padded = (s_trackedSlot.size() + 3) & ~(size_t)3;
+        s_shadow[0].assign(padded, 0);
+        s_shadow[1].assign(padded, 0);
+        s_shadowCurrent = 0;
+        TakeSnapshot();
+
+        // Everything is dirty once, so values that changed while stopped reach the menu
+        {
+            std::lock_guard<std::mutex> lock(s_dirtyMutex);
+            s_dirty.assign(s_trackedSlot.size(), 1);
+            s_dirtyList.resize(s_trackedSlot.size());
+            for (uint32_t i = 0; i < (uint32_t)s_dirtyList.size(); i++) s_dirtyList[i] = i;
+        }
+
+        s_pollRunning = true;
+        s_pollThread = CreateThread(NULL, 0, PollThread, NULL, 0, NULL);
+        if (s_pollThread == NULL) {
+            LOG_ERROR("[DevMenuSync] Failed to create live sync thread");
+            s_pollRunning = false;
+            return false;
+        }
+
+        LOG_INFO("[DevMenuSync] Live sync tracking " << s_trackedSlot.size() << " values every "
+            << s_pollIntervalMs.load() << " ms");
+        return true;
+    }
+
+    void StopLiveSync() {
+        if (s_pollThread == NULL) return;
+
+        s_pollRunning = false;
+        if (WaitForSingleObject(s_pollThread, 2000 + s_pollIntervalMs.load()) != WAIT_OBJECT_0) {
+            LOG_WARNING("[DevMenuSync] Live sync thread did not exit in time");
+        }
+        CloseHandle(s_pollThread);
+        s_pollThread = NULL;
+
+        {
+            std::lock_guard<std::mutex> lock(s_dirtyMutex);
+            s_dirty.clear();
+            s_dirtyList.clear();
+        }
+
+        LiveSyncStats stats = GetLiveSyncStats();
+        LOG_INFO("[DevMenuSync] Live sync stopped: " << stats.polls << " polls, " << stats.changes
+            << " changes, " << stats.faults << " faults");
+    }
+
+    bool IsLiveSyncRunning() {
+        return s_pollRunning;
+    }
+
+    void SetLiveSyncInterval(DWORD intervalMs) {
+        if (intervalMs < LIVE_SYNC_MIN_INTERVAL_MS) intervalMs = LIVE_SYNC_MIN_INTERVAL_MS;
+        if (intervalMs > LIVE_SYNC_MAX_INTERVAL_MS) intervalMs = LIVE_SYNC_MAX_INTERVAL_MS;
+        s_pollIntervalMs.store(intervalMs, std::memory_order_relaxed);
+    }
+
+    void ApplyLiveChanges() {
+        if (!g_DevMenu) return;
+
+        // StopLiveSync empties the list, so nothing is applied once the poller is gone
+        std::vector<uint32_t> indices;
+        {
+            std::lock_guard<std::mutex> lock(s_dirtyMutex);
+            if (s_dirtyList.empty()) return;
+            indices.swap(s_dirtyList);
+            for (uint32_t index : indices) s_dirty[index] = 0;
+        }
+
+        // Re-read rather than use the snapshot, so a value the user just set is never rolled back.
+        // Slots with a journal write pending (a preset applied in GameThread::Drain, an edit not
+        // flushed yet) keep the menu value: the game value is the one about to be replaced.
+        TweakableRegistry& registry = g_DevMenu->GetRegistry();
+        const TweakableJournal& journal = g_DevMenu->GetJournal();
+        uint64_t applied = 0;
+        for (uint32_t index : indices) {
+            uint32_t slot = s_trackedSlot[index];
+            if (journal.IsPending(slot)) continue;
+            if (RefreshSlot(registry, slot)) applied++;
+        }
+        s_counters.applied.fetch_add(applied, std::memory_order_relaxed);
+    }
+
+    LiveSyncStats GetLiveSyncStats() {
+        LiveSyncStats stats;
+        stats.running = s_pollRunning;
+        stats.tracked = (uint32_t)s_trackedSlot.size();
+        stats.intervalMs = s_pollIntervalMs.load(std::memory_order_relaxed);
+        stats.polls = s_counters.polls.load(std::memory_order_relaxed);
+        stats.changes = s_counters.changes.load(std::memory_order_relaxed);
+        stats.applied = s_counters.applied.load(std::memory_order_relaxed);
+        stats.faults = s_counters.faults.load(std::memory_order_relaxed);
+        stats.lastPollMicros = s_counters.lastPollMicros.load(std::memory_order_relaxed);
+        return stats;
+    }
 }
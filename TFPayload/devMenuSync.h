@@ -10,13 +10,15 @@ namespace DevMenuSync {
     struct TweakableMemoryInfo {
         void* valuePtr;      // Pointer to the actual value in game memory
         int type;            // 1=Bool, 2=Int, 3=Float
+        int category;        // Id of the game folder that lists it (0 = top level)
         bool isValid;        // Whether we successfully found this tweakable in game memory
     };
 
     // Map of tweakable ID -> game memory location
     extern std::unordered_map<int, TweakableMemoryInfo> g_tweakableMemoryMap;
 
-    // Initialize the sync system - scans game memory to find all tweakables
+    // Initialize the sync system - loads the memory map from the cache file when it still
+    // matches the running game, otherwise scans game memory and rewrites the cache
     bool Initialize();
 
     // Shutdown
@@ -65,6 +67,50 @@ namespace DevMenuSync {
     // Sync all ImGui tweakables TO game memory (write UI -> update game)
     void SyncToGame();
 
+    // Write raw 32-bit values (float bits, ints, 0/1 bools) to game addresses in one pass.
+    // Meant for the game thread, so a whole preset lands between two frames. Null addresses
+    // are skipped and a faulting one is logged and skipped; returns how many were written.
+    size_t WriteBatch(void* const* addresses, const uint32_t* values, size_t count);
+
     // Scan game memory and build the memory map
     bool ScanGameMemory();
+
+    // Hash of the running executable's PE header (timestamp, image size, checksum, entry point);
+    // identifies the game build for the memory map cache and tweakable presets
+    uint32_t GetGameBuildHash();
+
+    // ========================================================================
+    // Live sync
+    // ========================================================================
+    // A background thread snapshots every tracked game value into a contiguous shadow buffer,
+    // compares it with the previous snapshot (SSE2, four values per compare) and queues the
+    // ids that changed. The render thread re-reads only those in ApplyLiveChanges().
+
+    const DWORD LIVE_SYNC_DEFAULT_INTERVAL_MS = 100;
+    const DWORD LIVE_SYNC_MIN_INTERVAL_MS = 16;
+    const DWORD LIVE_SYNC_MAX_INTERVAL_MS = 2000;
+
+    struct LiveSyncStats {
+        bool running = false;
+        uint32_t tracked = 0;           // Values in the shadow buffer
+        uint32_t intervalMs = 0;
+        uint64_t polls = 0;
+        uint64_t changes = 0;           // Changed values seen by the poller
+        uint64_t applied = 0;           // Values updated in the menu
+        uint64_t faults = 0;            // Addresses dropped after a failed read
+        uint32_t lastPollMicros = 0;    // Snapshot + compare time of the latest poll
+    };
+
+    // Start polling (after Initialize); safe to call when already running
+    bool StartLiveSync(DWORD intervalMs = LIVE_SYNC_DEFAULT_INTERVAL_MS);
+    void StopLiveSync();
+    bool IsLiveSyncRunning();
+
+    // Clamped to [LIVE_SYNC_MIN_INTERVAL_MS, LIVE_SYNC_MAX_INTERVAL_MS]
+    void SetLiveSyncInterval(DWORD intervalMs);
+
+    // Render thread, once per frame - update the menu values the poller saw change
+    void ApplyLiveChanges();
+
+    LiveSyncStats GetLiveSyncStats();
 }
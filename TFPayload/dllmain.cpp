@@ -18,14 +18,17 @@
 #include "pause.h"
 #include "devMenu.h"
 #include "devMenuSync.h"
+#include "tweakable_presets.h"
 #include "rendering.h"
 #include "actionscript.h"
 #include "logging.h"
 #include "respawn.h"
+#include "patch_manager.h"
 #include "camera.h"
 #include "multiplayer.h"
 #include "keybindings.h"
 #include "bike-swap.h"
+#include "game_thread.h"
 #include <MinHook.h>
 
 // FORWARD DECLARATIONS
@@ -104,6 +107,8 @@ BOOL CALLBACK MonitorEnumProc(HMONITOR hMonitor, HDC hdcMonitor, LPRECT lprcMoni
 // CALLBACKS
 void OnTrackUpdate(const Tracks::TrackInfo& trackInfo)
 {
+    Respawn::OnTrackChanged();
+
     LOG_INFO("\n=== TRACK INFO ===");
     LOG_INFO("Track: " << trackInfo.trackName);
     LOG_INFO("Creator: " << trackInfo.creatorName);
@@ -137,8 +142,12 @@ extern "C" __declspec(dllexport) void ShutdownPayload()
     // Shutdown rendering BEFORE dev menu
     Rendering::Shutdown();
 
+    // Nothing drains the command queue once the render callback is gone
+    GameThread::Shutdown();
+
     // Shutdown DevMenuSync
     DevMenuSync::Shutdown();
+    TweakablePresets::Shutdown();
 
     // Now shutdown dev menu
     if (g_DevMenu) {
@@ -151,6 +160,7 @@ extern "C" __declspec(dllexport) void ShutdownPayload()
     LeaderboardDirect::Shutdown();
     Pause::Shutdown();
     Respawn::Shutdown();
+    PatchManager::Shutdown();
     Camera::Shutdown();
     Multiplayer::Shutdown();
     Keybindings::Shutdown();
@@ -190,6 +200,12 @@ extern "C" __declspec(dllexport) void PayloadInit()
 
     LOG_VERBOSE("[TFPayload] Game Base Address: " << baseAddress);
 
+    // Initialize keybindings system BEFORE dev menu - its config file also holds the
+    // output directory the modules below write to
+    Keybindings::Initialize();
+    Multiplayer::SetOutputDirectory(Keybindings::GetOutputDirectory());
+    LeaderboardScanner::SetOutputPath(Keybindings::GetOutputDirectory() + "leaderboard_scans.txt");
+
     // Initialize Hooks
     Tracks::SetLoggingEnabled(true);
     Tracks::SetUpdateCallback(OnTrackUpdate);
@@ -252,8 +268,6 @@ extern "C" __declspec(dllexport) void PayloadInit()
     // Initialize logging system
     Logging::Initialize();
     
-    // Initialize keybindings system BEFORE dev menu
-    Keybindings::Initialize();
 
     // Wait a moment to ensure ProxyDLL has hooked D3D11
     LOG_VERBOSE("[TFPayload] Waiting for ProxyDLL to initialize D3D11...");
@@ -281,6 +295,9 @@ extern "C" __declspec(dllexport) void PayloadInit()
             // Do initial sync from game to UI
             DevMenuSync::SyncFromGame();
             LOG_VERBOSE("[TFPayload] Initial sync complete");
+
+            // Keep the menu in step with values the game changes later
+            DevMenuSync::StartLiveSync();
         }
         
         LOG_VERBOSE("[TFPayload] Dev Menu ready! (Press HOME to toggle)");
@@ -425,10 +442,15 @@ void PrintHelpText()
     LOG_INFO("Multiplayer(Phase 1):");
     LOG_INFO("\t" << SaveMultiplayerLogsKey << "\t\t\t\t- Save all multiplayer logs (sessions, packets, stats)");
     LOG_INFO("\t" << CaptureSessionStateKey << "\t\t\t\t- Capture current session state");
-    LOG_VERBOSE("Logs: F:/mp_session_log.txt, F:/mp_sessions.csv, F:/mp_packets.csv");
+    LOG_VERBOSE("Logs (in " << Multiplayer::GetOutputDirectory() << "): mp_session_log.txt, mp_sessions.csv, mp_stats.txt, mp_packets.tfcap");
     LOG_INFO("");
     LOG_INFO("Dev Menu:");
     LOG_INFO("\t" << DumpTweakablesKey << "\t\t\t\t- Dump tweakables data (see what's available)");
+    for (int slot = 0; slot < TweakablePresets::SLOT_COUNT; slot++) {
+        Keybindings::Action action = (Keybindings::Action)((int)Keybindings::Action::ApplyPreset1 + slot);
+        LOG_INFO("\t" << Keybindings::GetKeyName(Keybindings::GetKey(action)) << "\t\t\t- Apply tweakable preset " << (slot + 1)
+            << " (save from DevMenu > Presets)");
+    }
     LOG_INFO("");
     LOG_INFO("ACTIONSCRIPT COMMANDS:");
     LOG_INFO("\t" << FullCountdownSequenceKey << "\t\t\t\t- Full countdown sequence (3, 2, 1, GO, Ready!) with auto-timing");
@@ -537,12 +559,14 @@ void HandleT()
     if (shiftPressed && Keybindings::IsActionPressed(Keybindings::Action::ShowSingleCountdown)) {
         std::string keyName = Keybindings::GetKeyName(Keybindings::GetKey(Keybindings::Action::ShowSingleCountdown));
         LOG_VERBOSE("");
-        LOG_VERBOSE("[" << keyName << "] Calling ShowStartCountdownDirect(39)...");
-        if (ActionScript::ShowStartCountdownDirect(39)) {
-            LOG_VERBOSE("[" << keyName << "] Successfully showed countdown value 39");
-        } else {
-            LOG_ERROR("[" << keyName << "] Failed to show countdown");
-        }
+        LOG_VERBOSE("[" << keyName << "] Queueing ShowStartCountdownDirect(39)...");
+        GameThread::Post("ShowStartCountdownDirect", [keyName]() {
+            if (ActionScript::ShowStartCountdownDirect(39)) {
+                LOG_VERBOSE("[" << keyName << "] Successfully showed countdown value 39");
+            } else {
+                LOG_ERROR("[" << keyName << "] Failed to show countdown");
+            }
+        });
         LOG_VERBOSE("");
     }
     // Check for regular T (FullCountdownSequence)
@@ -550,10 +574,20 @@ void HandleT()
         std::string keyName = Keybindings::GetKeyName(Keybindings::GetKey(Keybindings::Action::FullCountdownSequence));
         LOG_VERBOSE("");
         LOG_VERBOSE("[" << keyName << "] Starting full countdown sequence (3, 2, 1, GO)...");
-        if (ActionScript::ShowFullCountdownSequence()) {
-            LOG_VERBOSE("[" << keyName << "] Full countdown sequence completed!");
-        } else {
-            LOG_ERROR("[" << keyName << "] Countdown sequence failed");
+        
+        // Same steps as ActionScript::ShowFullCountdownSequence, but each one is a delayed
+        // game-thread command so the 400 ms gaps never stall a frame
+        static const int COUNTDOWN_VALUES[] = { 5, 2, 1, 0, -1 };
+        static const DWORD COUNTDOWN_STEP_MS = 400;
+        for (int step = 0; step < 5; step++) {
+            int value = COUNTDOWN_VALUES[step];
+            GameThread::Post("ShowStartCountdownDirect", [keyName, value]() {
+                if (!ActionScript::ShowStartCountdownDirect(value)) {
+                    LOG_ERROR("[" << keyName << "] Countdown step " << value << " failed");
+                } else if (value == -1) {
+                    LOG_VERBOSE("[" << keyName << "] Full countdown sequence completed!");
+                }
+            }, step * COUNTDOWN_STEP_MS);
         }
         LOG_VERBOSE("");
     }
@@ -570,12 +604,15 @@ void HandleL()
         
         // Toggle the loading screen state
         loadingScreenVisible = !loadingScreenVisible;
+        bool show = loadingScreenVisible;
         
-        if (ActionScript::ShowLoadingScreen(loadingScreenVisible, "TESTING FROM C++")) {
-            LOG_VERBOSE("[" << keyName << "] Successfully " << (loadingScreenVisible ? "SHOWED" : "HID") << " loading screen");
-        } else {
-            LOG_ERROR("[" << keyName << "] Failed to toggle loading screen");
-        }
+        GameThread::Post("ShowLoadingScreen", [keyName, show]() {
+            if (ActionScript::ShowLoadingScreen(show, "TESTING FROM C++")) {
+                LOG_VERBOSE("[" << keyName << "] Successfully " << (show ? "SHOWED" : "HID") << " loading screen");
+            } else {
+                LOG_ERROR("[" << keyName << "] Failed to toggle loading screen");
+            }
+        });
         
         LOG_VERBOSE("");
     }
@@ -586,12 +623,14 @@ void HandleInstantFinish()
     if (Keybindings::IsActionPressed(Keybindings::Action::InstantFinish)) {
         std::string keyName = Keybindings::GetKeyName(Keybindings::GetKey(Keybindings::Action::InstantFinish));
         LOG_VERBOSE("");
-        LOG_VERBOSE("[" << keyName << "] Calling HandleRaceFinish (proper race finish flow)...");
-        if (ActionScript::CallHandleRaceFinish()) {
-            LOG_VERBOSE("[" << keyName << "] HandleRaceFinish called successfully!");
-        } else {
-            LOG_ERROR("[" << keyName << "] HandleRaceFinish failed");
-        }
+        LOG_VERBOSE("[" << keyName << "] Queueing HandleRaceFinish (proper race finish flow)...");
+        GameThread::Post("CallHandleRaceFinish", [keyName]() {
+            if (ActionScript::CallHandleRaceFinish()) {
+                LOG_VERBOSE("[" << keyName << "] HandleRaceFinish called successfully!");
+            } else {
+                LOG_ERROR("[" << keyName << "] HandleRaceFinish failed");
+            }
+        });
         LOG_VERBOSE("");
     }
 }
@@ -738,6 +777,7 @@ DWORD WINAPI KeyMonitorThread(LPVOID lpParam)
         Camera::CheckHotkey();
         Multiplayer::CheckHotkey();
         BikeSwap::CheckHotkey();
+        TweakablePresets::CheckHotkey();
         
         Sleep(80);
     }
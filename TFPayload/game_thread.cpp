@@ -0,0 +1,160 @@
+#include "pch.h"
+#include "game_thread.h"
+#include "logging.h"
+#include <vector>
+
+namespace GameThread {
+
+    // Commands run per frame before the rest wait for the next one (bounds the frame cost)
+    static const uint32_t MAX_COMMANDS_PER_FRAME = 32;
+
+    // Intrusive MPSC queue (Vyukov): producers swap themselves in at s_head, the render thread
+    // pops from s_tail. s_stub keeps the list non-empty so neither side needs a lock.
+    struct StubCommand : Command {
+        bool Run() override { return true; }
+    };
+
+    static StubCommand s_stub;
+    static std::atomic<Command*> s_head{ &s_stub };
+    static Command* s_tail = &s_stub;
+
+    // Render thread only
+    static std::vector<Command*> s_deferred;
+    static std::atomic<DWORD> s_gameThreadId{ 0 };
+    static bool s_draining = false;
+
+    struct Counters {
+        std::atomic<uint64_t> posted{ 0 };
+        std::atomic<uint64_t> executed{ 0 };
+        std::atomic<uint64_t> failed{ 0 };
+        std::atomic<uint64_t> discarded{ 0 };
+        std::atomic<uint32_t> largestBatch{ 0 };
+        std::atomic<uint32_t> deferred{ 0 };
+    };
+
+    static Counters s_counters;
+
+    static void Push(Command* command) {
+        command->next.store(nullptr, std::memory_order_relaxed);
+        Command* previous = s_head.exchange(command, std::memory_order_acq_rel);
+        previous->next.store(command, std::memory_order_release);
+    }
+
+    // Returns nullptr when empty, or when a producer is between its exchange and its link
+    // (that command shows up on the next call)
+    static Command* Pop() {
+        Command* tail = s_tail;
+        Command* next = tail->next.load(std::memory_order_acquire);
+        if (tail == &s_stub) {
+            if (!next) return nullptr;
+            s_tail = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+        if (next) {
+            s_tail = next;
+            return tail;
+        }
+        if (tail != s_head.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        Push(&s_stub);
+        next = tail->next.load(std::memory_order_acquire);
+        if (next) {
+            s_tail = next;
+            return tail;
+        }
+        return nullptr;
+    }
+
+    static bool IsDue(const Command* command, DWORD now) {
+        return command->dueTick == 0 || (int32_t)(now - command->dueTick) >= 0;
+    }
+
+    static void Execute(Command* command) {
+        if (command->Run()) {
+            s_counters.executed.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            s_counters.failed.fetch_add(1, std::memory_order_relaxed);
+            LOG_ERROR("[GameThread] Command '" << command->name << "' threw an exception");
+        }
+        delete command;
+    }
+
+    // ============================================================================
+    // Public API
+    // ============================================================================
+
+    void Enqueue(Command* command) {
+        s_counters.posted.fetch_add(1, std::memory_order_relaxed);
+        Push(command);
+    }
+
+    void Drain() {
+        s_gameThreadId.store(GetCurrentThreadId(), std::memory_order_relaxed);
+        s_draining = true;
+        DWORD now = GetTickCount();
+        uint32_t ran = 0;
+
+        // Delayed commands first - they were posted before anything still in the queue
+        for (size_t i = 0; i < s_deferred.size() && ran < MAX_COMMANDS_PER_FRAME; ) {
+            if (IsDue(s_deferred[i], now)) {
+                Command* command = s_deferred[i];
+                s_deferred.erase(s_deferred.begin() + i);
+                Execute(command);
+                ran++;
+            } else {
+                i++;
+            }
+        }
+
+        while (ran < MAX_COMMANDS_PER_FRAME) {
+            Command* command = Pop();
+            if (!command) break;
+            if (!IsDue(command, now)) {
+                s_deferred.push_back(command);
+                continue;
+            }
+            Execute(command);
+            ran++;
+        }
+
+        s_draining = false;
+        s_counters.deferred.store((uint32_t)s_deferred.size(), std::memory_order_relaxed);
+        if (ran > s_counters.largestBatch.load(std::memory_order_relaxed)) {
+            s_counters.largestBatch.store(ran, std::memory_order_relaxed);
+        }
+    }
+
+    bool IsGameThread() {
+        return s_draining && s_gameThreadId.load(std::memory_order_relaxed) == GetCurrentThreadId();
+    }
+
+    void Shutdown() {
+        uint64_t discarded = s_deferred.size();
+        for (Command* command : s_deferred) {
+            delete command;
+        }
+        s_deferred.clear();
+        while (Command* command = Pop()) {
+            delete command;
+            discarded++;
+        }
+        if (discarded > 0) {
+            s_counters.discarded.fetch_add(discarded, std::memory_order_relaxed);
+            LOG_VERBOSE("[GameThread] Discarded " << discarded << " queued commands");
+        }
+    }
+
+    Stats GetStats() {
+        Stats stats;
+        stats.posted = s_counters.posted.load(std::memory_order_relaxed);
+        stats.executed = s_counters.executed.load(std::memory_order_relaxed);
+        stats.failed = s_counters.failed.load(std::memory_order_relaxed);
+        stats.discarded = s_counters.discarded.load(std::memory_order_relaxed);
+        stats.largestBatch = s_counters.largestBatch.load(std::memory_order_relaxed);
+        stats.deferred = s_counters.deferred.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+} // namespace GameThread
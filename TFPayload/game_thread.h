@@ -0,0 +1,98 @@
+#pragma once
+#include <Windows.h>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <utility>
+
+// Commands that must run on the game's render thread
+// Hotkeys (KeyMonitorThread) and DevMenu callbacks Post() their engine calls here instead of
+// calling into the game directly. Producers push onto a lock-free intrusive MPSC queue and get a
+// std::future back immediately; Drain() runs at the top of every rendered frame and executes
+// the queued commands as one batch, so engine calls never race the game's own update.
+
+namespace GameThread {
+
+    struct Command {
+        std::atomic<Command*> next{ nullptr };
+        const char* name = "";
+        DWORD dueTick = 0;                  // GetTickCount() value to wait for (0 = next frame)
+
+        virtual ~Command() {}
+
+        // Returns false if the command threw (the exception is stored in its future)
+        virtual bool Run() = 0;
+    };
+
+    struct Stats {
+        uint64_t posted = 0;
+        uint64_t executed = 0;
+        uint64_t failed = 0;                // Threw an exception
+        uint64_t discarded = 0;             // Still queued at Shutdown()
+        uint32_t largestBatch = 0;          // Most commands run in a single frame
+        uint32_t deferred = 0;              // Waiting for their delay to pass
+    };
+
+    // Any thread - lock-free, never blocks
+    void Enqueue(Command* command);
+
+    // Render thread, once per frame - runs every command that is due (up to a per-frame cap)
+    void Drain();
+
+    // True when called from inside Drain() (the thread engine calls are safe on)
+    bool IsGameThread();
+
+    // Delete every queued command without running it; their futures report broken_promise
+    void Shutdown();
+
+    Stats GetStats();
+
+    namespace Detail {
+        template <typename R, typename Fn>
+        void Fulfil(std::promise<R>& promise, Fn& fn) {
+            promise.set_value(fn());
+        }
+
+        template <typename Fn>
+        void Fulfil(std::promise<void>& promise, Fn& fn) {
+            fn();
+            promise.set_value();
+        }
+
+        template <typename R, typename Fn>
+        struct Task : Command {
+            Fn fn;
+            std::promise<R> promise;
+
+            explicit Task(Fn&& function) : fn(std::move(function)) {}
+
+            bool Run() override {
+                try {
+                    Fulfil(promise, fn);
+                    return true;
+                } catch (...) {
+                    promise.set_exception(std::current_exception());
+                    return false;
+                }
+            }
+        };
+    }
+
+    // Queue fn() for the next frame (or the first frame after delayMs). The caller never waits;
+    // the returned future becomes ready once the command has run on the game thread.
+    template <typename Fn>
+    auto Post(const char* name, Fn fn, DWORD delayMs = 0) -> std::future<decltype(fn())> {
+        typedef decltype(fn()) Result;
+        auto* task = new Detail::Task<Result, Fn>(std::move(fn));
+        task->name = name;
+        if (delayMs > 0) {
+            task->dueTick = GetTickCount() + delayMs;
+            if (task->dueTick == 0) task->dueTick = 1;
+        }
+        std::future<Result> future = task->promise.get_future();
+        Enqueue(task);
+        return future;
+    }
+
+} // namespace GameThread
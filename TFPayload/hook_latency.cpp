@@ -0,0 +1,83 @@
+#include "pch.h"
+#include "hook_latency.h"
+#include <Windows.h>
+
+namespace HookLatency {
+
+    static uint64_t s_baseTsc = 0;
+    static LARGE_INTEGER s_baseQpc = {};
+    static LARGE_INTEGER s_qpcFrequency = {};
+    static std::atomic<double> s_ticksPerMicro{ 0.0 };
+
+    // Below this the QPC interval is too short to trust; use a rough estimate instead
+    static const double MIN_CALIBRATION_SECONDS = 0.05;
+    static const double FALLBACK_TICKS_PER_MICRO = 3000.0;
+
+    void Calibrate() {
+        QueryPerformanceFrequency(&s_qpcFrequency);
+        QueryPerformanceCounter(&s_baseQpc);
+        s_baseTsc = ReadTsc();
+    }
+
+    double TicksPerMicro() {
+        if (s_qpcFrequency.QuadPart == 0) Calibrate();
+
+        LARGE_INTEGER qpc;
+        QueryPerformanceCounter(&qpc);
+        uint64_t tsc = ReadTsc();
+        double seconds = (double)(qpc.QuadPart - s_baseQpc.QuadPart) / (double)s_qpcFrequency.QuadPart;
+        if (seconds < MIN_CALIBRATION_SECONDS) {
+            double known = s_ticksPerMicro.load(std::memory_order_relaxed);
+            return known > 0.0 ? known : FALLBACK_TICKS_PER_MICRO;
+        }
+
+        double ticksPerMicro = (double)(tsc - s_baseTsc) / (seconds * 1e6);
+        s_ticksPerMicro.store(ticksPerMicro, std::memory_order_relaxed);
+        return ticksPerMicro;
+    }
+
+    Summary Histogram::Summarize() const {
+        Summary summary;
+
+        // Snapshot the buckets first so the percentiles agree with each other
+        uint32_t counts[BUCKET_COUNT];
+        uint64_t total = 0;
+        for (int i = 0; i < BUCKET_COUNT; i++) {
+            counts[i] = m_counts[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+        if (total == 0) return summary;
+
+        double ticksPerMicro = TicksPerMicro();
+        summary.count = total;
+        summary.meanUs = m_sum.load(std::memory_order_relaxed) / (double)m_count.load(std::memory_order_relaxed) / ticksPerMicro;
+        summary.maxUs = m_max.load(std::memory_order_relaxed) / ticksPerMicro;
+
+        const double fractions[4] = { 0.50, 0.90, 0.99, 0.999 };
+        double* outputs[4] = { &summary.p50Us, &summary.p90Us, &summary.p99Us, &summary.p999Us };
+        int next = 0;
+        uint64_t seen = 0;
+        for (int i = 0; i < BUCKET_COUNT && next < 4; i++) {
+            seen += counts[i];
+            while (next < 4 && seen >= (uint64_t)(fractions[next] * total + 0.5)) {
+                // Report the middle of the bucket, but never above the recorded maximum
+                double value = (BucketLower(i) + BucketWidth(i) / 2.0) / ticksPerMicro;
+                *outputs[next++] = value < summary.maxUs ? value : summary.maxUs;
+            }
+        }
+        return summary;
+    }
+
+    void Histogram::WriteCsv(std::ostream& out, const char* name) const {
+        double ticksPerMicro = TicksPerMicro();
+        for (int i = 0; i < BUCKET_COUNT; i++) {
+            uint32_t count = m_counts[i].load(std::memory_order_relaxed);
+            if (count == 0) continue;
+            out << name << ","
+                << BucketLower(i) / ticksPerMicro << ","
+                << (BucketLower(i) + BucketWidth(i)) / ticksPerMicro << ","
+                << count << "\n";
+        }
+    }
+
+} // namespace HookLatency
@@ -0,0 +1,130 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+// Lock-free latency histograms for timing hooked game functions
+// Durations are raw TSC ticks recorded into log-linear buckets (32 linear steps per power of
+// two, so any value is within ~3% of its bucket), HDR-histogram style. Record() is a handful
+// of relaxed atomic adds and never blocks; readers take a snapshot and compute percentiles.
+
+namespace HookLatency {
+
+    inline uint64_t ReadTsc() {
+        return __rdtsc();
+    }
+
+    // Record the TSC/QPC pair the tick rate is measured against (call once at startup)
+    void Calibrate();
+
+    // TSC ticks per microsecond, refined every call from the time elapsed since Calibrate()
+    double TicksPerMicro();
+
+    inline double TicksToMicros(uint64_t ticks) {
+        return ticks / TicksPerMicro();
+    }
+
+    struct Summary {
+        uint64_t count = 0;
+        double meanUs = 0.0;
+        double p50Us = 0.0;
+        double p90Us = 0.0;
+        double p99Us = 0.0;
+        double p999Us = 0.0;
+        double maxUs = 0.0;
+    };
+
+    class Histogram {
+    public:
+        static const int SUB_BITS = 5;                          // 32 buckets per power of two
+        static const int SUB_COUNT = 1 << SUB_BITS;
+        static const int MAX_BIT = 47;                          // ~13 hours at 3 GHz
+        static const int BUCKET_COUNT = (MAX_BIT - SUB_BITS + 2) * SUB_COUNT;
+
+        Histogram() {
+            Reset();
+        }
+
+        void Record(uint64_t ticks) {
+            m_counts[BucketIndex(ticks)].fetch_add(1, std::memory_order_relaxed);
+            m_count.fetch_add(1, std::memory_order_relaxed);
+            m_sum.fetch_add(ticks, std::memory_order_relaxed);
+            RaiseTo(m_max, ticks);
+            RaiseTo(m_recentMax, ticks);
+        }
+
+        // Largest value since the previous call (for per-frame / per-interval readouts)
+        uint64_t TakeRecentMax() {
+            return m_recentMax.exchange(0, std::memory_order_relaxed);
+        }
+
+        uint64_t GetCount() const {
+            return m_count.load(std::memory_order_relaxed);
+        }
+
+        // Not atomic with respect to concurrent Record() calls - a few samples may straddle it
+        void Reset() {
+            for (int i = 0; i < BUCKET_COUNT; i++) {
+                m_counts[i].store(0, std::memory_order_relaxed);
+            }
+            m_count.store(0, std::memory_order_relaxed);
+            m_sum.store(0, std::memory_order_relaxed);
+            m_max.store(0, std::memory_order_relaxed);
+            m_recentMax.store(0, std::memory_order_relaxed);
+        }
+
+        Summary Summarize() const;
+
+        // "LowerUs,UpperUs,Count" for every non-empty bucket
+        void WriteCsv(std::ostream& out, const char* name) const;
+
+        static int BucketIndex(uint64_t ticks) {
+            if (ticks < 2 * SUB_COUNT) return (int)ticks;
+            int bit = HighestBit(ticks);
+            if (bit > MAX_BIT) return BUCKET_COUNT - 1;
+            int shift = bit - SUB_BITS;
+            return (shift + 1) * SUB_COUNT + (int)((ticks >> shift) - SUB_COUNT);
+        }
+
+        static uint64_t BucketLower(int index) {
+            if (index < 2 * SUB_COUNT) return (uint64_t)index;
+            int shift = index / SUB_COUNT - 1;
+            return (uint64_t)(index % SUB_COUNT + SUB_COUNT) << shift;
+        }
+
+        static uint64_t BucketWidth(int index) {
+            return index < 2 * SUB_COUNT ? 1 : 1ULL << (index / SUB_COUNT - 1);
+        }
+
+    private:
+        static int HighestBit(uint64_t value) {
+#ifdef _MSC_VER
+            unsigned long bit;
+            if (_BitScanReverse(&bit, (unsigned long)(value >> 32))) return (int)bit + 32;
+            _BitScanReverse(&bit, (unsigned long)value);
+            return (int)bit;
+#else
+            return 63 - __builtin_clzll(value);
+#endif
+        }
+
+        static void RaiseTo(std::atomic<uint64_t>& target, uint64_t value) {
+            uint64_t current = target.load(std::memory_order_relaxed);
+            while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            }
+        }
+
+        std::atomic<uint32_t> m_counts[BUCKET_COUNT];
+        std::atomic<uint64_t> m_count;
+        std::atomic<uint64_t> m_sum;
+        std::atomic<uint64_t> m_max;
+        std::atomic<uint64_t> m_recentMax;
+    };
+
+} // namespace HookLatency
@@ -2,12 +2,28 @@
 #include "keybindings.h"
 #include "logging.h"
 #include <fstream>
+#include <mutex>
 #include <sstream>
 
 // Static member initialization
 std::unordered_map<Keybindings::Action, int> Keybindings::s_keybindings;
 std::unordered_map<Keybindings::Action, bool> Keybindings::s_keyStates;
 bool Keybindings::s_initialized = false;
+std::atomic<uint32_t> Keybindings::s_generation{ 0 };
+std::string Keybindings::s_outputDirectory = "F:/";
+static std::mutex s_outputDirectoryMutex;      // Set from the DevMenu, read by the writers' owners
+
+static const char* OUTPUT_DIRECTORY_KEY = "Output Directory";
+
+// Trimmed, with a trailing slash unless empty
+static std::string NormalizeDirectory(std::string directory) {
+    directory.erase(0, directory.find_first_not_of(" \t"));
+    directory.erase(directory.find_last_not_of(" \t") + 1);
+    if (!directory.empty() && directory.back() != '/' && directory.back() != '\\') {
+        directory += '/';
+    }
+    return directory;
+}
 
 void Keybindings::Initialize() {
     if (s_initialized) {
@@ -79,6 +95,12 @@ void Keybindings::Initialize() {
     // Keybindings Menu
     s_keybindings[Action::ToggleKeybindingsMenu] = 'K';  // K key
     
+    // Tweakable presets
+    s_keybindings[Action::ApplyPreset1] = VK_NUMPAD1;  // Numpad 1
+    s_keybindings[Action::ApplyPreset2] = VK_NUMPAD2;  // Numpad 2
+    s_keybindings[Action::ApplyPreset3] = VK_NUMPAD3;  // Numpad 3
+    s_keybindings[Action::ApplyPreset4] = VK_NUMPAD4;  // Numpad 4
+    
     // Initialize key states
     s_keyStates[Action::InstantFinish] = false;
     s_keyStates[Action::ToggleDevMenu] = false;
@@ -119,6 +141,10 @@ void Keybindings::Initialize() {
     s_keyStates[Action::ShowSingleCountdown] = false;
     s_keyStates[Action::ToggleLoadScreen] = false;
     s_keyStates[Action::ToggleKeybindingsMenu] = false;
+    s_keyStates[Action::ApplyPreset1] = false;
+    s_keyStates[Action::ApplyPreset2] = false;
+    s_keyStates[Action::ApplyPreset3] = false;
+    s_keyStates[Action::ApplyPreset4] = false;
     
     // Try to load from file
     if (!LoadFromFile()) {
@@ -153,8 +179,25 @@ int Keybindings::GetKey(Action action) {
     return 0; // No key bound
 }
 
+std::string Keybindings::GetOutputDirectory() {
+    std::lock_guard<std::mutex> lock(s_outputDirectoryMutex);
+    return s_outputDirectory;
+}
+
+void Keybindings::SetOutputDirectory(const std::string& directory) {
+    std::string normalized = NormalizeDirectory(directory);
+    {
+        std::lock_guard<std::mutex> lock(s_outputDirectoryMutex);
+        if (normalized == s_outputDirectory) return;
+        s_outputDirectory = normalized;
+    }
+    SaveToFile();
+    LOG_VERBOSE("[Keybindings] Output directory set to " << (normalized.empty() ? "(working directory)" : normalized));
+}
+
 void Keybindings::SetKey(Action action, int vkCode) {
     s_keybindings[action] = vkCode;
+    s_generation.fetch_add(1, std::memory_order_release);
     SaveToFile();
     LOG_VERBOSE("[Keybindings] Set " << GetActionName(action) << " to " << GetKeyName(vkCode));
 }
@@ -340,6 +383,15 @@ std::string Keybindings::GetActionName(Action action) {
             return "Toggle Load Screen";
         case Action::ToggleKeybindingsMenu:
             return "Toggle Keybindings Menu";
+        // Tweakable presets
+        case Action::ApplyPreset1:
+            return "Apply Preset 1";
+        case Action::ApplyPreset2:
+            return "Apply Preset 2";
+        case Action::ApplyPreset3:
+            return "Apply Preset 3";
+        case Action::ApplyPreset4:
+            return "Apply Preset 4";
         default:
             return "Unknown Action";
     }
@@ -363,6 +415,10 @@ bool Keybindings::SaveToFile() {
         file << GetActionName(pair.first) << "=" << pair.second << " # " << GetKeyName(pair.second) << std::endl;
     }
     
+    file << std::endl;
+    file << "# Where multiplayer logs and leaderboard scans are written (empty = game directory)" << std::endl;
+    file << OUTPUT_DIRECTORY_KEY << "=" << GetOutputDirectory() << std::endl;
+    
     file.close();
     LOG_VERBOSE("[Keybindings] Saved keybindings to: " << configPath);
     return true;
@@ -392,6 +448,13 @@ bool Keybindings::LoadFromFile() {
         std::string actionName = line.substr(0, equalsPos);
         std::string vkCodeStr = line.substr(equalsPos + 1);
         
+        // Not a binding - the value is a path, which may contain '#'
+        if (actionName == OUTPUT_DIRECTORY_KEY) {
+            std::lock_guard<std::mutex> lock(s_outputDirectoryMutex);
+            s_outputDirectory = NormalizeDirectory(vkCodeStr);
+            continue;
+        }
+        
         // Remove any comments after the value
         size_t commentPos = vkCodeStr.find('#');
         if (commentPos != std::string::npos) {
@@ -491,6 +554,15 @@ bool Keybindings::LoadFromFile() {
                 s_keybindings[Action::ToggleLoadScreen] = vkCode;
             } else if (actionName == "Toggle Keybindings Menu") {
                 s_keybindings[Action::ToggleKeybindingsMenu] = vkCode;
+            // Tweakable presets
+            } else if (actionName == "Apply Preset 1") {
+                s_keybindings[Action::ApplyPreset1] = vkCode;
+            } else if (actionName == "Apply Preset 2") {
+                s_keybindings[Action::ApplyPreset2] = vkCode;
+            } else if (actionName == "Apply Preset 3") {
+                s_keybindings[Action::ApplyPreset3] = vkCode;
+            } else if (actionName == "Apply Preset 4") {
+                s_keybindings[Action::ApplyPreset4] = vkCode;
             }
         } catch (const std::exception& e) {
             LOG_WARNING("[Keybindings] Failed to parse line: " << line << ": " << e.what());
@@ -498,6 +570,7 @@ bool Keybindings::LoadFromFile() {
     }
     
     file.close();
+    s_generation.fetch_add(1, std::memory_order_release);
     return true;
 }
 
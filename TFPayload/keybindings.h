@@ -1,6 +1,8 @@
 #pragma once
 
 #include <Windows.h>
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 
@@ -51,6 +53,10 @@ public:
         ShowSingleCountdown,
         ToggleLoadScreen,
         ToggleKeybindingsMenu,
+        ApplyPreset1,
+        ApplyPreset2,
+        ApplyPreset3,
+        ApplyPreset4,
     };
 
     static void Initialize();
@@ -79,9 +85,19 @@ public:
     
     // Get config file path
     static std::string GetConfigPath();
+    
+    // Directory the multiplayer logs and leaderboard scans are written to ("Output Directory="
+    // in the config file), with a trailing slash, or empty for the working directory. Any thread
+    static std::string GetOutputDirectory();
+    static void SetOutputDirectory(const std::string& directory);
+    
+    // Bumped whenever SetKey or LoadFromFile changes a binding (for cached UI)
+    static uint32_t GetGeneration() { return s_generation.load(std::memory_order_acquire); }
 
 private:
     static std::unordered_map<Action, int> s_keybindings;
     static std::unordered_map<Action, bool> s_keyStates;
     static bool s_initialized;
+    static std::atomic<uint32_t> s_generation;
+    static std::string s_outputDirectory;
 };
@@ -0,0 +1,470 @@
+#include "pch.h"
+#include "leaderboard_analytics.h"
+#include "logging.h"
+#include <emmintrin.h>
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <iomanip>
+#include <mutex>
+
+namespace LeaderboardAnalytics {
+
+    using LeaderboardScanner::LeaderboardEntry;
+
+    // Column storage, reused between runs so a refresh doesn't reallocate
+    struct Columns {
+        std::vector<int32_t> timeMs;
+        std::vector<int32_t> faults;
+        std::vector<int32_t> medal;
+    };
+
+    static Columns s_columns;
+    static std::vector<uint32_t> s_laneCounts;
+    static std::vector<uint32_t> s_selectCounts;
+
+    static const int SELECT_BUCKETS = 4096;
+    static const int MAX_RANKS = 5;
+    static std::vector<int32_t> s_rankScratch[MAX_RANKS];
+
+    static std::mutex s_scratchMutex;                   // Columns and scratch above; Analyze runs on the render and hotkey threads
+    static std::mutex s_reportMutex;
+    static Report s_report;
+    static uint32_t s_generation = 0;
+
+    // ============================================================================
+    // SSE2 kernels
+    // ============================================================================
+
+    // mask ? a : b (SSE2 has no blend)
+    static inline __m128i Select(__m128i mask, __m128i a, __m128i b) {
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+
+    // Sign-extend four int32 lanes and add them to two int64 lanes
+    static inline __m128i AddWiden(__m128i sum, __m128i x) {
+        __m128i sign = _mm_srai_epi32(x, 31);
+        sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(x, sign));
+        return _mm_add_epi64(sum, _mm_unpackhi_epi32(x, sign));
+    }
+
+    static int64_t ReduceSum64(__m128i sum) {
+        int64_t lanes[2];
+        _mm_storeu_si128((__m128i*)lanes, sum);
+        return lanes[0] + lanes[1];
+    }
+
+    static void MinMaxSum(const int32_t* v, size_t n, int& outMin, int& outMax, int64_t& outSum) {
+        int minValue = INT_MAX;
+        int maxValue = INT_MIN;
+        int64_t sum = 0;
+        size_t i = 0;
+
+        if (n >= 4) {
+            __m128i vmin = _mm_loadu_si128((const __m128i*)v);
+            __m128i vmax = vmin;
+            __m128i vsum = _mm_setzero_si128();
+
+            for (; i + 4 <= n; i += 4) {
+                __m128i x = _mm_loadu_si128((const __m128i*)(v + i));
+                vmin = Select(_mm_cmplt_epi32(x, vmin), x, vmin);
+                vmax = Select(_mm_cmpgt_epi32(x, vmax), x, vmax);
+                vsum = AddWiden(vsum, x);
+            }
+
+            int32_t lanesMin[4], lanesMax[4];
+            _mm_storeu_si128((__m128i*)lanesMin, vmin);
+            _mm_storeu_si128((__m128i*)lanesMax, vmax);
+            for (int lane = 0; lane < 4; lane++) {
+                minValue = (std::min)(minValue, lanesMin[lane]);
+                maxValue = (std::max)(maxValue, lanesMax[lane]);
+            }
+            sum = ReduceSum64(vsum);
+        }
+
+        for (; i < n; i++) {
+            minValue = (std::min)(minValue, v[i]);
+            maxValue = (std::max)(maxValue, v[i]);
+            sum += v[i];
+        }
+
+        outMin = minValue;
+        outMax = maxValue;
+        outSum = sum;
+    }
+
+    // Bucket indices are computed four at a time; each lane increments its own copy of the
+    // histogram so neighbouring equal values don't serialise on the same counter
+    static void BuildHistogram(const int32_t* v, size_t n, int minValue, int maxValue, int buckets, Histogram& out) {
+        int64_t range = (int64_t)maxValue - minValue + 1;
+        int width = (int)(std::max)((int64_t)1, (range + buckets - 1) / buckets);
+
+        out.minValue = minValue;
+        out.bucketWidth = width;
+        out.counts.assign(buckets, 0);
+
+        s_laneCounts.assign((size_t)buckets * 4, 0);
+        uint32_t* lanes = s_laneCounts.data();
+
+        const __m128i vmin = _mm_set1_epi32(minValue);
+        const __m128i vzero = _mm_setzero_si128();
+        const __m128i vlast = _mm_set1_epi32(buckets - 1);
+        const __m128i vsign = _mm_set1_epi32(INT_MIN);
+        const __m128 vbias = _mm_set1_ps(2147483648.0f);
+        const __m128 vinv = _mm_set1_ps(1.0f / (float)width);
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            // v - minValue can exceed INT_MAX, so take it as unsigned: flip the sign bit to
+            // convert it as a signed value, then add 2^31 back in float
+            __m128i x = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(v + i)), vmin);
+            __m128 offset = _mm_add_ps(_mm_cvtepi32_ps(_mm_xor_si128(x, vsign)), vbias);
+            __m128i idx = _mm_cvttps_epi32(_mm_mul_ps(offset, vinv));
+            idx = Select(_mm_cmplt_epi32(idx, vzero), vzero, idx);
+            idx = Select(_mm_cmpgt_epi32(idx, vlast), vlast, idx);
+
+            int32_t bucket[4];
+            _mm_storeu_si128((__m128i*)bucket, idx);
+            lanes[bucket[0]]++;
+            lanes[buckets + bucket[1]]++;
+            lanes[buckets * 2 + bucket[2]]++;
+            lanes[buckets * 3 + bucket[3]]++;
+        }
+
+        for (; i < n; i++) {
+            int64_t bucket = ((int64_t)v[i] - minValue) / width;
+            lanes[(std::max)((int64_t)0, (std::min)(bucket, (int64_t)buckets - 1))]++;
+        }
+
+        for (int b = 0; b < buckets; b++) {
+            out.counts[b] = lanes[b] + lanes[buckets + b] + lanes[buckets * 2 + b] + lanes[buckets * 3 + b];
+        }
+    }
+
+    static void CountMedals(const int32_t* v, size_t n, int counts[5]) {
+        __m128i acc[4];
+        for (int m = 0; m < 4; m++) acc[m] = _mm_setzero_si128();
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m128i x = _mm_loadu_si128((const __m128i*)(v + i));
+            // cmpeq yields -1 per matching lane
+            for (int m = 0; m < 4; m++) {
+                acc[m] = _mm_sub_epi32(acc[m], _mm_cmpeq_epi32(x, _mm_set1_epi32(m)));
+            }
+        }
+
+        int known = 0;
+        for (int m = 0; m < 4; m++) {
+            int32_t lanes[4];
+            _mm_storeu_si128((__m128i*)lanes, acc[m]);
+            counts[m] = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        }
+        for (; i < n; i++) {
+            if (v[i] >= 0 && v[i] < 4) counts[v[i]]++;
+        }
+        for (int m = 0; m < 4; m++) known += counts[m];
+        counts[4] = (int)n - known;
+    }
+
+    // Gaps between entry i and i+1 where both have the same fault count
+    static void RankGaps(const int32_t* t, const int32_t* f, size_t n, int& outMaxGap, size_t& outMaxIndex, double& outMeanGap) {
+        int maxGap = 0;
+        int64_t sum = 0;
+        int64_t pairs = 0;
+        size_t i = 0;
+
+        if (n >= 5) {
+            __m128i vmax = _mm_setzero_si128();
+            __m128i vsum = _mm_setzero_si128();
+            __m128i vcount = _mm_setzero_si128();
+
+            for (; i + 5 <= n; i += 4) {
+                __m128i t0 = _mm_loadu_si128((const __m128i*)(t + i));
+                __m128i t1 = _mm_loadu_si128((const __m128i*)(t + i + 1));
+                __m128i f0 = _mm_loadu_si128((const __m128i*)(f + i));
+                __m128i f1 = _mm_loadu_si128((const __m128i*)(f + i + 1));
+
+                __m128i same = _mm_cmpeq_epi32(f0, f1);
+                __m128i gap = _mm_and_si128(_mm_sub_epi32(t1, t0), same);
+                vmax = Select(_mm_cmpgt_epi32(gap, vmax), gap, vmax);
+                vsum = AddWiden(vsum, gap);
+                vcount = _mm_sub_epi32(vcount, same);
+            }
+
+            int32_t lanesMax[4], lanesCount[4];
+            _mm_storeu_si128((__m128i*)lanesMax, vmax);
+            _mm_storeu_si128((__m128i*)lanesCount, vcount);
+            for (int lane = 0; lane < 4; lane++) {
+                maxGap = (std::max)(maxGap, lanesMax[lane]);
+                pairs += lanesCount[lane];
+            }
+            sum = ReduceSum64(vsum);
+        }
+
+        for (; i + 1 < n; i++) {
+            if (f[i] != f[i + 1]) continue;
+            int gap = t[i + 1] - t[i];
+            maxGap = (std::max)(maxGap, gap);
+            sum += gap;
+            pairs++;
+        }
+
+        // Locating the max is a cheap scalar pass once its value is known
+        outMaxIndex = 0;
+        for (size_t j = 0; j + 1 < n; j++) {
+            if (f[j] == f[j + 1] && t[j + 1] - t[j] == maxGap) {
+                outMaxIndex = j;
+                break;
+            }
+        }
+
+        outMaxGap = maxGap;
+        outMeanGap = pairs > 0 ? (double)sum / (double)pairs : 0.0;
+    }
+
+    static void FindOutliers(const int32_t* t, size_t n, int fence, std::vector<int>& out) {
+        out.clear();
+        const __m128i vfence = _mm_set1_epi32(fence);
+        const __m128i vone = _mm_set1_epi32(1);
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m128i x = _mm_loadu_si128((const __m128i*)(t + i));
+            __m128i hit = _mm_or_si128(_mm_cmplt_epi32(x, vfence), _mm_cmplt_epi32(x, vone));
+            int bits = _mm_movemask_ps(_mm_castsi128_ps(hit));
+            if (!bits) continue;
+            for (int lane = 0; lane < 4; lane++) {
+                if (bits & (1 << lane)) out.push_back((int)(i + lane));
+            }
+        }
+        for (; i < n; i++) {
+            if (t[i] < fence || t[i] < 1) out.push_back((int)i);
+        }
+    }
+
+    // Exact percentiles without sorting the column: count values into coarse buckets by
+    // shifting off low bits, then select only among the values in the bucket holding each rank
+    static void Percentiles(const int32_t* v, size_t n, int minValue, int maxValue,
+                            const double* ranks, int* out, int count) {
+        uint32_t range = (uint32_t)((int64_t)maxValue - minValue);
+        int shift = 0;
+        while ((range >> shift) >= (uint32_t)SELECT_BUCKETS) shift++;
+
+        s_selectCounts.assign(SELECT_BUCKETS * 4, 0);
+        uint32_t* lanes = s_selectCounts.data();
+
+        const __m128i vmin = _mm_set1_epi32(minValue);
+        const __m128i vshift = _mm_cvtsi32_si128(shift);
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            // Offsets are treated as unsigned, so the full int range fits after the subtract
+            __m128i x = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(v + i)), vmin);
+            int32_t bucket[4];
+            _mm_storeu_si128((__m128i*)bucket, _mm_srl_epi32(x, vshift));
+            lanes[bucket[0]]++;
+            lanes[SELECT_BUCKETS + bucket[1]]++;
+            lanes[SELECT_BUCKETS * 2 + bucket[2]]++;
+            lanes[SELECT_BUCKETS * 3 + bucket[3]]++;
+        }
+        for (; i < n; i++) {
+            lanes[((uint32_t)v[i] - (uint32_t)minValue) >> shift]++;
+        }
+        for (int b = 0; b < SELECT_BUCKETS; b++) {
+            lanes[b] += lanes[SELECT_BUCKETS + b] + lanes[SELECT_BUCKETS * 2 + b] + lanes[SELECT_BUCKETS * 3 + b];
+        }
+
+        // Locate the bucket and in-bucket offset of every requested rank
+        int bucketOf[MAX_RANKS];
+        size_t offsetOf[MAX_RANKS];
+        for (int r = 0; r < count; r++) {
+            size_t target = (size_t)(ranks[r] * (n - 1));
+            size_t below = 0;
+            int bucket = 0;
+            while (below + lanes[bucket] <= target) {
+                below += lanes[bucket];
+                bucket++;
+            }
+            bucketOf[r] = bucket;
+            offsetOf[r] = target - below;
+        }
+
+        // Unshifted buckets hold a single value each, so the counts alone are exact
+        if (shift == 0) {
+            for (int r = 0; r < count; r++) out[r] = minValue + bucketOf[r];
+            return;
+        }
+
+        // One gather pass for all ranks, then select within each small bucket
+        for (int r = 0; r < count; r++) s_rankScratch[r].clear();
+        for (size_t j = 0; j < n; j++) {
+            int bucket = (int)(((uint32_t)v[j] - (uint32_t)minValue) >> shift);
+            for (int r = 0; r < count; r++) {
+                if (bucket == bucketOf[r]) s_rankScratch[r].push_back(v[j]);
+            }
+        }
+        for (int r = 0; r < count; r++) {
+            std::vector<int32_t>& values = s_rankScratch[r];
+            std::nth_element(values.begin(), values.begin() + offsetOf[r], values.end());
+            out[r] = values[offsetOf[r]];
+        }
+    }
+
+    // ============================================================================
+    // Analysis
+    // ============================================================================
+
+    // Min/max/mean plus p10, quartiles, median and p90 in one percentile pass
+    static void FillColumnStats(const std::vector<int32_t>& column, ColumnStats& stats, int& q1, int& q3) {
+        int64_t sum = 0;
+        MinMaxSum(column.data(), column.size(), stats.minValue, stats.maxValue, sum);
+        stats.mean = (double)sum / (double)column.size();
+
+        const double ranks[MAX_RANKS] = { 0.10, 0.25, 0.50, 0.75, 0.90 };
+        int values[MAX_RANKS];
+        Percentiles(column.data(), column.size(), stats.minValue, stats.maxValue, ranks, values, MAX_RANKS);
+        stats.p10 = values[0];
+        q1 = values[1];
+        stats.median = values[2];
+        q3 = values[3];
+        stats.p90 = values[4];
+    }
+
+    Report Analyze(const std::vector<LeaderboardEntry>& entries, int buckets) {
+        Report report;
+        if (entries.empty()) return report;
+        if (buckets < 1) buckets = 1;
+
+        std::lock_guard<std::mutex> lock(s_scratchMutex);
+        auto start = std::chrono::steady_clock::now();
+
+        size_t n = entries.size();
+        s_columns.timeMs.resize(n);
+        s_columns.faults.resize(n);
+        s_columns.medal.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            s_columns.timeMs[i] = entries[i].timeMs;
+            s_columns.faults[i] = entries[i].faults;
+            s_columns.medal[i] = entries[i].medal;
+        }
+
+        const int32_t* timeMs = s_columns.timeMs.data();
+        const int32_t* faults = s_columns.faults.data();
+
+        report.entryCount = n;
+        int q1 = 0, q3 = 0, unused = 0;
+        FillColumnStats(s_columns.timeMs, report.time, q1, q3);
+        FillColumnStats(s_columns.faults, report.faults, unused, unused);
+
+        BuildHistogram(timeMs, n, report.time.minValue, report.time.maxValue, buckets, report.timeHistogram);
+        int faultBuckets = (std::min)(buckets, report.faults.maxValue - report.faults.minValue + 1);
+        BuildHistogram(faults, n, report.faults.minValue, report.faults.maxValue, faultBuckets, report.faultHistogram);
+
+        CountMedals(s_columns.medal.data(), n, report.medalCounts);
+
+        size_t maxGapIndex = 0;
+        RankGaps(timeMs, faults, n, report.maxGapMs, maxGapIndex, report.meanGapMs);
+        report.maxGapRank = entries[maxGapIndex].rank;
+
+        int64_t fence = (int64_t)q1 - 3 * ((int64_t)q3 - q1);
+        report.outlierFenceMs = (int)(std::max)((int64_t)0, fence);
+        FindOutliers(timeMs, n, report.outlierFenceMs, report.outliers);
+        report.outlierEntries.reserve(report.outliers.size());
+        for (int index : report.outliers) {
+            report.outlierEntries.push_back(entries[index]);
+        }
+
+        report.computeMicros = std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now() - start).count();
+        report.valid = true;
+        return report;
+    }
+
+    void Refresh(int buckets) {
+        const auto& entries = LeaderboardScanner::GetAllEntries();
+        Report report = Analyze(entries, buckets);
+        report.trackId = LeaderboardScanner::GetState().currentTrackId;
+
+        if (report.valid) {
+            LOG_INFO("[Analytics] " << report.entryCount << " entries analysed in "
+                << std::fixed << std::setprecision(1) << report.computeMicros << "us"
+                << " | median " << LeaderboardScanner::FormatTime(report.time.median)
+                << " | " << report.outliers.size() << " outliers");
+        } else {
+            LOG_WARNING("[Analytics] No entries to analyse");
+        }
+
+        std::lock_guard<std::mutex> lock(s_reportMutex);
+        s_report = std::move(report);
+        s_generation++;
+    }
+
+    Report CopyReport(uint32_t* generation) {
+        std::lock_guard<std::mutex> lock(s_reportMutex);
+        if (generation) *generation = s_generation;
+        return s_report;
+    }
+
+    uint32_t GetGeneration() {
+        std::lock_guard<std::mutex> lock(s_reportMutex);
+        return s_generation;
+    }
+
+    // ============================================================================
+    // Export
+    // ============================================================================
+
+    void WriteReport(std::ostream& out, const Report& report, const std::vector<LeaderboardEntry>& entries) {
+        using LeaderboardScanner::FormatTime;
+        using LeaderboardScanner::GetMedalName;
+
+        if (!report.valid) return;
+
+        out << "--- Analytics (" << report.entryCount << " entries, "
+            << std::fixed << std::setprecision(1) << report.computeMicros << "us) ---\n";
+        out << "Time:   min " << FormatTime(report.time.minValue)
+            << " | p10 " << FormatTime(report.time.p10)
+            << " | median " << FormatTime(report.time.median)
+            << " | p90 " << FormatTime(report.time.p90)
+            << " | max " << FormatTime(report.time.maxValue)
+            << " | mean " << FormatTime((int)report.time.mean) << "\n";
+        out << "Faults: min " << report.faults.minValue
+            << " | p10 " << report.faults.p10
+            << " | median " << report.faults.median
+            << " | p90 " << report.faults.p90
+            << " | max " << report.faults.maxValue
+            << " | mean " << std::setprecision(2) << report.faults.mean << "\n";
+
+        out << "Medals:";
+        for (int m = 3; m >= 0; m--) {
+            out << " " << GetMedalName(m) << " " << report.medalCounts[m];
+        }
+        out << " None " << report.medalCounts[4] << "\n";
+
+        out << "Largest gap: " << FormatTime(report.maxGapMs) << " below rank " << report.maxGapRank
+            << " | mean gap " << std::setprecision(1) << report.meanGapMs << "ms\n";
+
+        out << "Time histogram (bucket " << report.timeHistogram.bucketWidth << "ms):\n";
+        for (size_t b = 0; b < report.timeHistogram.counts.size(); b++) {
+            int low = report.timeHistogram.minValue + (int)b * report.timeHistogram.bucketWidth;
+            out << "  " << FormatTime(low) << " | " << report.timeHistogram.counts[b] << "\n";
+        }
+
+        out << "Fault histogram (bucket " << report.faultHistogram.bucketWidth << "):\n";
+        for (size_t b = 0; b < report.faultHistogram.counts.size(); b++) {
+            int low = report.faultHistogram.minValue + (int)b * report.faultHistogram.bucketWidth;
+            out << "  " << std::setw(4) << low << " | " << report.faultHistogram.counts[b] << "\n";
+        }
+
+        out << "Outliers (below " << FormatTime(report.outlierFenceMs) << "): " << report.outliers.size() << "\n";
+        for (int index : report.outliers) {
+            if (index < 0 || index >= (int)entries.size()) continue;
+            const auto& entry = entries[index];
+            out << "  " << std::setw(4) << entry.rank << " | " << entry.playerName
+                << " | Faults: " << entry.faults << " | Time: " << FormatTime(entry.timeMs) << "\n";
+        }
+        out << "\n";
+    }
+
+} // namespace LeaderboardAnalytics
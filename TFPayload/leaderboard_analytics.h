@@ -0,0 +1,71 @@
+#pragma once
+#include "leaderboard_scanner.h"
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Distribution analytics for a scanned leaderboard
+// Entries are split into int columns (timeMs, faults, medal) and every statistic is a single
+// SSE2 pass over those columns, so a 100k entry board is analysed in well under a millisecond.
+
+namespace LeaderboardAnalytics {
+
+    struct Histogram {
+        int minValue = 0;
+        int bucketWidth = 1;
+        std::vector<uint32_t> counts;
+    };
+
+    struct ColumnStats {
+        int minValue = 0;
+        int maxValue = 0;
+        double mean = 0.0;
+        int p10 = 0;
+        int median = 0;
+        int p90 = 0;
+    };
+
+    struct Report {
+        bool valid = false;
+        std::string trackId;
+        size_t entryCount = 0;
+
+        ColumnStats time;
+        ColumnStats faults;
+        Histogram timeHistogram;
+        Histogram faultHistogram;
+
+        int medalCounts[5] = {};        // Bronze, Silver, Gold, Platinum, None
+
+        // Time gaps between consecutive ranks with the same fault count
+        int maxGapMs = 0;
+        int maxGapRank = 0;             // Rank just above the largest gap
+        double meanGapMs = 0.0;
+
+        // Suspicious times: non-positive, or below Q1 - 3*IQR of the board
+        int outlierFenceMs = 0;
+        std::vector<int> outliers;      // Indices into the analysed entries
+        std::vector<LeaderboardScanner::LeaderboardEntry> outlierEntries;    // Copies, in the same order
+
+        double computeMicros = 0.0;
+    };
+
+    // Analyse a set of entries (boards are ordered by faults, then time); callable from any thread
+    Report Analyze(const std::vector<LeaderboardScanner::LeaderboardEntry>& entries, int buckets = 32);
+
+    // Re-analyse LeaderboardScanner::GetAllEntries() and cache the result. Key monitor thread
+    // only, where the scanner fills the entries; others go through LeaderboardScanner::QueueAnalyze
+    void Refresh(int buckets = 32);
+
+    // Thread-safe copy of the last report
+    Report CopyReport(uint32_t* generation = nullptr);
+
+    // Bumped on every Refresh, so readers can skip copying an unchanged report
+    uint32_t GetGeneration();
+
+    // Write a report in the scan file's text format
+    void WriteReport(std::ostream& out, const Report& report,
+                     const std::vector<LeaderboardScanner::LeaderboardEntry>& entries);
+
+} // namespace LeaderboardAnalytics
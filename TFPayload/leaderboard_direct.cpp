@@ -1,10 +1,17 @@
 #include "pch.h"
 #include "leaderboard_direct.h"
 #include "logging.h"
+#include "leaderboard_governor.h"
 #include "Keybindings.h"
+#include "patch_manager.h"
+#include "game_thread.h"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <deque>
+#include <algorithm>
+#include <climits>
+#include <mutex>
 #include <MinHook.h>
 
 namespace LeaderboardDirect {
@@ -15,13 +22,10 @@ namespace LeaderboardDirect {
     static CompletionCallback s_completionCallback = nullptr;
     static DWORD_PTR s_baseAddress = 0;
 
-    // Original bytes at patch location
-    static BYTE s_originalBytes[2] = {0};
-    static bool s_originalBytesSaved = false;
-    
-    static const DWORD PATCH_RVA = 0x34397e;
-    static const BYTE ORIGINAL_OPCODE = 0x75;  // JNZ
-    static const BYTE PATCHED_OPCODE = 0xEB;   // JMP (unconditional)
+    // Track manager check: JNZ -> JMP (unconditional), offset kept
+    static const PatchManager::Patch PATCHES[] = {
+        { "Leaderboard track manager check", 0x34397e, "75 ??", "EB ??", PatchManager::GROUP_LEADERBOARD_TRACK_CHECK },
+    };
 
     // GLOBAL GAME POINTERS
 
@@ -53,83 +57,132 @@ namespace LeaderboardDirect {
     using GetLeaderboardEntryFn = void* (__thiscall*)(void* service, int index);
     static GetLeaderboardEntryFn o_GetLeaderboardEntry = nullptr;
 
-    // Called by leaderboard_scanner when ProcessLeaderboardData is called
-    // Returns true if we triggered the fetch and want to capture results
-    bool OnLeaderboardDataReceived(void* context) {
-        if (!s_weTriggeredFetch || !context) {
-            return false;
-        }
-        
-        LOG_INFO("[LB - Direct] ========================================");
-        LOG_INFO("[LB - Direct] LEADERBOARD DATA RECEIVED!");
-        LOG_INFO("[LB - Direct] Track ID requested: " << s_fetchTrackId);
-        LOG_INFO("[LB - Direct] ========================================");
-        
-        // Get leaderboard service to read entries
+    // Streaming state - s_streamMutex guards the pending queue and batch bookkeeping,
+    // since batches arrive on the game thread and are delivered on the key monitor thread
+    static StreamConfig s_streamConfig;
+    static std::mutex s_streamMutex;
+    static std::deque<LeaderboardEntry> s_pendingEntries;
+    static int s_streamEndIndex = 0;          // One past the last index to fetch
+    static int s_batchStart = 0;
+    static int s_batchCount = 0;
+    static DWORD s_batchIssuedTick = 0;
+    static LeaderboardGovernor::Clock::time_point s_batchIssuedAt;
+    static bool s_streamComplete = false;
+    static bool s_streamFailed = false;
+    static int s_batchRetries = 0;            // Consecutive timed-out attempts at s_batchStart
+    static DWORD s_retryAfterTick = 0;        // Earliest tick the retry may go out
+
+    // Set on the game thread when RequestLeaderboardData fails, reported by PumpStream
+    enum class RequestFailure { None, NoService, Rejected };
+    static RequestFailure s_requestFailure = RequestFailure::None;
+
+    // Read one batch out of the leaderboard service (caller holds s_streamMutex)
+    // totalHint is the board size from the UI context, or 0 when it isn't known. confirmed is
+    // false for the timeout path, where nothing says the server answered: a full batch is
+    // still taken, but a short one may just be late, so it's re-requested instead of ending
+    // the stream.
+    static void CollectBatch(int totalHint, bool confirmed) {
         void* service = GetLeaderboardService();
+        int batchEnd = s_batchStart + s_batchCount;
+        if (totalHint > 0 && totalHint < batchEnd) {
+            batchEnd = totalHint;
+        }
+
+        std::vector<LeaderboardEntry> batch;
         if (service && o_GetLeaderboardEntry) {
-            // Try to get total entries from context+0x150
-            int totalEntries = *(int*)((char*)context + 0x150);
-            LOG_VERBOSE("[LB - Direct] Total entries available: " << totalEntries);
-            
-            // Clear previous entries
-            s_state.fetchedEntries.clear();
-            
-            // Read up to 20 entries
-            int entriesToRead = (totalEntries < 20) ? totalEntries : 20;
-            if (entriesToRead <= 0) entriesToRead = 10; // Default if total is weird
-            
-            for (int i = 0; i < entriesToRead; i++) {
+            for (int i = s_batchStart; i < batchEnd; i++) {
                 void* entry = o_GetLeaderboardEntry(service, i);
-                if (entry) {
-                    // Entry structure:
-                    // +0x00: rank (int)
-                    // +0x34: faults (int)
-                    // +0x38: time in ms (int)
-                    // +0x43: player name (char*)
-                    // +0x88: medal (int)
-                    int rank = *(int*)((char*)entry + 0x00);
-                    int faults = *(int*)((char*)entry + 0x34);
-                    int timeMs = *(int*)((char*)entry + 0x38);
-                    char* playerName = (char*)entry + 0x43;
-                    int medal = *(int*)((char*)entry + 0x88);
-                    
-                    // Format time
-                    int minutes = timeMs / 60000;
-                    int seconds = (timeMs % 60000) / 1000;
-                    int ms = timeMs % 1000;
-                    
-                    LOG_VERBOSE("[LB - Direct] #" << rank << ": " << playerName 
-                        << " - " << minutes << ":" << std::setfill('0') << std::setw(2) << seconds 
-                        << "." << std::setw(3) << ms << std::setfill(' ')
-                        << " (" << faults << " faults)");
-                    
-                    // Store in our state
-                    LeaderboardEntry e;
-                    e.rank = rank;
-                    e.playerName = playerName;
-                    e.faults = faults;
-                    e.timeMs = timeMs;
-                    e.medal = medal;
-                    s_state.fetchedEntries.push_back(e);
-                }
+                if (!entry) break;
+
+                // Entry structure:
+                // +0x00: rank (int)
+                // +0x34: faults (int)
+                // +0x38: time in ms (int)
+                // +0x43: player name (char*)
+                // +0x88: medal (int)
+                batch.emplace_back();
+                LeaderboardEntry& e = batch.back();
+                e.rank = *(int*)((char*)entry + 0x00);
+                e.faults = *(int*)((char*)entry + 0x34);
+                e.timeMs = *(int*)((char*)entry + 0x38);
+                e.playerName = (char*)entry + 0x43;
+                e.medal = *(int*)((char*)entry + 0x88);
             }
-            
-            LOG_INFO("[LB - Direct] ========================================");
-            LOG_INFO("[LB - Direct] Captured " << s_state.fetchedEntries.size() << " entries");
-            LOG_INFO("[LB - Direct] ========================================");
         } else {
             LOG_WARNING("[LB - Direct] Could not read entries (service=0x" << std::hex << (uintptr_t)service << ", GetEntry=0x" << (uintptr_t)o_GetLeaderboardEntry << std::dec << ")");
         }
-        
+
+        int read = (int)batch.size();
         s_weTriggeredFetch = false;
-        s_state.isFetching = false;
-        
-        // Call completion callback if set
-        if (s_completionCallback) {
-            s_completionCallback(true, (int)s_state.fetchedEntries.size());
+        double elapsedMs = LeaderboardGovernor::RequestGovernor::ElapsedMs(s_batchIssuedAt);
+
+        if (!confirmed && read < s_batchCount) {
+            LeaderboardGovernor::Shared().RecordResponse(elapsedMs, LeaderboardGovernor::Outcome::Failed);
+            if (s_batchRetries < s_streamConfig.maxBatchRetries) {
+                // Back off on top of the governor: one timeout, then two, four, ...
+                s_batchRetries++;
+                s_retryAfterTick = GetTickCount() + (s_streamConfig.batchTimeoutMs << (s_batchRetries - 1));
+                LOG_WARNING("[LB - Direct] Batch at " << s_batchStart << " timed out with " << read << "/" << s_batchCount
+                    << " entries - retrying (" << s_batchRetries << "/" << s_streamConfig.maxBatchRetries << ")");
+                return;
+            }
+
+            // Out of retries - keep what the service held, but the end of the board was never confirmed
+            s_state.lastError = "Batch at " + std::to_string(s_batchStart) + " was never answered";
+            LOG_ERROR("[LB - Direct] " << s_state.lastError);
+            s_streamFailed = true;
+        } else {
+            LeaderboardGovernor::Shared().RecordResponse(elapsedMs, LeaderboardGovernor::Outcome::Ok);
         }
-        
+        s_batchRetries = 0;
+
+        for (const LeaderboardEntry& e : batch) {
+            LOG_VERBOSE("[LB - Direct] #" << e.rank << ": " << e.playerName
+                << " - " << FormatTime(e.timeMs)
+                << " (" << e.faults << " faults)");
+
+            s_state.fetchedEntries.push_back(e);
+            s_pendingEntries.push_back(e);
+        }
+
+        s_state.batchesReceived++;
+        s_state.nextIndex = s_batchStart + read;
+        if (totalHint > 0) {
+            s_state.totalAvailable = totalHint;
+        }
+
+        // A short batch means the board ran out before our range did
+        if (read < s_batchCount || s_streamFailed || s_state.nextIndex >= s_streamEndIndex ||
+            (totalHint > 0 && s_state.nextIndex >= totalHint)) {
+            s_streamComplete = true;
+        }
+
+        LOG_VERBOSE("[LB - Direct] Batch " << s_state.batchesReceived << ": " << read << " entries ("
+            << s_state.fetchedEntries.size() << " total, " << s_pendingEntries.size() << " pending)");
+    }
+
+    // Called by leaderboard_scanner when ProcessLeaderboardData is called
+    // Returns true if we triggered the fetch and want to capture results
+    bool OnLeaderboardDataReceived(void* context) {
+        if (!context) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(s_streamMutex);
+        if (!s_weTriggeredFetch) {
+            return false;
+        }
+
+        LOG_VERBOSE("[LB - Direct] Leaderboard data received for track " << s_fetchTrackId
+            << " (entries " << s_batchStart << " to " << (s_batchStart + s_batchCount - 1) << ")");
+
+        // Try to get total entries from context+0x150 - ignore it if it looks wrong
+        int totalEntries = *(int*)((char*)context + 0x150);
+        if (totalEntries <= 0 || totalEntries > 1000000) {
+            totalEntries = 0;
+        }
+
+        CollectBatch(totalEntries, true);
         return true;
     }
 
@@ -213,24 +266,12 @@ namespace LeaderboardDirect {
             }
         }
 
-        // Save original bytes at patch location
-        BYTE* patchAddr = (BYTE*)(baseAddress + PATCH_RVA);
-        
-        // Make memory readable
-        DWORD oldProtect;
-        if (!VirtualProtect(patchAddr, 2, PAGE_EXECUTE_READ, &oldProtect)) {
-            LOG_WARNING("[LB - Direct] Could not read patch location");
+        // Register the patch and check the site holds the JNZ we expect
+        PatchManager::Register(baseAddress, PATCHES, sizeof(PATCHES) / sizeof(PATCHES[0]));
+        if (PatchManager::GetState(PatchManager::GROUP_LEADERBOARD_TRACK_CHECK) == PatchManager::State::Original) {
+            LOG_VERBOSE("[LB - Direct] Verified: Found JNZ instruction at expected location");
         } else {
-            s_originalBytes[0] = patchAddr[0];
-            s_originalBytes[1] = patchAddr[1];
-            s_originalBytesSaved = true;
-            VirtualProtect(patchAddr, 2, oldProtect, &oldProtect);
-            
-            if (s_originalBytes[0] == ORIGINAL_OPCODE) {
-                LOG_VERBOSE("[LB - Direct] Verified: Found JNZ instruction at expected location");
-            } else {
-                LOG_WARNING("[LB - Direct] Expected JNZ (0x75), found 0x" << std::hex << (int)s_originalBytes[0] << std::dec);
-            }
+            LOG_WARNING("[LB - Direct] Expected JNZ (0x75) at patch location");
         }
 
         s_state.isInitialized = true;
@@ -253,6 +294,12 @@ namespace LeaderboardDirect {
         MH_RemoveHook(targetFetch);
 
         s_state = FetcherState();
+        {
+            std::lock_guard<std::mutex> lock(s_streamMutex);
+            s_pendingEntries.clear();
+            s_weTriggeredFetch = false;
+            s_streamComplete = false;
+        }
         s_entryCallback = nullptr;
         s_completionCallback = nullptr;
         s_baseAddress = 0;
@@ -272,30 +319,12 @@ namespace LeaderboardDirect {
             return true;
         }
 
-        if (!s_originalBytesSaved) {
-            s_state.lastError = "Original bytes not saved";
-            return false;
-        }
-
-        BYTE* patchAddr = (BYTE*)(s_baseAddress + PATCH_RVA);
-        
-        // Make memory writable
-        DWORD oldProtect;
-        if (!VirtualProtect(patchAddr, 1, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            s_state.lastError = "VirtualProtect failed";
+        if (!PatchManager::Apply(PatchManager::GROUP_LEADERBOARD_TRACK_CHECK)) {
+            s_state.lastError = "Patch failed";
             LOG_ERROR("[LB - Direct] " << s_state.lastError);
             return false;
         }
 
-        // Apply patch: change JNZ (75) to JMP (EB)
-        patchAddr[0] = PATCHED_OPCODE;
-
-        // Restore protection
-        VirtualProtect(patchAddr, 1, oldProtect, &oldProtect);
-
-        // Flush instruction cache
-        FlushInstructionCache(GetCurrentProcess(), patchAddr, 1);
-
         s_state.isPatchApplied = true;
         LOG_INFO("[LB - Direct] *** PATCH APPLIED ***");
         LOG_INFO("[LB - Direct] Track manager check bypassed - can fetch any leaderboard!");
@@ -313,30 +342,12 @@ namespace LeaderboardDirect {
             return true;
         }
 
-        if (!s_originalBytesSaved) {
-            s_state.lastError = "Original bytes not saved";
-            return false;
-        }
-
-        BYTE* patchAddr = (BYTE*)(s_baseAddress + PATCH_RVA);
-        
-        // Make memory writable
-        DWORD oldProtect;
-        if (!VirtualProtect(patchAddr, 1, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            s_state.lastError = "VirtualProtect failed";
+        if (!PatchManager::Restore(PatchManager::GROUP_LEADERBOARD_TRACK_CHECK)) {
+            s_state.lastError = "Restoring the patch failed";
             LOG_ERROR("[LB - Direct] " << s_state.lastError);
             return false;
         }
 
-        // Restore original byte
-        patchAddr[0] = s_originalBytes[0];
-
-        // Restore protection
-        VirtualProtect(patchAddr, 1, oldProtect, &oldProtect);
-
-        // Flush instruction cache
-        FlushInstructionCache(GetCurrentProcess(), patchAddr, 1);
-
         s_state.isPatchApplied = false;
         LOG_INFO("[LB - Direct] *** PATCH REMOVED ***");
         LOG_INFO("[LB - Direct] Track manager check restored");
@@ -349,6 +360,129 @@ namespace LeaderboardDirect {
     }
 
     // CORE FUNCTIONALITY
+
+    // Game thread - the request itself. A failure only ends the wait here; PumpStream reports it
+    static void RequestBatch(int leaderboardType, int startIndex) {
+        void* service = GetLeaderboardService();
+        bool result = service && CallRequestLeaderboardData(service, leaderboardType, startIndex);
+        LOG_VERBOSE("[LB - Direct] RequestLeaderboardData(type " << leaderboardType << ", start " << startIndex
+            << ") returned: " << (result ? "true" : "false"));
+        if (result) return;
+
+        LeaderboardGovernor::Shared().RecordResponse(0.0, LeaderboardGovernor::Outcome::Failed);
+        std::lock_guard<std::mutex> lock(s_streamMutex);
+        if (!s_weTriggeredFetch || s_batchStart != startIndex) return;     // Superseded by a timeout retry or cancel
+        s_weTriggeredFetch = false;
+        s_requestFailure = service ? RequestFailure::Rejected : RequestFailure::NoService;
+    }
+
+    // Request the next batch of the current stream from the server (posted to the game thread)
+    static void IssueNextBatch() {
+        int startIndex;
+        {
+            std::lock_guard<std::mutex> lock(s_streamMutex);
+            s_batchStart = s_state.nextIndex;
+            s_batchCount = (std::min)(s_streamConfig.batchSize, s_streamEndIndex - s_batchStart);
+            s_batchIssuedTick = GetTickCount();
+            s_batchIssuedAt = LeaderboardGovernor::Clock::now();
+            s_weTriggeredFetch = true;
+            s_requestFailure = RequestFailure::None;
+            startIndex = s_batchStart;
+        }
+
+        int leaderboardType = s_state.currentRequest.leaderboardType;
+        LOG_VERBOSE("[LB - Direct] Requesting entries from " << startIndex << " (type " << leaderboardType << ")");
+        GameThread::Post("RequestLeaderboardData", [leaderboardType, startIndex]() {
+            RequestBatch(leaderboardType, startIndex);
+        });
+    }
+
+    static void FinishFetch(bool success) {
+        s_state.isFetching = false;
+
+        LOG_INFO("[LB - Direct] ========================================");
+        LOG_INFO("[LB - Direct] Captured " << s_state.fetchedEntries.size() << " entries in "
+            << s_state.batchesReceived << " batches");
+        LOG_INFO("[LB - Direct] ========================================");
+
+        if (s_completionCallback) {
+            s_completionCallback(success, (int)s_state.fetchedEntries.size());
+        }
+    }
+
+    // Deliver pending entries and keep the stream moving - runs on the key monitor thread
+    static void PumpStream() {
+        if (!s_state.isFetching) return;
+
+        // Hand a bounded number of entries to the callback per tick
+        std::vector<LeaderboardEntry> toDeliver;
+        bool waitingForBatch = false;
+        bool retryWait = false;
+        bool complete = false;
+        size_t pending = 0;
+        RequestFailure failure;
+        {
+            std::lock_guard<std::mutex> lock(s_streamMutex);
+
+            // Entries already received are still delivered before completion fires
+            failure = s_requestFailure;
+            if (failure != RequestFailure::None) {
+                s_requestFailure = RequestFailure::None;
+                s_streamComplete = true;
+                s_streamFailed = true;
+            }
+
+            // ProcessLeaderboardData only fires while a leaderboard screen exists, so when it
+            // stays quiet read the service directly once the server has had time to answer
+            if (s_weTriggeredFetch && GetTickCount() - s_batchIssuedTick > s_streamConfig.batchTimeoutMs) {
+                LOG_VERBOSE("[LB - Direct] No ProcessLeaderboardData for batch at " << s_batchStart << " - reading service directly");
+                CollectBatch(0, false);
+            }
+            retryWait = s_batchRetries > 0 && (LONG)(GetTickCount() - s_retryAfterTick) < 0;
+
+            int budget = s_streamConfig.deliverPerTick;
+            while (budget-- > 0 && !s_pendingEntries.empty()) {
+                toDeliver.push_back(s_pendingEntries.front());
+                s_pendingEntries.pop_front();
+            }
+
+            waitingForBatch = s_weTriggeredFetch;
+            complete = s_streamComplete;
+            pending = s_pendingEntries.size();
+        }
+
+        if (failure == RequestFailure::NoService) {
+            s_state.lastError = "Leaderboard service disappeared mid-fetch";
+            LOG_ERROR("[LB - Direct] " << s_state.lastError);
+        } else if (failure == RequestFailure::Rejected) {
+            s_state.lastError = s_state.isPatchApplied ? "RequestLeaderboardData failed even with patch"
+                                                       : "RequestLeaderboardData failed - try applying patch (F11)";
+            LOG_ERROR("[LB - Direct] " << s_state.lastError);
+        }
+
+        for (const auto& entry : toDeliver) {
+            if (s_entryCallback) {
+                s_entryCallback(entry);
+            }
+            s_state.entriesDelivered++;
+        }
+
+        if (waitingForBatch || retryWait) return;
+
+        if (complete) {
+            if (pending == 0) {
+                FinishFetch(!s_streamFailed);
+            }
+            return;
+        }
+
+        // Backpressure: only ask the server for more once the consumer has caught up,
+        // and only as fast as the governor allows
+        if ((int)pending <= s_streamConfig.maxPendingEntries / 2 && LeaderboardGovernor::Shared().TryAcquire()) {
+            IssueNextBatch();
+        }
+    }
+
     bool FetchLeaderboard(const FetchRequest& request) {
         if (!s_state.isInitialized) {
             s_state.lastError = "Not initialized";
@@ -356,6 +490,12 @@ namespace LeaderboardDirect {
             return false;
         }
 
+        if (s_state.isFetching) {
+            s_state.lastError = "A fetch is already in progress";
+            LOG_ERROR("[LB - Direct] " << s_state.lastError);
+            return false;
+        }
+
         // Get leaderboard service
         void* service = GetLeaderboardService();
         if (!service) {
@@ -368,15 +508,13 @@ namespace LeaderboardDirect {
         LOG_INFO("[LB - Direct] FETCHING LEADERBOARD");
         LOG_INFO("[LB - Direct] Track ID: " << request.trackId);
         LOG_VERBOSE("[LB - Direct] Start Index: " << request.startIndex);
+        LOG_VERBOSE("[LB - Direct] Count: " << (request.count > 0 ? std::to_string(request.count) : std::string("all")));
         LOG_VERBOSE("[LB - Direct] Leaderboard Type: " << request.leaderboardType);
         LOG_INFO("[LB - Direct] Patch Applied: " << (s_state.isPatchApplied ? "YES" : "NO"));
         LOG_INFO("[LB - Direct] ========================================");
 
         // Store current request
         s_state.currentRequest = request;
-        s_state.fetchedEntries.clear();
-        s_state.isFetching = true;
-        s_weTriggeredFetch = true;
 
         // Convert track ID string to int
         int trackIdInt = 0;
@@ -385,7 +523,6 @@ namespace LeaderboardDirect {
             if (c < '0' || c > '9') {
                 s_state.lastError = "Invalid track ID (not a number)";
                 LOG_ERROR("[LB - Direct] " << s_state.lastError);
-                s_state.isFetching = false;
                 return false;
             }
             trackIdInt = trackIdInt * 10 + (c - '0');
@@ -435,35 +572,31 @@ namespace LeaderboardDirect {
             LOG_WARNING("[LB - Direct] dataPtr is null, cannot set track ID");
         }
 
-        // Set flags before calling - this tells our hook to capture the results
-        s_weTriggeredFetch = true;
+        // Reset the stream - batches are requested from PumpStream as the consumer keeps up
         s_fetchTrackId = trackIdInt;
-        s_state.fetchedEntries.clear();
-
-        // Call RequestLeaderboardData
-        LOG_VERBOSE("[LB - Direct] Calling RequestLeaderboardData...");
-        LOG_VERBOSE("[LB - Direct]   this = 0x" << std::hex << (uintptr_t)service << std::dec);
-        LOG_VERBOSE("[LB - Direct]   type = " << request.leaderboardType);
-        LOG_VERBOSE("[LB - Direct]   startIndex = " << request.startIndex);
-
-        bool result = CallRequestLeaderboardData(service, request.leaderboardType, request.startIndex);
-        
-        LOG_VERBOSE("[LB - Direct] RequestLeaderboardData returned: " << (result ? "true" : "false"));
+        {
+            std::lock_guard<std::mutex> lock(s_streamMutex);
+            s_state.fetchedEntries.clear();
+            s_pendingEntries.clear();
+            s_state.nextIndex = request.startIndex;
+            s_state.batchesReceived = 0;
+            s_state.entriesDelivered = 0;
+            s_state.totalAvailable = 0;
+            s_streamEndIndex = (request.count > 0) ? request.startIndex + request.count : INT_MAX;
+            s_streamComplete = false;
+            s_streamFailed = false;
+            s_batchRetries = 0;
+            s_requestFailure = RequestFailure::None;
+        }
 
-        if (!result) {
-            if (!s_state.isPatchApplied) {
-                s_state.lastError = "RequestLeaderboardData failed - try applying patch (F11)";
-            } else {
-                s_state.lastError = "RequestLeaderboardData failed even with patch";
-            }
-            LOG_ERROR("[LB - Direct] " << s_state.lastError);
-            s_state.isFetching = false;
-            return false;
+        // Without a token the first batch goes out from PumpStream instead
+        s_state.isFetching = true;
+        if (LeaderboardGovernor::Shared().TryAcquire()) {
+            IssueNextBatch();
         }
 
-        LOG_INFO("[LB - Direct] Request sent! Watch leaderboard_scanner for results...");
-        s_state.isFetching = false;
-        
+        LOG_INFO("[LB - Direct] Request sent! Entries are delivered as batches arrive...");
+
         return true;
     }
 
@@ -471,6 +604,30 @@ namespace LeaderboardDirect {
         return s_state.isFetching;
     }
 
+    void CancelFetch() {
+        if (!s_state.isFetching) return;
+
+        std::lock_guard<std::mutex> lock(s_streamMutex);
+        s_streamEndIndex = s_state.nextIndex;
+        s_streamComplete = true;
+        LOG_INFO("[LB - Direct] Fetch cancelled - delivering " << s_pendingEntries.size() << " pending entries");
+    }
+
+    void SetStreamConfig(const StreamConfig& config) {
+        std::lock_guard<std::mutex> lock(s_streamMutex);
+        s_streamConfig = config;
+        if (s_streamConfig.batchSize < 1) s_streamConfig.batchSize = 1;
+        if (s_streamConfig.deliverPerTick < 1) s_streamConfig.deliverPerTick = 1;
+        if (s_streamConfig.maxPendingEntries < s_streamConfig.batchSize) {
+            s_streamConfig.maxPendingEntries = s_streamConfig.batchSize;
+        }
+    }
+
+    int GetPendingCount() {
+        std::lock_guard<std::mutex> lock(s_streamMutex);
+        return (int)s_pendingEntries.size();
+    }
+
     // ============================================================
     // CALLBACKS
     // ============================================================
@@ -520,6 +677,8 @@ namespace LeaderboardDirect {
     // ============================================================
     
     void CheckHotkey() {
+        PumpStream();
+
         // Use keybindings for Test fetch
         if (Keybindings::IsActionPressed(Keybindings::Action::TestFetchTrackID)) {
             std::string keyName = Keybindings::GetKeyName(Keybindings::GetKey(Keybindings::Action::TestFetchTrackID));
@@ -528,7 +687,7 @@ namespace LeaderboardDirect {
             FetchRequest request;
             request.trackId = "221120";
             request.startIndex = 0;
-            request.count = 10;
+            request.count = 100;
             request.leaderboardType = 2;  // Type 5: uses service+0xc as track ID, param becomes 1
             
             FetchLeaderboard(request);
@@ -23,10 +23,20 @@ namespace LeaderboardDirect {
     struct FetchRequest {
         std::string trackId;          // Track ID to fetch leaderboard for
         int startIndex = 0;           // Starting rank index
-        int count = 10;               // Number of entries to fetch
+        int count = 10;               // Number of entries to fetch (0 = until the board runs out)
         int leaderboardType = 4;      // 0=overall, 4=track-specific, etc.
     };
 
+    // Streaming configuration - ranges larger than one server batch are fetched
+    // as successive requests with increasing startIndex
+    struct StreamConfig {
+        int batchSize = 20;           // Entries requested per server round-trip
+        int maxPendingEntries = 200;  // Stop requesting batches while this many are undelivered
+        int deliverPerTick = 50;      // EntryCallback invocations per CheckHotkey tick
+        DWORD batchTimeoutMs = 3000;  // Read the service directly if ProcessLeaderboardData never fires
+        int maxBatchRetries = 3;      // Re-requests of a timed-out batch the service couldn't fill
+    };
+
     // Fetcher state
     struct FetcherState {
         bool isInitialized = false;
@@ -35,6 +45,9 @@ namespace LeaderboardDirect {
         FetchRequest currentRequest;
         std::vector<LeaderboardEntry> fetchedEntries;
         int totalAvailable = 0;
+        int nextIndex = 0;            // Next board index to request
+        int batchesReceived = 0;
+        int entriesDelivered = 0;     // Entries handed to EntryCallback so far
         std::string lastError;
     };
 
@@ -67,19 +80,30 @@ namespace LeaderboardDirect {
     
     // Fetch leaderboard data for a specific track ID
     // Requires patch to be applied OR being in a valid track context
+    // Requests go out on the game thread; one the game rejects ends the fetch through the
+    // completion callback (success = false)
     bool FetchLeaderboard(const FetchRequest& request);
     
     // Check if a fetch is in progress
     bool IsFetching();
 
+    // Stop requesting further batches (entries already received are still delivered)
+    void CancelFetch();
+
+    // Configure batch size and backpressure for streaming fetches
+    void SetStreamConfig(const StreamConfig& config);
+
+    // Number of received entries not yet delivered to EntryCallback
+    int GetPendingCount();
+
     // ============================================================
     // CALLBACKS
     // ============================================================
     
-    // Set callback for each entry received
+    // Set callback for each entry received (delivered incrementally from CheckHotkey)
     void SetEntryCallback(EntryCallback callback);
     
-    // Set callback for when fetch completes
+    // Set callback for when fetch completes (after every entry has been delivered)
     void SetCompletionCallback(CompletionCallback callback);
 
     // ============================================================
@@ -114,7 +138,7 @@ namespace LeaderboardDirect {
     // UPDATE / HOTKEYS
     // ============================================================
     
-    // Check hotkeys (F10 = test fetch)
+    // Check hotkeys (F10 = test fetch) and pump any streaming fetch
     void CheckHotkey();
 
 } // namespace LeaderboardDirect
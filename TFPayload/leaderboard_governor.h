@@ -0,0 +1,151 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+// Request rate governor for leaderboard traffic
+// Every SetLeaderboardListRange / RequestLeaderboardData call takes a token from a shared
+// bucket. The refill rate adapts to what the server tells us (AIMD):
+//   - fast responses raise the rate additively
+//   - slow responses trim it a little
+//   - failures (throttling, rejected requests) cut it multiplicatively
+// Header-only and Windows-free so tools/leaderboard_governor_bench can drive it offline.
+
+namespace LeaderboardGovernor {
+
+    using Clock = std::chrono::steady_clock;
+
+    enum class Outcome {
+        Ok,             // Response arrived
+        Failed          // Request rejected, throttled or never answered
+    };
+
+    struct Config {
+        double initialRate = 2.0;       // Requests per second at startup
+        double minRate = 0.25;
+        double maxRate = 12.0;
+        double burst = 3.0;             // Bucket capacity in tokens
+        double targetLatencyMs = 1000.0;// Responses slower than this trim the rate
+        double increaseStep = 0.25;     // Requests/s added per fast response
+        double slowFactor = 0.9;        // Rate multiplier per slow response
+        double failFactor = 0.5;        // Rate multiplier per failure
+    };
+
+    struct Stats {
+        uint64_t granted = 0;
+        uint64_t denied = 0;            // TryAcquire calls that found the bucket empty
+        uint64_t responses = 0;
+        uint64_t failures = 0;
+        double currentRate = 0.0;
+        double avgLatencyMs = 0.0;      // EWMA of observed latency
+    };
+
+    class RequestGovernor {
+    public:
+        explicit RequestGovernor(const Config& config = Config()) {
+            Configure(config);
+        }
+
+        void Configure(const Config& config) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_config = config;
+            m_rate = config.initialRate;
+            m_tokens = config.burst;
+            m_lastRefillSec = -1.0;
+            m_stats = Stats();
+            m_stats.currentRate = m_rate;
+        }
+
+        // Take a token if one is available. nowSec is any monotonic time in seconds.
+        bool TryAcquire(double nowSec) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Refill(nowSec);
+            if (m_tokens >= 1.0) {
+                m_tokens -= 1.0;
+                m_stats.granted++;
+                return true;
+            }
+            m_stats.denied++;
+            return false;
+        }
+
+        // Seconds until the next token will be available (0 if one is ready)
+        double SecondsUntilToken(double nowSec) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Refill(nowSec);
+            if (m_tokens >= 1.0) return 0.0;
+            return (1.0 - m_tokens) / m_rate;
+        }
+
+        // Feed back how a granted request went
+        void RecordResponse(double latencyMs, Outcome outcome) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stats.responses++;
+
+            if (outcome == Outcome::Failed) {
+                m_stats.failures++;
+                m_rate *= m_config.failFactor;
+                // Drain the bucket so a burst doesn't immediately follow a throttle
+                if (m_tokens > 0.0) m_tokens = 0.0;
+            }
+            else {
+                m_stats.avgLatencyMs = (m_stats.responses == 1)
+                    ? latencyMs
+                    : m_stats.avgLatencyMs * 0.8 + latencyMs * 0.2;
+
+                if (latencyMs > m_config.targetLatencyMs) {
+                    m_rate *= m_config.slowFactor;
+                } else {
+                    m_rate += m_config.increaseStep;
+                }
+            }
+
+            if (m_rate < m_config.minRate) m_rate = m_config.minRate;
+            if (m_rate > m_config.maxRate) m_rate = m_config.maxRate;
+            m_stats.currentRate = m_rate;
+        }
+
+        Stats GetStats() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_stats;
+        }
+
+        // Wall-clock convenience overloads for in-game use
+        bool TryAcquire() { return TryAcquire(NowSeconds()); }
+
+        static double NowSeconds() {
+            return std::chrono::duration<double>(Clock::now().time_since_epoch()).count();
+        }
+
+        static double ElapsedMs(Clock::time_point since) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+        }
+
+    private:
+        void Refill(double nowSec) {
+            if (m_lastRefillSec < 0.0) {
+                m_lastRefillSec = nowSec;
+                return;
+            }
+            double elapsed = nowSec - m_lastRefillSec;
+            if (elapsed <= 0.0) return;
+            m_lastRefillSec = nowSec;
+            m_tokens += elapsed * m_rate;
+            if (m_tokens > m_config.burst) m_tokens = m_config.burst;
+        }
+
+        std::mutex m_mutex;
+        Config m_config;
+        double m_rate = 0.0;
+        double m_tokens = 0.0;
+        double m_lastRefillSec = -1.0;
+        Stats m_stats;
+    };
+
+    // Governor shared by the scanner and the direct fetcher - they hit the same server
+    inline RequestGovernor& Shared() {
+        static RequestGovernor s_governor;
+        return s_governor;
+    }
+
+} // namespace LeaderboardGovernor
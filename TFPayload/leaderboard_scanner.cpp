@@ -2,12 +2,17 @@
 #include "leaderboard_scanner.h"
 #include "Keybindings.h"
 
+#include "leaderboard_analytics.h"
 #include "leaderboard_direct.h"
+#include "leaderboard_governor.h"
 #include "logging.h"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
 #include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <MinHook.h>
 
 namespace LeaderboardScanner {
@@ -17,12 +22,94 @@ namespace LeaderboardScanner {
     static EntryCallback s_entryCallback = nullptr;
     static DWORD_PTR s_baseAddress = 0;
     static int s_totalScanned = 0;
-    static std::string s_outputPath = "F:/leaderboard_scans.txt";
+    static std::string s_outputPath = "leaderboard_scans.txt";    // Set from the output directory at startup
+    static std::mutex s_outputPathMutex;                            // SetOutputPath may come from the DevMenu
+
+    // Published for the DevMenu (render thread), which must not read s_state
+    static std::mutex s_statusMutex;
+    static ScanStatus s_status;
+    static std::atomic<bool> s_analyzeQueued{ false };
+
+    static std::string GetOutputPath() {
+        std::lock_guard<std::mutex> lock(s_outputPathMutex);
+        return s_outputPath;
+    }
     
     // Multi-track scanning state
     static std::vector<std::string> s_trackQueue;
     static int s_currentTrackIndex = -1;
     static bool s_autoScanNextTrack = false;
+    static bool s_autoScanPending = false;      // Track loaded in auto-scan mode, start from CheckHotkey
+    static bool s_nextTrackPending = false;     // Scan finished, load the next queued track when the governor allows
+
+    // Page request pacing - every SetLeaderboardListRange takes a token from the shared governor
+    // and a page counts as loaded once ProcessLeaderboardData fires. A page that isn't answered
+    // within PAGE_TIMEOUT_MS is reported as failed and requested again, up to MAX_PAGE_RETRIES times.
+    // The timeout sits well above the governor's target latency so slow-but-answered pages still
+    // reach its slow-response path instead of all being counted as failures.
+    static const double PAGE_TIMEOUT_MS = 2500.0;
+    static const int MAX_PAGE_RETRIES = 5;
+    static int s_pendingStart = -1;             // Request waiting for a token
+    static int s_pendingCount = 0;
+    static int s_requestedStart = 0;            // Page currently in flight
+    static int s_pageRetries = 0;
+    static bool s_pageInFlight = false;
+    static std::atomic<bool> s_pageArrived{ false };  // Set from the game thread by Hook_ProcessLeaderboardData
+    static std::atomic<double> s_pageLatencyMs{ 0.0 }; // Measured when the page arrives, not when it's polled
+    static LeaderboardGovernor::Clock::time_point s_pageRequestedAt;
+
+    // Locate state
+    enum class LocatePhase {
+        Bisect,         // Narrowing [lo, hi] page range on (faults, timeMs)
+        NameScan,       // ByName without a time hint - walk pages until the name shows up
+        Neighbourhood   // Collecting entries around the located position
+    };
+
+    static const int LOCATE_PAGE_SIZE = 10;
+
+    static LocateRequest s_locateRequest;
+    static LocateResult s_locateResult;
+    static LocateCallback s_locateCallback = nullptr;
+
+    // Locate queued from another thread, started by CheckHotkey
+    static std::mutex s_queuedLocateMutex;
+    static volatile bool s_locateQueued = false;
+    static LocateRequest s_queuedLocate;
+    static LocateCallback s_queuedLocateCallback = nullptr;
+    static LocatePhase s_locatePhase = LocatePhase::Bisect;
+    static int s_locateLo = 0;
+    static int s_locateHi = 0;
+    static int s_locatePage = 0;            // Page currently requested from the game
+    static int s_neighbourFirst = 0;        // Entry range to collect (inclusive)
+    static int s_neighbourLast = 0;
+    static int s_neighbourNextPage = 0;
+
+    static void FinishLocate(const char* failure = nullptr);
+
+    // Entry layout cache - the player name isn't always at +0x43 (+0x4C / +0xE3 on some boards),
+    // so the layout is detected once per service instance from the first page and every page
+    // after that is decoded with fixed offsets into s_pageBuffer
+    static const int NAME_OFFSET_CANDIDATES[] = { 0x43, 0x4C, 0xE3 };
+    static const int NAME_OFFSET_COUNT = sizeof(NAME_OFFSET_CANDIDATES) / sizeof(NAME_OFFSET_CANDIDATES[0]);
+    static const int MAX_NAME_LENGTH = MAX_PLAYER_NAME_LENGTH;
+    static const int PAGE_BUFFER_SIZE = 32;
+
+    struct EntryLayout {
+        void* service = nullptr;        // Service instance the layout was detected on
+        int nameOffset = 0;             // 0 = not detected yet
+    };
+
+    struct DecodedEntry {
+        int rank;
+        int faults;
+        int timeMs;
+        int medal;
+        int nameLength;
+        char name[MAX_NAME_LENGTH + 1];
+    };
+
+    static EntryLayout s_layout;
+    static DecodedEntry s_pageBuffer[PAGE_BUFFER_SIZE];
 
     // Function pointers
     using ProcessLeaderboardDataFn = void(__fastcall*)(void* context);
@@ -155,10 +242,79 @@ namespace LeaderboardScanner {
         }
     }
 
+    // Issue the pending page request if the governor has a token for it
+    static void PumpPageRequest() {
+        if (s_pendingStart < 0 || !s_state.capturedContext) return;
+        if (!LeaderboardGovernor::Shared().TryAcquire()) return;
+
+        s_pageArrived = false;
+        s_pageInFlight = true;
+        s_pageRequestedAt = LeaderboardGovernor::Clock::now();
+        s_requestedStart = s_pendingStart;
+        o_SetLeaderboardListRange(s_state.capturedContext, s_pendingStart, s_pendingCount);
+        s_pendingStart = -1;
+    }
+
+    static void RequestPage(int startIndex, int count) {
+        s_pendingStart = startIndex;
+        s_pendingCount = count;
+        PumpPageRequest();
+    }
+
+    // True once the requested page has arrived (or has had long enough to that it never will)
+    static bool IsPageReady() {
+        if (s_pendingStart >= 0) return false;
+        if (!s_pageInFlight) return true;
+        return s_pageArrived || LeaderboardGovernor::RequestGovernor::ElapsedMs(s_pageRequestedAt) >= PAGE_TIMEOUT_MS;
+    }
+
+    // Report how the in-flight page went back to the governor
+    static void CompletePage(LeaderboardGovernor::Outcome outcome) {
+        if (!s_pageInFlight) return;
+        s_pageInFlight = false;
+        double latencyMs = s_pageArrived
+            ? s_pageLatencyMs.load()
+            : LeaderboardGovernor::RequestGovernor::ElapsedMs(s_pageRequestedAt);
+        LeaderboardGovernor::Shared().RecordResponse(latencyMs, outcome);
+    }
+
+    enum class PageResult {
+        Loaded,         // The game answered - the context holds the page
+        Retrying,       // Timed out, requested again
+        GaveUp          // Timed out MAX_PAGE_RETRIES times in a row
+    };
+
+    // Report a ready page to the governor. A timeout is a failed request, not a page: the
+    // context still holds whatever was there before, so the page is requested again instead.
+    static PageResult FinishPage() {
+        if (!s_pageInFlight || s_pageArrived) {
+            CompletePage(LeaderboardGovernor::Outcome::Ok);
+            s_pageRetries = 0;
+            return PageResult::Loaded;
+        }
+
+        CompletePage(LeaderboardGovernor::Outcome::Failed);
+        if (++s_pageRetries > MAX_PAGE_RETRIES) {
+            LOG_ERROR("[Scanner] No response for entries from " << s_requestedStart << " after "
+                << MAX_PAGE_RETRIES << " retries - giving up");
+            s_pageRetries = 0;
+            return PageResult::GaveUp;
+        }
+
+        LOG_WARNING("[Scanner] No response for entries from " << s_requestedStart << " - requesting again ("
+            << s_pageRetries << "/" << MAX_PAGE_RETRIES << ")");
+        RequestPage(s_requestedStart, s_pendingCount);
+        return PageResult::Retrying;
+    }
+
     // Hook for ProcessLeaderboardData - just capture context
     void __fastcall Hook_ProcessLeaderboardData(void* context) {
         if (context) {
             s_state.capturedContext = context;
+            if (s_pageInFlight && !s_pageArrived) {
+                s_pageLatencyMs = LeaderboardGovernor::RequestGovernor::ElapsedMs(s_pageRequestedAt);
+                s_pageArrived = true;
+            }
             
             // Check if LeaderboardDirect triggered this fetch
             if (LeaderboardDirect::OnLeaderboardDataReceived(context)) {
@@ -179,9 +335,8 @@ namespace LeaderboardScanner {
                     if (s_autoScanNextTrack && !s_trackQueue.empty() && s_currentTrackIndex >= 0) {
                         LOG_VERBOSE("[Scanner] Auto-scanning track " << (s_currentTrackIndex + 1) << "/" << s_trackQueue.size());
                         LOG_VERBOSE("[Scanner] ========================================");
-                        // Wait for data to fully load, then start scan
-                        Sleep(400);
-                        StartScan();
+                        // Start from the key monitor thread - never block the game thread here
+                        s_autoScanPending = true;
                     } else {
                         LOG_VERBOSE("[Scanner] Press F3 to scan this leaderboard");
                         LOG_VERBOSE("");
@@ -230,7 +385,7 @@ namespace LeaderboardScanner {
         o_RefreshLeaderboardHandler = (RefreshLeaderboardHandlerFn)(baseAddress + 0x345300);
 
         LOG_VERBOSE("[Scanner] Leaderboard scanner initialized!");
-        LOG_VERBOSE("[Scanner] Output file: " << s_outputPath);
+        LOG_VERBOSE("[Scanner] Output file: " << GetOutputPath());
 
         return true;
     }
@@ -243,7 +398,14 @@ namespace LeaderboardScanner {
         MH_RemoveHook(targetProcessData);
 
         s_state = ScannerState();
+        s_layout = EntryLayout();
+        s_pendingStart = -1;
+        s_pageInFlight = false;
+        s_pageRetries = 0;
+        s_autoScanPending = false;
+        s_nextTrackPending = false;
         s_entryCallback = nullptr;
+        s_locateCallback = nullptr;
         s_baseAddress = 0;
 
         LOG_VERBOSE("[Scanner] Leaderboard scanner shut down");
@@ -255,6 +417,11 @@ namespace LeaderboardScanner {
             return;
         }
 
+        if (s_state.isLocating) {
+            LOG_WARNING("[Scanner] Locate in progress - stop it before scanning");
+            return;
+        }
+
         void* context = s_state.capturedContext;
 
         // Get total entries from context+0x150
@@ -269,6 +436,7 @@ namespace LeaderboardScanner {
         s_state.currentPage = 0;
         s_state.totalEntries = totalEntries;
         s_state.allEntries.clear();
+        s_state.allEntries.reserve(totalEntries);
         s_totalScanned = 0;
 
         LOG_INFO("[Scanner] STARTING LEADERBOARD SCAN");
@@ -281,7 +449,7 @@ namespace LeaderboardScanner {
         LOG_INFO("");
 
         // Request first page
-        o_SetLeaderboardListRange(context, 0, 10);
+        RequestPage(0, 10);
     }
 
     void StopScan() {
@@ -289,6 +457,12 @@ namespace LeaderboardScanner {
             LOG_INFO("[Scanner] Scan stopped by user");
             s_state.isScanning = false;
         }
+        s_pendingStart = -1;
+        s_pageRetries = 0;
+        s_nextTrackPending = false;
+        if (s_state.isLocating) {
+            FinishLocate("Locate stopped by user");
+        }
     }
 
     void SaveToFile() {
@@ -297,10 +471,11 @@ namespace LeaderboardScanner {
             return;
         }
 
+        std::string outputPath = GetOutputPath();
         try {
-            std::ofstream file(s_outputPath, std::ios::app);
+            std::ofstream file(outputPath, std::ios::app);
             if (!file.is_open()) {
-                LOG_ERROR("[Scanner] Could not open output file: " << s_outputPath);
+                LOG_ERROR("[Scanner] Could not open output file: " << outputPath);
                 return;
             }
 
@@ -332,9 +507,13 @@ namespace LeaderboardScanner {
             }
 
             file << "\n";
+
+            // Distribution analytics follow the entries in the same snapshot
+            LeaderboardAnalytics::Refresh();
+            LeaderboardAnalytics::WriteReport(file, LeaderboardAnalytics::CopyReport(), s_state.allEntries);
             file.close();
 
-            LOG_INFO("[Scanner] Scan saved to file: " << s_outputPath);
+            LOG_INFO("[Scanner] Scan saved to file: " << outputPath);
         }
         catch (...) {
             LOG_ERROR("[Scanner] Failed to write to file");
@@ -402,9 +581,128 @@ namespace LeaderboardScanner {
         }
     }
 
+    // ============================================================
+    // ENTRY DECODING
+    // ============================================================
+
+    // Copy a printable ASCII name into out (MAX_NAME_LENGTH + 1 bytes), returns its length
+    static int ReadNameInto(const char* src, char* out) {
+        int length = 0;
+        if ((DWORD_PTR)src >= 0x10000 && (DWORD_PTR)src <= 0x7FFFFFFF) {
+            while (length < MAX_NAME_LENGTH) {
+                char c = src[length];
+                if (c < 32 || c > 126) break;
+                out[length++] = c;
+            }
+        }
+        out[length] = 0;
+        return length;
+    }
+
+    static bool IsPlausibleName(const char* name, int length) {
+        return length >= 3 && strstr(name, "Index") == nullptr;
+    }
+
+    // Pick the name offset that yields plausible names for most of the page
+    static bool DetectLayout(void* service, int startIndex, int count) {
+        void* entryPtrs[PAGE_BUFFER_SIZE];
+        int found = 0;
+        for (int i = startIndex; i < startIndex + count && found < PAGE_BUFFER_SIZE; i++) {
+            void* entryPtr = o_GetLeaderboardEntry(service, i);
+            if (entryPtr) {
+                entryPtrs[found++] = entryPtr;
+            }
+        }
+        if (found == 0) return false;
+
+        char name[MAX_NAME_LENGTH + 1];
+        int bestOffset = 0;
+        int bestScore = 0;
+        for (int c = 0; c < NAME_OFFSET_COUNT; c++) {
+            int score = 0;
+            for (int e = 0; e < found; e++) {
+                int length = ReadNameInto((const char*)entryPtrs[e] + NAME_OFFSET_CANDIDATES[c], name);
+                if (IsPlausibleName(name, length)) {
+                    score++;
+                }
+            }
+            if (score > bestScore) {
+                bestScore = score;
+                bestOffset = NAME_OFFSET_CANDIDATES[c];
+            }
+        }
+
+        if (bestScore * 2 < found) {
+            LOG_WARNING("[Scanner] Could not detect entry layout (" << bestScore << "/" << found << " plausible names)");
+            return false;
+        }
+
+        s_layout.service = service;
+        s_layout.nameOffset = bestOffset;
+        LOG_VERBOSE("[Scanner] Entry layout detected: name at +0x" << std::hex << bestOffset << std::dec
+            << " (" << bestScore << "/" << found << " entries)");
+        return true;
+    }
+
+    // Decode [startIndex, startIndex + count) into s_pageBuffer, returns the number decoded
+    static int DecodePage(void* service, int startIndex, int count) {
+        if (count > PAGE_BUFFER_SIZE) count = PAGE_BUFFER_SIZE;
+
+        if (s_layout.service != service || s_layout.nameOffset == 0) {
+            s_layout = EntryLayout();
+            DetectLayout(service, startIndex, count);
+        }
+
+        int decoded = 0;
+        for (int i = startIndex; i < startIndex + count; i++) {
+            const char* entryPtr = (const char*)o_GetLeaderboardEntry(service, i);
+            if (!entryPtr) continue;
+
+            DecodedEntry& slot = s_pageBuffer[decoded++];
+            slot.rank = *(const int*)(entryPtr + 0x00);
+            slot.faults = *(const int*)(entryPtr + 0x34);
+            slot.timeMs = *(const int*)(entryPtr + 0x38);
+            slot.medal = *(const int*)(entryPtr + 0x88);
+
+            if (s_layout.nameOffset != 0) {
+                slot.nameLength = ReadNameInto(entryPtr + s_layout.nameOffset, slot.name);
+                continue;
+            }
+
+            // Layout unknown (detection failed on this page) - probe the candidates for this entry
+            slot.nameLength = ReadNameInto(entryPtr + NAME_OFFSET_CANDIDATES[0], slot.name);
+            for (int c = 1; c < NAME_OFFSET_COUNT && !IsPlausibleName(slot.name, slot.nameLength); c++) {
+                char alt[MAX_NAME_LENGTH + 1];
+                int length = ReadNameInto(entryPtr + NAME_OFFSET_CANDIDATES[c], alt);
+                if (IsPlausibleName(alt, length)) {
+                    memcpy(slot.name, alt, length + 1);
+                    slot.nameLength = length;
+                }
+            }
+        }
+        return decoded;
+    }
+
+    static void ToEntry(const DecodedEntry& slot, LeaderboardEntry& entry) {
+        entry.rank = slot.rank;
+        entry.faults = slot.faults;
+        entry.timeMs = slot.timeMs;
+        entry.medal = slot.medal;
+        memcpy(entry.playerName, slot.name, slot.nameLength + 1);
+    }
+
     // Process the current page by calling GetLeaderboardEntry
     void ProcessCurrentPage() {
         if (!s_state.isScanning || !s_state.capturedContext) return;
+        if (!IsPageReady()) return;
+
+        PageResult page = FinishPage();
+        if (page == PageResult::Retrying) return;
+        if (page == PageResult::GaveUp) {
+            LOG_ERROR("[Scanner] Scan stopped at page " << s_state.currentPage << " (" << s_state.allEntries.size() << " entries kept)");
+            s_state.isScanning = false;
+            return;
+        }
 
         void* context = s_state.capturedContext;
 
@@ -421,53 +719,26 @@ namespace LeaderboardScanner {
 
         LOG_VERBOSE("[Scanner] Page " << s_state.currentPage << " - Processing entries " << startIndex << " to " << (startIndex + count - 1));
 
-        // Fetch entries using GetLeaderboardEntry
-        for (int i = startIndex; i < startIndex + count && i < s_state.totalEntries; i++) {
-            void* entryPtr = o_GetLeaderboardEntry(service, i);
-
-            if (entryPtr) {
-                try {
-                    LeaderboardEntry entry;
-                    entry.rank = *(int*)((uintptr_t)entryPtr + 0x00);
-                    entry.faults = *(int*)((uintptr_t)entryPtr + 0x34);
-                    entry.timeMs = *(int*)((uintptr_t)entryPtr + 0x38);
-                    entry.medal = *(int*)((uintptr_t)entryPtr + 0x88);
-                    entry.playerName = ReadEmbeddedString((void*)((uintptr_t)entryPtr + 0x43), 30);
-
-                    if (entry.playerName.length() < 3 || entry.playerName.find("Index") != std::string::npos) {
-                        std::string alt1 = ReadEmbeddedString((void*)((uintptr_t)entryPtr + 0x4C), 30);
-                        if (alt1.length() > entry.playerName.length() && alt1.find("Index") == std::string::npos) {
-                            entry.playerName = alt1;
-                        }
-                    }
-
-                    if (entry.playerName.length() < 3 || entry.playerName.find("Index") != std::string::npos) {
-                        std::string alt2 = ReadEmbeddedString((void*)((uintptr_t)entryPtr + 0xE3), 30);
-                        if (alt2.length() > 3 && alt2.find("Index") == std::string::npos) {
-                            entry.playerName = alt2;
-                        }
-                    }
-
-                    // Format output
-                    std::string timeStr = FormatTime(entry.timeMs);
-                    std::string medalStr = GetMedalName(entry.medal);
-
-                    LOG_VERBOSE("#" << std::setw(4) << entry.rank
-                        << " | " << std::setw(20) << std::left << entry.playerName
-                        << " | Faults: " << std::setw(3) << entry.faults
-                        << " | Time: " << timeStr
-                        << " | Medal: " << medalStr);
-
-                    s_state.allEntries.push_back(entry);
-                    s_totalScanned++;
+        // Decode the page with the cached layout, then append into the reserved entry list
+        int pageCount = (std::min)(count, s_state.totalEntries - startIndex);
+        int decoded = DecodePage(service, startIndex, pageCount);
+
+        for (int d = 0; d < decoded; d++) {
+            s_state.allEntries.emplace_back();
+            LeaderboardEntry& entry = s_state.allEntries.back();
+            ToEntry(s_pageBuffer[d], entry);
+            s_totalScanned++;
+
+            if (Logging::IsVerboseEnabled()) {
+                LOG_VERBOSE("#" << std::setw(4) << entry.rank
+                    << " | " << std::setw(20) << std::left << entry.playerName << std::right
+                    << " | Faults: " << std::setw(3) << entry.faults
+                    << " | Time: " << FormatTime(entry.timeMs)
+                    << " | Medal: " << GetMedalName(entry.medal));
+            }
 
-                    if (s_entryCallback) {
-                        s_entryCallback(entry);
-                    }
-                }
-                catch (...) {
-                    LOG_VERBOSE("[Scanner] Error reading entry " << i);
-                }
+            if (s_entryCallback) {
+                s_entryCallback(entry);
             }
         }
 
@@ -476,7 +747,7 @@ namespace LeaderboardScanner {
         int nextStart = s_state.currentPage * 10;
 
         if (nextStart < s_state.totalEntries) {
-            o_SetLeaderboardListRange(context, nextStart, 10);
+            RequestPage(nextStart, 10);
         }
         else {
             LOG_INFO("");
@@ -497,14 +768,13 @@ namespace LeaderboardScanner {
                     LOG_INFO("[Scanner] Loading next track...");
                     LOG_INFO("[Scanner] Track " << (s_currentTrackIndex + 1) << "/" << s_trackQueue.size());
                     LOG_INFO("");
-                    Sleep(1000);  // Wait a moment between scans
-                    ScanTrackById(s_trackQueue[s_currentTrackIndex]);
+                    s_nextTrackPending = true;
                 } else {
                     // All tracks scanned!
                     LOG_INFO("");
                     LOG_INFO("[Scanner] ALL TRACKS SCANNED!");
                     LOG_INFO("[Scanner] Total tracks: " << s_trackQueue.size());
-                    LOG_INFO("[Scanner] Results saved to: " << s_outputPath);
+                    LOG_INFO("[Scanner] Results saved to: " << GetOutputPath());
                     LOG_INFO("");
                     s_trackQueue.clear();
                     s_currentTrackIndex = -1;
@@ -514,21 +784,329 @@ namespace LeaderboardScanner {
         }
     }
 
+    // ============================================================
+    // LOCATE MODE
+    // ============================================================
+
+    // Compare an entry against the locate target using the board ordering (faults, then time)
+    static int CompareToTarget(const LeaderboardEntry& entry) {
+        if (entry.faults != s_locateRequest.targetFaults) {
+            return (entry.faults < s_locateRequest.targetFaults) ? -1 : 1;
+        }
+        if (entry.timeMs != s_locateRequest.targetTimeMs) {
+            return (entry.timeMs < s_locateRequest.targetTimeMs) ? -1 : 1;
+        }
+        return 0;
+    }
+
+    static bool NameMatches(const LeaderboardEntry& entry) {
+        return _stricmp(entry.playerName, s_locateRequest.playerName.c_str()) == 0;
+    }
+
+    static int GetTotalPages() {
+        return (s_state.totalEntries + LOCATE_PAGE_SIZE - 1) / LOCATE_PAGE_SIZE;
+    }
+
+    // One-shot: the callback belongs to the locate that just ended
+    static void FireLocateCallback() {
+        LocateCallback callback = std::move(s_locateCallback);
+        s_locateCallback = nullptr;
+        if (callback) {
+            callback(s_locateResult);
+        }
+    }
+
+    static void RequestLocatePage(int page) {
+        s_locatePage = page;
+        s_locateResult.pagesFetched++;
+        RequestPage(page * LOCATE_PAGE_SIZE, LOCATE_PAGE_SIZE);
+    }
+
+    // Every locate ends here, so whoever is waiting on the callback always hears back.
+    // failure is logged and reported as a failed, not-found result.
+    static void FinishLocate(const char* failure) {
+        s_state.isLocating = false;
+
+        if (failure) {
+            LOG_WARNING("[Scanner] " << failure);
+            s_locateResult.found = false;
+            s_locateResult.failed = true;
+            s_locateResult.position = -1;
+            s_locateResult.neighbours.clear();
+        }
+        else if (s_locateRequest.mode == LocateMode::ByName) {
+            s_locateResult.found = false;
+            for (size_t i = 0; i < s_locateResult.neighbours.size(); i++) {
+                if (NameMatches(s_locateResult.neighbours[i])) {
+                    s_locateResult.found = true;
+                    s_locateResult.position = s_neighbourFirst + (int)i;
+                    break;
+                }
+            }
+        }
+
+        if (failure) {
+            FireLocateCallback();
+            return;
+        }
+
+        LOG_INFO("");
+        LOG_INFO("[Scanner] LOCATE COMPLETE");
+        LOG_INFO("[Scanner] ======================================");
+        if (s_locateResult.found) {
+            LOG_INFO("[Scanner] Position: " << s_locateResult.position << " / " << s_state.totalEntries);
+        } else {
+            LOG_INFO("[Scanner] Player not found: " << s_locateRequest.playerName);
+        }
+        LOG_INFO("[Scanner] Pages fetched: " << s_locateResult.pagesFetched);
+
+        for (const auto& entry : s_locateResult.neighbours) {
+            LOG_INFO("#" << std::setw(4) << entry.rank
+                << " | " << std::setw(20) << std::left << entry.playerName << std::right
+                << " | Faults: " << std::setw(3) << entry.faults
+                << " | Time: " << FormatTime(entry.timeMs)
+                << " | Medal: " << GetMedalName(entry.medal));
+        }
+        LOG_INFO("");
+
+        FireLocateCallback();
+    }
+
+    // Collect [s_neighbourFirst, s_neighbourLast] page by page, reusing the page already loaded
+    static void ContinueNeighbourhood(int loadedPage, const std::vector<LeaderboardEntry>& loadedEntries, int loadedStart) {
+        int lastPage = s_neighbourLast / LOCATE_PAGE_SIZE;
+
+        if (s_neighbourNextPage == loadedPage) {
+            for (size_t i = 0; i < loadedEntries.size(); i++) {
+                int index = loadedStart + (int)i;
+                if (index >= s_neighbourFirst && index <= s_neighbourLast) {
+                    s_locateResult.neighbours.push_back(loadedEntries[i]);
+                }
+            }
+            s_neighbourNextPage++;
+        }
+
+        if (s_neighbourNextPage > lastPage) {
+            FinishLocate();
+            return;
+        }
+
+        RequestLocatePage(s_neighbourNextPage);
+    }
+
+    static void BeginNeighbourhood(int position, int loadedPage, const std::vector<LeaderboardEntry>& loadedEntries, int loadedStart) {
+        int radius = s_locateRequest.neighbourhood;
+        if (s_locateRequest.mode == LocateMode::ByName && radius < LOCATE_PAGE_SIZE) {
+            // Tied times can push the player a few places either way of the hint
+            radius = LOCATE_PAGE_SIZE;
+        }
+
+        s_locateResult.position = position;
+        s_locateResult.found = true;
+        s_neighbourFirst = (std::max)(0, position - radius);
+        s_neighbourLast = (std::min)(s_state.totalEntries - 1, position + radius);
+        s_neighbourNextPage = s_neighbourFirst / LOCATE_PAGE_SIZE;
+        s_locatePhase = LocatePhase::Neighbourhood;
+
+        LOG_VERBOSE("[Scanner] Located position " << position << " - collecting entries "
+            << s_neighbourFirst << " to " << s_neighbourLast);
+
+        ContinueNeighbourhood(loadedPage, loadedEntries, loadedStart);
+    }
+
+    bool StartLocate(const LocateRequest& request) {
+        if (!s_state.capturedContext) {
+            LOG_ERROR("[Scanner] No leaderboard context! Navigate to a leaderboard first.");
+            return false;
+        }
+
+        if (s_state.isScanning || s_state.isLocating) {
+            LOG_WARNING("[Scanner] Scan already in progress");
+            return false;
+        }
+
+        if (request.mode == LocateMode::ByName && request.playerName.empty()) {
+            LOG_ERROR("[Scanner] Player name cannot be empty");
+            return false;
+        }
+
+        int totalEntries = *(int*)((char*)s_state.capturedContext + 0x150);
+        if (totalEntries == 0 || totalEntries > 100000) {
+            LOG_ERROR("[Scanner] Invalid total entries: " << totalEntries);
+            return false;
+        }
+
+        s_state.totalEntries = totalEntries;
+        s_state.isLocating = true;
+        s_locateRequest = request;
+        s_locateResult = LocateResult();
+
+        LOG_INFO("[Scanner] STARTING LEADERBOARD LOCATE");
+        if (request.mode == LocateMode::ByName) {
+            LOG_INFO("[Scanner] Player: " << request.playerName);
+        }
+        if (request.mode == LocateMode::ByTime || request.hasTimeHint) {
+            LOG_INFO("[Scanner] Target: " << request.targetFaults << " faults, " << FormatTime(request.targetTimeMs));
+        }
+        LOG_INFO("[Scanner] Total entries: " << totalEntries);
+        LOG_INFO("[Scanner] ======================================");
+
+        if (request.mode == LocateMode::ByName && !request.hasTimeHint) {
+            // Names aren't ordered, so without a time hint the best we can do is stop at the first match
+            LOG_WARNING("[Scanner] No time hint given - walking pages until the name is found");
+            s_locatePhase = LocatePhase::NameScan;
+            RequestLocatePage(0);
+            return true;
+        }
+
+        s_locatePhase = LocatePhase::Bisect;
+        s_locateLo = 0;
+        s_locateHi = GetTotalPages() - 1;
+        RequestLocatePage((s_locateLo + s_locateHi) / 2);
+        return true;
+    }
+
+    // Process the page requested by the locate state machine
+    void ProcessLocatePage() {
+        if (!s_state.isLocating || !s_state.capturedContext) return;
+
+        void* context = s_state.capturedContext;
+        if (!IsPageReady()) return;
+
+        PageResult page = FinishPage();
+        if (page == PageResult::Retrying) return;
+        if (page == PageResult::GaveUp) {
+            FinishLocate("Locate abandoned - page did not load");
+            return;
+        }
+
+        // Make sure the game actually switched to the requested window
+        int startIndex = *(int*)((char*)context + 0x148);
+        if (startIndex != s_locatePage * LOCATE_PAGE_SIZE) {
+            LOG_WARNING("[Scanner] Page " << s_locatePage << " did not load - requesting again");
+            s_locateResult.pagesFetched--;
+            RequestLocatePage(s_locatePage);
+            return;
+        }
+
+        void* service = GetLeaderboardService();
+        if (!service) {
+            FinishLocate("Locate failed - could not get leaderboard service");
+            return;
+        }
+
+        int pageCount = (std::min)(LOCATE_PAGE_SIZE, s_state.totalEntries - startIndex);
+        int decoded = DecodePage(service, startIndex, pageCount);
+
+        // Reused across pages - entries are plain data, so resizing doesn't allocate once it has grown
+        static std::vector<LeaderboardEntry> entries;
+        entries.resize(decoded);
+        for (int d = 0; d < decoded; d++) {
+            ToEntry(s_pageBuffer[d], entries[d]);
+        }
+
+        if (entries.empty()) {
+            LOG_ERROR("[Scanner] Page " << s_locatePage << " returned no entries");
+            FinishLocate("Locate failed - empty page");
+            return;
+        }
+
+        switch (s_locatePhase) {
+        case LocatePhase::Bisect: {
+            LOG_VERBOSE("[Scanner] Bisect page " << s_locatePage << " [" << s_locateLo << ", " << s_locateHi << "]");
+
+            if (CompareToTarget(entries.front()) > 0) {
+                s_locateHi = s_locatePage - 1;
+            }
+            else if (CompareToTarget(entries.back()) < 0) {
+                s_locateLo = s_locatePage + 1;
+            }
+            else {
+                // Target falls inside this page - position is the first entry not better than it
+                int position = startIndex;
+                while (position - startIndex < (int)entries.size() && CompareToTarget(entries[position - startIndex]) < 0) {
+                    position++;
+                }
+                BeginNeighbourhood(position, s_locatePage, entries, startIndex);
+                return;
+            }
+
+            if (s_locateLo > s_locateHi) {
+                // Target sits between two pages - it ranks at the start of page lo (or after the last entry)
+                int position = (std::min)(s_locateLo * LOCATE_PAGE_SIZE, s_state.totalEntries);
+                BeginNeighbourhood(position, s_locatePage, entries, startIndex);
+                return;
+            }
+
+            RequestLocatePage((s_locateLo + s_locateHi) / 2);
+            break;
+        }
+        case LocatePhase::NameScan: {
+            for (size_t i = 0; i < entries.size(); i++) {
+                if (NameMatches(entries[i])) {
+                    BeginNeighbourhood(startIndex + (int)i, s_locatePage, entries, startIndex);
+                    return;
+                }
+            }
+
+            if (s_locatePage + 1 < GetTotalPages()) {
+                RequestLocatePage(s_locatePage + 1);
+            } else {
+                s_locateResult.found = false;
+                FinishLocate();
+            }
+            break;
+        }
+        case LocatePhase::Neighbourhood:
+            ContinueNeighbourhood(s_locatePage, entries, startIndex);
+            break;
+        }
+    }
+
     void CheckHotkey() {
+        // Page pacing is owned by the governor - just issue whatever it allows
+        PumpPageRequest();
+
+        if (s_autoScanPending) {
+            s_autoScanPending = false;
+            StartScan();
+        }
+
+        if (s_locateQueued) {
+            LocateRequest request;
+            {
+                std::lock_guard<std::mutex> lock(s_queuedLocateMutex);
+                request = s_queuedLocate;
+                if (s_queuedLocateCallback) {
+                    s_locateCallback = std::move(s_queuedLocateCallback);
+                    s_queuedLocateCallback = nullptr;
+                }
+                s_locateQueued = false;
+            }
+            // Whoever queued it is waiting on the callback, so report a locate that couldn't start
+            if (!StartLocate(request)) {
+                s_locateResult = LocateResult();
+                FireLocateCallback();
+            }
+        }
+
+        if (s_nextTrackPending && LeaderboardGovernor::Shared().TryAcquire()) {
+            s_nextTrackPending = false;
+            ScanTrackById(s_trackQueue[s_currentTrackIndex]);
+        }
+
         // If scanning, process pages as they load
         if (s_state.isScanning && s_state.capturedContext) {
-            static int frameDelay = 0;
-            frameDelay++;
+            ProcessCurrentPage();
+        }
 
-            if (frameDelay > 10) { // Wait ~200ms
-                ProcessCurrentPage();
-                frameDelay = 0;
-            }
+        if (s_state.isLocating && s_state.capturedContext) {
+            ProcessLocatePage();
         }
 
         // Use keybindings for scan current leaderboard
         if (Keybindings::IsActionPressed(Keybindings::Action::ScanCurrentLeaderboard)) {
-            if (!s_state.isScanning) {
+            if (!s_state.isScanning && !s_state.isLocating) {
                 StartScan();
             }
             else {
@@ -548,14 +1126,40 @@ namespace LeaderboardScanner {
         static bool f4WasPressed = false;
         bool f4IsPressed = (GetAsyncKeyState(VK_F4) & 0x8000) != 0;
 
+        if (s_analyzeQueued.exchange(false)) {
+            LeaderboardAnalytics::Refresh();
+        }
+
+        std::lock_guard<std::mutex> lock(s_statusMutex);
+        s_status.isScanning = s_state.isScanning;
+        s_status.isLocating = s_state.isLocating;
+        s_status.entries = (int)s_state.allEntries.size();
     }
 
     void SetEntryCallback(EntryCallback callback) {
         s_entryCallback = callback;
     }
 
+    void SetLocateCallback(LocateCallback callback) {
+        s_locateCallback = callback;
+    }
+
+    void QueueLocate(const LocateRequest& request, LocateCallback callback) {
+        std::lock_guard<std::mutex> lock(s_queuedLocateMutex);
+        s_queuedLocate = request;
+        s_queuedLocateCallback = std::move(callback);
+        s_locateQueued = true;
+    }
+
+    const LocateResult& GetLocateResult() {
+        return s_locateResult;
+    }
+
     void SetOutputPath(const std::string& path) {
-        s_outputPath = path;
+        {
+            std::lock_guard<std::mutex> lock(s_outputPathMutex);
+            s_outputPath = path;
+        }
         LOG_INFO("[Scanner] Output path set to: " << path);
     }
 
@@ -567,4 +1171,13 @@ namespace LeaderboardScanner {
         return s_state.allEntries;
     }
 
+    ScanStatus GetStatus() {
+        std::lock_guard<std::mutex> lock(s_statusMutex);
+        return s_status;
+    }
+
+    void QueueAnalyze() {
+        s_analyzeQueued = true;
+    }
+
 }
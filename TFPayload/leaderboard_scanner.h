@@ -6,9 +6,12 @@
 
 namespace LeaderboardScanner {
 
+    // Longest name the decoder accepts (Ubisoft names are at most 15 characters)
+    static const int MAX_PLAYER_NAME_LENGTH = 30;
+
     struct LeaderboardEntry {
         int rank;
-        std::string playerName;
+        char playerName[MAX_PLAYER_NAME_LENGTH + 1];   // Inline so entries copy without allocating
         int faults;
         int timeMs;
         int medal;
@@ -17,10 +20,37 @@ namespace LeaderboardScanner {
     // Callback type for each leaderboard entry
     using EntryCallback = std::function<void(const LeaderboardEntry& entry)>;
 
+    // Locate mode - bisects the board instead of scanning every page
+    // Boards are ordered by faults first, then time, so ByTime compares (faults, timeMs)
+    enum class LocateMode {
+        ByTime,     // Find where targetFaults/targetTimeMs would rank
+        ByName      // Find a player's entry (bisects on the time hint if one is given)
+    };
+
+    struct LocateRequest {
+        LocateMode mode = LocateMode::ByTime;
+        int targetFaults = 0;
+        int targetTimeMs = 0;
+        std::string playerName;
+        bool hasTimeHint = false;       // ByName only: bisect on targetFaults/targetTimeMs first
+        int neighbourhood = 5;          // Entries to capture on each side of the result
+    };
+
+    struct LocateResult {
+        bool found = false;
+        bool failed = false;            // Stopped, or a page could not be loaded
+        int position = -1;              // Board index of the match / insertion point
+        int pagesFetched = 0;
+        std::vector<LeaderboardEntry> neighbours;
+    };
+
+    using LocateCallback = std::function<void(const LocateResult& result)>;
+
     // Scanner state
     struct ScannerState {
         void* capturedContext = nullptr;
         bool isScanning = false;
+        bool isLocating = false;
         int currentPage = 0;
         int totalEntries = 0;
         std::vector<LeaderboardEntry> allEntries;
@@ -39,6 +69,20 @@ namespace LeaderboardScanner {
     // Stop scanning
     void StopScan();
 
+    // Locate a time or player on the current leaderboard in O(log n) pages
+    bool StartLocate(const LocateRequest& request);
+
+    // Set callback for when a locate completes, fails or is stopped (called once, then cleared)
+    void SetLocateCallback(LocateCallback callback);
+
+    // Any thread - the locate starts from the next CheckHotkey tick, with callback (if set)
+    // replacing the locate callback. A locate that can't start reports an empty result
+    // (pagesFetched == 0). For callers outside the key monitor thread, e.g. the DevMenu
+    void QueueLocate(const LocateRequest& request, LocateCallback callback);
+
+    // Get the result of the last locate
+    const LocateResult& GetLocateResult();
+
     // Save current scan to file
     void SaveToFile();
 
@@ -48,16 +92,32 @@ namespace LeaderboardScanner {
     // Set callback for processing each entry
     void SetEntryCallback(EntryCallback callback);
 
-    // Set output file path
+    // Set output file path (any thread; scans are appended to it)
     void SetOutputPath(const std::string& path);
 
-    // Get current scanner state
+    // Get current scanner state (key monitor thread only - other threads use GetStatus)
     const ScannerState& GetState();
 
+    // Any thread - scanner progress, published at the end of every CheckHotkey tick
+    struct ScanStatus {
+        bool isScanning = false;
+        bool isLocating = false;
+        int entries = 0;                // Entries scanned so far
+    };
+    ScanStatus GetStatus();
+
+    // Any thread - run LeaderboardAnalytics::Refresh on the next CheckHotkey tick, where the
+    // scanned entries can't change underneath it
+    void QueueAnalyze();
+
     // Check if F1 was pressed and trigger scan
     void CheckHotkey();
 
-    // Get all scanned entries
+    // Get all scanned entries (key monitor thread only)
     const std::vector<LeaderboardEntry>& GetAllEntries();
 
+    // Format helpers shared with the analytics export
+    std::string FormatTime(int timeMs);
+    std::string GetMedalName(int medal);
+
 } // namespace LeaderboardScanner
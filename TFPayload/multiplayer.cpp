@@ -3,8 +3,16 @@
 #include "multiplayer.h"
 #include "logging.h"
 #include "keybindings.h"
+#include "packet_capture.h"
+#include "session_log.h"
+#include "session_timeline.h"
+#include "hook_latency.h"
+#include "network_stats.h"
+#include "respawn.h"
 #include <MinHook.h>
+#include <atomic>
 #include <chrono>
+#include <ctime>
 #include <sstream>
 #include <iomanip>
 #include <mutex>
@@ -15,13 +23,62 @@ namespace Multiplayer {
     static bool g_SessionLoggingEnabled = true;
     static DWORD_PTR g_BaseAddress = 0;
     
-    // Statistics
-    static Stats g_Stats = {};
-    static std::mutex g_StatsMutex;
+    // Statistics (updated from game threads without locking)
+    struct AtomicStats {
+        std::atomic<uint32_t> totalPacketsReceived{ 0 };
+        std::atomic<uint32_t> totalPacketsSent{ 0 };
+        std::atomic<uint32_t> sessionCount{ 0 };
+        std::atomic<uint32_t> playerStateUpdates{ 0 };
+        std::atomic<uint64_t> totalBytesReceived{ 0 };
+        std::atomic<uint64_t> totalBytesSent{ 0 };
+    };
+    static AtomicStats g_Stats;
+    
+    // Duration of the original call inside the per-frame network hooks (TSC ticks)
+    static HookLatency::Histogram g_ProcessNetworkPacketsLatency;
+    static HookLatency::Histogram g_UpdateMultiplayerStateLatency;
+    
+    // The two per-frame hooks above are created at startup but only enabled on request
+    // (DevMenu Network Overlay), since they sit on the hottest path in the game
+    static bool g_LatencyHooksEnabled = false;
+    static DWORD_PTR g_ProcessNetworkPacketsAddr = 0;
+    static DWORD_PTR g_UpdateMultiplayerStateAddr = 0;
+    
+    // HandleNetworkPacket feeds PacketCapture and NetworkStats; opt-in like the latency hooks
+    // (DevMenu Network Dashboard)
+    static bool g_PacketHookEnabled = false;
+    static DWORD_PTR g_HandleNetworkPacketAddr = 0;
+    
+    // Sender of a received packet: read from the packet at this offset once SetPacketSenderOffset()
+    // maps it, until then numbered by the connection object the packet arrived on (1, 2, ...)
+    static std::atomic<uint32_t> g_PacketSenderOffset{ 0 };
+    static const int MAX_PACKET_CONNECTIONS = 16;
+    static void* g_PacketConnections[MAX_PACKET_CONNECTIONS] = {};     // Network thread only
+    static int g_PacketConnectionCount = 0;
+    
+    // All output files go here (see SetOutputDirectory)
+    static std::string g_OutputDirectory = "F:/";
+    static std::mutex g_OutputDirectoryMutex;
+    static std::string g_QueuedOutputDirectory;             // Under g_OutputDirectoryMutex
+    static std::atomic<bool> g_OutputDirectoryQueued{ false };
+    
+    // Session events are batched to this file by SessionLog's writer thread
+    static const char* SESSION_LOG_FILE = "mp_session_log.txt";
+    
+    // Packets are streamed to this file by PacketCapture's writer thread
+    // (binary .tfcap - read it with tools/packet_analyzer)
+    static const char* PACKET_CAPTURE_FILE = "mp_packets.tfcap";
+    
+    // Session-level hooks also emit typed events to this file (binary .tftl - read it with
+    // tools/session_timeline). Race state changes are polled from the key monitor loop (every
+    // ~80 ms, whether or not the opt-in hooks are on) so the tool can tell loading, racing and
+    // the results screen apart. Each start opens a new timestamped file so earlier sessions
+    // are kept.
+    static const char* SESSION_TIMELINE_FILE_FORMAT = "mp_timeline_%Y%m%d_%H%M%S.tftl";
+    static uint32_t g_LastGameState = 0xFFFFFFFF;           // Key monitor thread only
     
     // Logged data
     static std::vector<SessionInfo> g_SessionHistory;
-    static std::vector<NetworkPacketInfo> g_PacketLog;
     static std::vector<PlayerStateInfo> g_PlayerStates;
     static std::mutex g_LogMutex;
     
@@ -131,11 +188,12 @@ namespace Multiplayer {
     }
     
     static std::string GetTimestampString() {
-        auto now = std::chrono::system_clock::now();
-        auto time = std::chrono::system_clock::to_time_t(now);
-        std::stringstream ss;
-        ss << std::put_time(std::localtime(&time), "%Y-%m-%d %H:%M:%S");
-        return ss.str();
+        return SessionLog::GetTimestampString();
+    }
+    
+    static std::string GetOutputPath(const char* fileName) {
+        std::lock_guard<std::mutex> lock(g_OutputDirectoryMutex);
+        return g_OutputDirectory + fileName;
     }
     
     static void LogSessionEvent(const std::string& event, const std::string& details = "") {
@@ -144,43 +202,29 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-SESSION] [" << GetTimestampString() << "] " << event 
             << (details.empty() ? "" : ": " + details));
         
-        // Also write to dedicated session log file
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[" << GetTimestampString() << "] " << event;
-            if (!details.empty()) {
-                logFile << ": " << details;
-            }
-            logFile << std::endl;
-            logFile.close();
-        }
+        // Also queue for the dedicated session log file (written by SessionLog's thread)
+        SESSION_LOG(event << (details.empty() ? "" : ": ") << details);
     }
     
-    static void LogPacket(const std::string& direction, uint32_t type, uint32_t size, void* data = nullptr) {
+    static void LogPacket(PacketCapture::Direction direction, uint32_t type, uint32_t size, uint32_t sourcePlayerId, void* data) {
         if (!g_PacketLoggingEnabled) return;
         
-        std::lock_guard<std::mutex> lock(g_StatsMutex);
-        if (direction == "RECV") {
-            g_Stats.totalPacketsReceived++;
-            g_Stats.totalBytesReceived += size;
+        if (direction == PacketCapture::Direction::Recv) {
+            g_Stats.totalPacketsReceived.fetch_add(1, std::memory_order_relaxed);
+            g_Stats.totalBytesReceived.fetch_add(size, std::memory_order_relaxed);
         } else {
-            g_Stats.totalPacketsSent++;
-            g_Stats.totalBytesSent += size;
+            g_Stats.totalPacketsSent.fetch_add(1, std::memory_order_relaxed);
+            g_Stats.totalBytesSent.fetch_add(size, std::memory_order_relaxed);
         }
         
-        LOG_VERBOSE("[MP-PACKET] " << direction << " Type: 0x" << std::hex << type 
-            << " Size: " << std::dec << size << " bytes");
+        LOG_VERBOSE("[MP-PACKET] " << (direction == PacketCapture::Direction::Recv ? "RECV" : "SEND")
+            << " Type: 0x" << std::hex << type << " Size: " << std::dec << size << " bytes From: " << sourcePlayerId);
         
-        // Store packet info if we want detailed analysis
-        if (data && g_PacketLog.size() < 10000) { // Limit to prevent memory issues
-            NetworkPacketInfo packet;
-            packet.packetType = type;
-            packet.packetSize = size;
-            packet.timestamp = GetTimestamp();
-            // We could copy data here if needed
-            std::lock_guard<std::mutex> lock(g_LogMutex);
-            g_PacketLog.push_back(packet);
-        }
+        // Record + bounded payload copy into the capture ring; the writer thread does the I/O
+        PacketCapture::Capture(direction, type, size, sourcePlayerId, 0, data);
+        
+        // Rolling rates for the DevMenu network dashboard
+        NetworkStats::Record(type, size, sourcePlayerId);
     }
     
     // Helper function for safe memory reading (no C++ objects with destructors)
@@ -206,6 +250,36 @@ namespace Multiplayer {
         return false;
     }
     
+    // Race state (DAT_0174b308 -> +0xdc game manager -> +0x08), as read by ActionScript::CallHandleRaceFinish
+    static bool TryReadGameState(uint32_t* state) {
+        unsigned char buffer[4];
+        DWORD_PTR globals = g_BaseAddress + (0x0174b308 - 0x700000);
+        if (!TryReadMemory(globals, buffer, 4)) return false;
+        DWORD_PTR gameBase = *(uint32_t*)buffer;
+        if (!gameBase || !TryReadMemory(gameBase + 0xdc, buffer, 4)) return false;
+        DWORD_PTR gameManager = *(uint32_t*)buffer;
+        if (!gameManager || !TryReadMemory(gameManager + 0x08, buffer, 4)) return false;
+        *state = *(uint32_t*)buffer;
+        return true;
+    }
+    
+    static void PollGameState() {
+        if (!SessionTimeline::IsRunning()) return;
+        uint32_t state;
+        if (!TryReadGameState(&state) || state == g_LastGameState) return;
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_GAME_STATE, state, g_LastGameState);
+        g_LastGameState = state;
+    }
+    
+    static std::string GetTimelinePath() {
+        char fileName[64];
+        time_t now = time(nullptr);
+        struct tm local;
+        localtime_s(&local, &now);
+        strftime(fileName, sizeof(fileName), SESSION_TIMELINE_FILE_FORMAT, &local);
+        return GetOutputPath(fileName);
+    }
+
     // === HOOK FUNCTIONS ===
     
     void* __fastcall Hook_MultiplayerServiceConstructor(void* thisPtr, void* edx, void* param1, void* param2, void* param3) {
@@ -226,14 +300,14 @@ namespace Multiplayer {
     
     void __fastcall Hook_InitializeMultiplayerSession() {
         LogSessionEvent("InitializeMultiplayerSession CALLED", "Creating new multiplayer session");
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_SESSION_INITIALIZED);
         
         // Update session state
         g_InSession = true;
         g_CurrentSession.timestamp = GetTimestamp();
         g_CurrentSession.sessionId = static_cast<uint32_t>(GetTimestamp() & 0xFFFFFFFF);
         
-        std::lock_guard<std::mutex> lock(g_StatsMutex);
-        g_Stats.sessionCount++;
+        g_Stats.sessionCount.fetch_add(1, std::memory_order_relaxed);
         
         // Call original
         g_OriginalInitializeMultiplayerSession();
@@ -281,18 +355,34 @@ namespace Multiplayer {
             LOG_VERBOSE("[MP-NETWORK] ProcessNetworkPackets called " << callCount << " times");
         }
         
-        // Call original
+        // Call original (timed)
+        uint64_t start = HookLatency::ReadTsc();
         g_OriginalProcessNetworkPackets(thisPtr, edx);
+        g_ProcessNetworkPacketsLatency.Record(HookLatency::ReadTsc() - start);
+    }
+    
+    // Sender id of a received packet (see g_PacketSenderOffset), 0 if it can't be told
+    static uint32_t DecodePacketSender(void* connection, void* packet) {
+        uint32_t offset = g_PacketSenderOffset.load(std::memory_order_relaxed);
+        if (offset != 0) {
+            uint32_t sender = 0;
+            TryReadMemory((DWORD_PTR)packet + offset, (unsigned char*)&sender, sizeof(sender));
+            return sender;
+        }
+        
+        for (int i = 0; i < g_PacketConnectionCount; i++) {
+            if (g_PacketConnections[i] == connection) return (uint32_t)i + 1;
+        }
+        if (g_PacketConnectionCount == MAX_PACKET_CONNECTIONS) return 0;
+        g_PacketConnections[g_PacketConnectionCount++] = connection;
+        return (uint32_t)g_PacketConnectionCount;
     }
     
     void __fastcall Hook_HandleNetworkPacket(void* thisPtr, void* edx, void* packet) {
-        if (packet) {
-            // Try to read packet header
-            uint32_t* packetData = static_cast<uint32_t*>(packet);
-            uint32_t packetType = packetData[0];
-            uint32_t packetSize = packetData[1];
-            
-            LogPacket("RECV", packetType, packetSize, packet);
+        // Packet header: type, size
+        uint32_t header[2];
+        if (packet && TryReadMemory((DWORD_PTR)packet, (unsigned char*)header, sizeof(header))) {
+            LogPacket(PacketCapture::Direction::Recv, header[0], header[1], DecodePacketSender(thisPtr, packet), packet);
         }
         
         // Call original
@@ -307,12 +397,14 @@ namespace Multiplayer {
             LogSessionEvent("UpdateMultiplayerState", 
                 "Update count: " + std::to_string(updateCount));
             
-            std::lock_guard<std::mutex> lock(g_StatsMutex);
-            g_Stats.playerStateUpdates = updateCount;
+            g_Stats.playerStateUpdates.store(updateCount, std::memory_order_relaxed);
         }
         
-        // Call original
+        // Call original (timed)
+        uint64_t start = HookLatency::ReadTsc();
         g_OriginalUpdateMultiplayerState(thisPtr, edx);
+        g_UpdateMultiplayerStateLatency.Record(HookLatency::ReadTsc() - start);
+        
     }
     
     void __fastcall Hook_PrepareAndLoadMultiplayerMenu(int param_1, void* edx) {
@@ -322,11 +414,8 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-HOOK] param_1: 0x" << std::hex << param_1);
         
         // Log to file
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[PrepareAndLoadMultiplayerMenu] CLICKED MULTIPLAYER!" << std::endl;
-            logFile.close();
-        }
+        SESSION_LOG("[PrepareAndLoadMultiplayerMenu] CLICKED MULTIPLAYER!");
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_MENU_OPENED);
         
         // Call original
         if (g_OriginalPrepareAndLoadMultiplayerMenu) {
@@ -350,10 +439,8 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-HOOK] param_1: 0x" << std::hex << param_1);
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[SendStartLiveQuickGameMessage] RANKED MATCH STARTED" << std::endl;
-        }
+        SESSION_LOG("[SendStartLiveQuickGameMessage] RANKED MATCH STARTED");
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_RANKED_REQUESTED);
     }
     
     void __fastcall Hook_SendCreatePrivateRaceMessage(int param_1, void* edx) {
@@ -368,10 +455,8 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-HOOK] param_1: 0x" << std::hex << param_1);
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[SendCreatePrivateRaceMessage] PRIVATE MATCH CREATED" << std::endl;
-        }
+        SESSION_LOG("[SendCreatePrivateRaceMessage] PRIVATE MATCH CREATED");
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_PRIVATE_CREATED);
     }
     
     void __fastcall Hook_SendStartPrivateRaceMessage(int param_1, void* edx) {
@@ -387,10 +472,8 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-HOOK] param_1: 0x" << std::hex << param_1);
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[SendStartPrivateRaceMessage] PRIVATE RACE STARTED" << std::endl;
-        }
+        SESSION_LOG("[SendStartPrivateRaceMessage] PRIVATE RACE STARTED");
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_PRIVATE_STARTED);
     }
     
     void __fastcall Hook_start_matchmaking(void* thisPtr, void* edx, unsigned int param_1, int* param_2) {
@@ -406,10 +489,8 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-HOOK] param_1: " << std::dec << param_1);
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[start_matchmaking] MATCHMAKING STARTED" << std::endl;
-        }
+        SESSION_LOG("[start_matchmaking] MATCHMAKING STARTED");
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_MATCHMAKING_STARTED);
     }
     
     void __fastcall Hook_HandleMultiplayerLobbyStart(void* thisPtr, void* edx, char param_1) {
@@ -425,10 +506,8 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-HOOK] param_1 (mode/state): " << std::dec << (int)param_1);
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[HandleMultiplayerLobbyStart] Mode/State: " << (int)param_1 << std::endl;
-        }
+        SESSION_LOG("[HandleMultiplayerLobbyStart] Mode/State: " << (int)param_1);
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_LOBBY_START, (uint32_t)(uint8_t)param_1);
     }
     
     void __fastcall Hook_BroadcastGameStartToPlayers(int param_1, void* edx) {
@@ -444,10 +523,8 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-HOOK] param_1 (game state ptr): 0x" << std::hex << param_1);
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[BroadcastGameStartToPlayers] RACE LAUNCH!" << std::endl;
-        }
+        SESSION_LOG("[BroadcastGameStartToPlayers] RACE LAUNCH!");
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_GAME_START_BROADCAST);
     }
     
     void __fastcall Hook_SendMoveToLiveLobbyMessage(int param_1, void* edx) {
@@ -463,10 +540,8 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-HOOK] param_1: 0x" << std::hex << param_1);
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[SendMoveToLiveLobbyMessage] ONLINE LOBBY" << std::endl;
-        }
+        SESSION_LOG("[SendMoveToLiveLobbyMessage] ONLINE LOBBY");
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_LOBBY_ONLINE);
     }
     
     void __cdecl Hook_MoveToLocalMultiplayerLobby(void) {
@@ -481,10 +556,8 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-HOOK] User selected local/splitscreen multiplayer!");
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[MoveToLocalMultiplayerLobby] LOCAL LOBBY" << std::endl;
-        }
+        SESSION_LOG("[MoveToLocalMultiplayerLobby] LOCAL LOBBY");
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_LOBBY_LOCAL);
     }
     
     void __fastcall Hook_SetMultiplayerMode(void* thisPtr, void* edx, char mode) {
@@ -525,14 +598,8 @@ namespace Multiplayer {
             LOG_VERBOSE("[MP-HOOK] Mode: " << modeStr << " " << modeDesc);
             
             // Simple logging only - no complex operations
-            std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-            if (logFile.is_open()) {
-                logFile << "[SetMultiplayerMode] " << modeStr << " (" << (int)mode << ")" << std::endl;
-                logFile.close();
-                LOG_VERBOSE("[MP-HOOK] Logged to file successfully");
-            } else {
-                LOG_ERROR("[MP-HOOK] Failed to open log file!");
-            }
+            SESSION_LOG("[SetMultiplayerMode] " << modeStr << " (" << (int)mode << ")");
+            SessionTimeline::Record(SessionTimelineFormat::EVENT_MULTIPLAYER_MODE, (uint32_t)(uint8_t)mode);
         }
         catch (...) {
             LOG_ERROR("[MP-HOOK] Exception in logging code!");
@@ -545,6 +612,7 @@ namespace Multiplayer {
         LogSessionEvent("NotifyNetworkEvent",
             "Type: 0x" + std::to_string(eventType) + 
             " Data: 0x" + std::to_string((uintptr_t)eventData));
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_NETWORK, eventType);
         
         // Call original
         g_OriginalNotifyNetworkEvent(thisPtr, edx, eventType, eventData);
@@ -585,11 +653,8 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-HOOK] thisPtr: 0x" << std::hex << (uintptr_t)thisPtr);
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[SetMultiplayerJoinMode] Mode: " << mode << " = " << modeStr << ", param_2: " << (int)param_2 << std::endl;
-            logFile.close();
-        }
+        SESSION_LOG("[SetMultiplayerJoinMode] Mode: " << mode << " = " << modeStr << ", param_2: " << (int)param_2);
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_JOIN_MODE, (uint32_t)mode, (uint32_t)(uint8_t)param_2);
     }
     
     // Hook for StartRace - the actual race launch function
@@ -608,11 +673,8 @@ namespace Multiplayer {
         }
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[StartRace] RACE LAUNCHING! param_1: 0x" << std::hex << (uintptr_t)param_1 << std::endl;
-            logFile.close();
-        }
+        SESSION_LOG("[StartRace] RACE LAUNCHING! param_1: 0x" << std::hex << (uintptr_t)param_1);
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_START_RACE);
         
         // Call original
         if (g_OriginalStartRace) {
@@ -631,11 +693,8 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-HOOK] param_1: 0x" << std::hex << param_1);
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[StartGameOrReturnToLobby] MULTIPLAYER RACE LOADING!" << std::endl;
-            logFile.close();
-        }
+        SESSION_LOG("[StartGameOrReturnToLobby] MULTIPLAYER RACE LOADING!");
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_RACE_LOADING, param_1);
         
         // Call original
         if (g_OriginalStartGameOrReturnToLobby) {
@@ -652,11 +711,8 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-HOOK] ========================================");
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[handle_game_start_by_mode] from_invite: " << (int)param_1 << std::endl;
-            logFile.close();
-        }
+        SESSION_LOG("[handle_game_start_by_mode] from_invite: " << (int)param_1);
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_GAME_START_BY_MODE, (uint32_t)(uint8_t)param_1);
         
         // Call original
         if (g_Original_handle_game_start_by_mode) {
@@ -675,15 +731,14 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-HOOK] param_5: " << (int)param_5);
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[LoadAndStartRace] RACE STARTING! param_2=" << param_2 << std::endl;
-            logFile.close();
-        }
+        SESSION_LOG("[LoadAndStartRace] RACE STARTING! param_2=" << param_2);
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_LOAD_AND_START, (uint32_t)param_2);
         
         // Call original
         if (g_OriginalLoadAndStartRace) {
-            return g_OriginalLoadAndStartRace(thisPtr, edx, param_1, param_2, param_3, param_4, param_5);
+            char result = g_OriginalLoadAndStartRace(thisPtr, edx, param_1, param_2, param_3, param_4, param_5);
+            SessionTimeline::Record(SessionTimelineFormat::EVENT_LOAD_AND_START_RETURNED, (uint32_t)(uint8_t)result);
+            return result;
         }
         return 0;
     }
@@ -799,15 +854,9 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-HOOK] ========================================");
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[StartMultiplayerSession] Call #" << callCount;
-            if (callCount == 2) {
-                logFile << " - RACE STARTING!";
-            }
-            logFile << std::endl;
-            logFile.close();
-        }
+        SESSION_LOG("[StartMultiplayerSession] Call #" << callCount
+            << (callCount == 2 ? " - RACE STARTING!" : ""));
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_MULTIPLAYER_SESSION_START, (uint32_t)callCount);
         
         // Call original
         if (g_OriginalStartMultiplayerSession) {
@@ -833,6 +882,7 @@ namespace Multiplayer {
             // Store it anyway in case this is actually the session ID
             g_CurrentSession.sessionId = param_2;
             g_InSession = true;
+            SessionTimeline::Record(SessionTimelineFormat::EVENT_SESSION_CREATED, param_2);
             
             // Call original and return
             if (g_OriginalHandleSessionCreateEvent) {
@@ -872,11 +922,8 @@ namespace Multiplayer {
         g_CurrentSession.sessionId = session_id;
         g_InSession = true;
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[HandleSessionCreateEvent] SESSION ID: 0x" << std::hex << session_id << std::endl;
-            logFile.close();
-        }
+        SESSION_LOG("[HandleSessionCreateEvent] SESSION ID: 0x" << std::hex << session_id);
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_SESSION_CREATED, session_id);
         
         // Call original
         if (g_OriginalHandleSessionCreateEvent) {
@@ -900,11 +947,8 @@ namespace Multiplayer {
         LOG_VERBOSE("[SESSION-JOIN] ===============================");
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[HandleSessionJoinRequest] JOINING SESSION: 0x" << std::hex << target_session_id << std::endl;
-            logFile.close();
-        }
+        SESSION_LOG("[HandleSessionJoinRequest] JOINING SESSION: 0x" << std::hex << target_session_id);
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_SESSION_JOIN, target_session_id);
         
         // Call original
         if (g_OriginalHandleSessionJoinRequest) {
@@ -924,11 +968,8 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP-HOOK] param_1: " << (int)param_1);
         LOG_VERBOSE("");
         
-        std::ofstream logFile("F:/mp_session_log.txt", std::ios::app);
-        if (logFile.is_open()) {
-            logFile << "[HandleMultiplayerLobbyStart2] LOBBY->RACE! param_1: " << (int)param_1 << std::endl;
-            logFile.close();
-        }
+        SESSION_LOG("[HandleMultiplayerLobbyStart2] LOBBY->RACE! param_1: " << (int)param_1);
+        SessionTimeline::Record(SessionTimelineFormat::EVENT_LOBBY_TO_RACE, (uint32_t)(uint8_t)param_1);
         
         // Call original
         if (g_OriginalHandleMultiplayerLobbyStart2) {
@@ -1254,6 +1295,46 @@ namespace Multiplayer {
             LOG_ERROR("[MP] ✗ Failed to hook HandleSessionJoinRequest: " << MH_StatusToString(status));
         }
         
+        // Per-frame network hooks - only instrumented for latency, see GetHookLatencies()
+        // Created disabled; SetLatencyHooksEnabled() turns them on
+        HookLatency::Calibrate();
+        LOG_VERBOSE("[MP] Creating ProcessNetworkPackets hook (opt-in)...");
+        status = MH_CreateHook(
+            (LPVOID)processNetworkPacketsAddr,
+            (LPVOID)&Hook_ProcessNetworkPackets,
+            (LPVOID*)&g_OriginalProcessNetworkPackets
+        );
+        if (status == MH_OK) {
+            g_ProcessNetworkPacketsAddr = processNetworkPacketsAddr;
+        } else {
+            LOG_ERROR("[MP] ✗ Failed to hook ProcessNetworkPackets: " << MH_StatusToString(status));
+        }
+        
+        LOG_VERBOSE("[MP] Creating UpdateMultiplayerState hook (opt-in)...");
+        status = MH_CreateHook(
+            (LPVOID)updateMultiplayerStateAddr,
+            (LPVOID)&Hook_UpdateMultiplayerState,
+            (LPVOID*)&g_OriginalUpdateMultiplayerState
+        );
+        if (status == MH_OK) {
+            g_UpdateMultiplayerStateAddr = updateMultiplayerStateAddr;
+        } else {
+            LOG_ERROR("[MP] ✗ Failed to hook UpdateMultiplayerState: " << MH_StatusToString(status));
+        }
+        
+        // Received packets - created disabled; SetPacketHookEnabled() turns it on
+        LOG_VERBOSE("[MP] Creating HandleNetworkPacket hook (opt-in)...");
+        status = MH_CreateHook(
+            (LPVOID)handleNetworkPacketAddr,
+            (LPVOID)&Hook_HandleNetworkPacket,
+            (LPVOID*)&g_OriginalHandleNetworkPacket
+        );
+        if (status == MH_OK) {
+            g_HandleNetworkPacketAddr = handleNetworkPacketAddr;
+        } else {
+            LOG_ERROR("[MP] ✗ Failed to hook HandleNetworkPacket: " << MH_StatusToString(status));
+        }
+        
         // TEST 2: SetMultiplayerMode (ADDRESS VERIFIED - ENABLING HOOK)
         LOG_VERBOSE("[MP] SetMultiplayerMode address: 0x" << std::hex << setMultiplayerModeAddr);
         LOG_VERBOSE("[MP] Checking if address is valid...");
@@ -1286,10 +1367,14 @@ namespace Multiplayer {
             LOG_ERROR("[MP] This means the address calculation is wrong.");
         }
         
+        SessionLog::Start(GetOutputPath(SESSION_LOG_FILE));
+        PacketCapture::Start(GetOutputPath(PACKET_CAPTURE_FILE));
+        SessionTimeline::Start(GetTimelinePath());
+        
         LOG_VERBOSE("[MP] === Multiplayer monitoring initialized ===");
-        LOG_VERBOSE("[MP] Hooks enabled: " << hooksEnabled << "/15");
+        LOG_VERBOSE("[MP] Hooks enabled: " << hooksEnabled << "/15 (+2 latency hooks and the packet hook, off until enabled)");
         if (hooksEnabled > 0) {
-            LOG_INFO("[MP] Session events will be logged to: F:/mp_session_log.txt");
+            LOG_INFO("[MP] Session events will be logged to: " << GetOutputPath(SESSION_LOG_FILE));
             LOG_INFO("[MP] Press M to save all captured data");
         } else {
             LOG_WARNING("[MP] No hooks enabled - running in passive mode");
@@ -1304,6 +1389,9 @@ namespace Multiplayer {
         
         // Save all logs before shutdown
         SaveLogs();
+        PacketCapture::Stop();
+        SessionLog::Stop();
+        SessionTimeline::Stop();
         
         // Disable all hooks
         if (g_OriginalMultiplayerServiceConstructor) {
@@ -1323,6 +1411,48 @@ namespace Multiplayer {
         LOG_VERBOSE("[MP] Session logging " << (enabled ? "ENABLED" : "DISABLED"));
     }
     
+    void SetOutputDirectory(const std::string& directory) {
+        std::string normalized = directory;
+        if (!normalized.empty() && normalized.back() != '/' && normalized.back() != '\\') {
+            normalized += '/';
+        }
+        if (normalized == GetOutputDirectory()) return;
+        
+        if (!normalized.empty()) {
+            CreateDirectoryA(normalized.c_str(), NULL);
+        }
+        {
+            std::lock_guard<std::mutex> lock(g_OutputDirectoryMutex);
+            g_OutputDirectory = normalized;
+        }
+        LOG_INFO("[MP] Output directory: " << (normalized.empty() ? "(working directory)" : normalized));
+        
+        // Reopen the streaming files in the new location
+        if (SessionLog::IsRunning()) {
+            SessionLog::Stop();
+            SessionLog::Start(GetOutputPath(SESSION_LOG_FILE));
+        }
+        if (PacketCapture::IsRunning()) {
+            PacketCapture::Stop();
+            PacketCapture::Start(GetOutputPath(PACKET_CAPTURE_FILE));
+        }
+        if (SessionTimeline::IsRunning()) {
+            SessionTimeline::Stop();
+            SessionTimeline::Start(GetTimelinePath());
+        }
+    }
+    
+    std::string GetOutputDirectory() {
+        std::lock_guard<std::mutex> lock(g_OutputDirectoryMutex);
+        return g_OutputDirectory;
+    }
+    
+    void QueueOutputDirectory(const std::string& directory) {
+        std::lock_guard<std::mutex> lock(g_OutputDirectoryMutex);
+        g_QueuedOutputDirectory = directory;
+        g_OutputDirectoryQueued = true;
+    }
+    
     SessionInfo GetCurrentSession() {
         return g_CurrentSession;
     }
@@ -1336,7 +1466,7 @@ namespace Multiplayer {
         
         // Save session history
         {
-            std::ofstream sessionFile("F:/mp_sessions.csv");
+            std::ofstream sessionFile(GetOutputPath("mp_sessions.csv"));
             if (sessionFile.is_open()) {
                 sessionFile << "SessionID,Timestamp,IsHost,PlayerCount,MaxPlayers,GameMode\n";
                 
@@ -1354,42 +1484,65 @@ namespace Multiplayer {
             }
         }
         
-        // Save packet log
-        {
-            std::ofstream packetFile("F:/mp_packets.csv");
-            if (packetFile.is_open()) {
-                packetFile << "PacketType,Size,SourcePlayer,DestPlayer,Timestamp\n";
-                
-                std::lock_guard<std::mutex> lock(g_LogMutex);
-                for (const auto& packet : g_PacketLog) {
-                    packetFile << std::hex << packet.packetType << std::dec << ","
-                              << packet.packetSize << ","
-                              << packet.sourcePlayerId << ","
-                              << packet.destPlayerId << ","
-                              << packet.timestamp << "\n";
-                }
-                packetFile.close();
-                LOG_VERBOSE("[MP] Saved " << g_PacketLog.size() << " packets to mp_packets.csv");
+        // Packets are already streaming to disk - just make sure the writer has caught up
+        if (PacketCapture::IsRunning()) {
+            if (PacketCapture::Flush()) {
+                LOG_VERBOSE("[MP] Packet capture flushed to " << GetOutputPath(PACKET_CAPTURE_FILE));
+            } else {
+                LOG_WARNING("[MP] Packet capture flush timed out");
             }
         }
+        if (SessionLog::IsRunning() && !SessionLog::Flush()) {
+            LOG_WARNING("[MP] Session log flush timed out");
+        }
+        SessionTimeline::Pump();
         
         // Save statistics
         {
-            std::ofstream statsFile("F:/mp_stats.txt");
+            std::ofstream statsFile(GetOutputPath("mp_stats.txt"));
             if (statsFile.is_open()) {
-                std::lock_guard<std::mutex> lock(g_StatsMutex);
+                Stats stats = GetStats();
+                PacketCapture::Stats capture = PacketCapture::GetStats();
                 statsFile << "=== MULTIPLAYER STATISTICS ===\n";
-                statsFile << "Total Sessions: " << g_Stats.sessionCount << "\n";
-                statsFile << "Total Packets Received: " << g_Stats.totalPacketsReceived << "\n";
-                statsFile << "Total Packets Sent: " << g_Stats.totalPacketsSent << "\n";
-                statsFile << "Total Bytes Received: " << g_Stats.totalBytesReceived << "\n";
-                statsFile << "Total Bytes Sent: " << g_Stats.totalBytesSent << "\n";
-                statsFile << "Player State Updates: " << g_Stats.playerStateUpdates << "\n";
+                statsFile << "Total Sessions: " << stats.sessionCount << "\n";
+                statsFile << "Total Packets Received: " << stats.totalPacketsReceived << "\n";
+                statsFile << "Total Packets Sent: " << stats.totalPacketsSent << "\n";
+                statsFile << "Total Bytes Received: " << stats.totalBytesReceived << "\n";
+                statsFile << "Total Bytes Sent: " << stats.totalBytesSent << "\n";
+                statsFile << "Player State Updates: " << stats.playerStateUpdates << "\n";
+                statsFile << "Packets Captured: " << capture.captured << "\n";
+                statsFile << "Packets Dropped (capture full): " << capture.dropped << "\n";
+                statsFile << "Payloads Truncated: " << capture.truncated << "\n";
+                statsFile << "Session Log Lines Dropped: " << SessionLog::GetStats().dropped << "\n";
+                SessionTimeline::Stats timeline = SessionTimeline::GetStats();
+                statsFile << "Timeline Events: " << timeline.written << " written, " << timeline.dropped << " dropped\n";
+                
+                statsFile << "\n=== HOOK LATENCY (original call, microseconds) ===\n";
+                statsFile << std::fixed << std::setprecision(1);
+                for (const auto& hook : GetHookLatencies()) {
+                    const HookLatency::Summary& s = hook.summary;
+                    statsFile << hook.name << ": calls " << s.count
+                              << ", mean " << s.meanUs << ", p50 " << s.p50Us << ", p90 " << s.p90Us
+                              << ", p99 " << s.p99Us << ", p99.9 " << s.p999Us << ", max " << s.maxUs << "\n";
+                }
+                
                 statsFile.close();
                 LOG_VERBOSE("[MP] Saved statistics to mp_stats.txt");
             }
         }
         
+        // Full latency histograms, for plotting against frame-time captures
+        {
+            std::ofstream latencyFile(GetOutputPath("mp_hook_latency.csv"));
+            if (latencyFile.is_open()) {
+                latencyFile << "Hook,LowerUs,UpperUs,Count\n";
+                g_ProcessNetworkPacketsLatency.WriteCsv(latencyFile, "ProcessNetworkPackets");
+                g_UpdateMultiplayerStateLatency.WriteCsv(latencyFile, "UpdateMultiplayerState");
+                latencyFile.close();
+                LOG_VERBOSE("[MP] Saved hook latency histograms to mp_hook_latency.csv");
+            }
+        }
+        
         LOG_VERBOSE("[MP] All data saved successfully!");
     }
     
@@ -1415,11 +1568,88 @@ namespace Multiplayer {
     }
     
     Stats GetStats() {
-        std::lock_guard<std::mutex> lock(g_StatsMutex);
-        return g_Stats;
+        Stats stats = {};
+        stats.totalPacketsReceived = g_Stats.totalPacketsReceived.load(std::memory_order_relaxed);
+        stats.totalPacketsSent = g_Stats.totalPacketsSent.load(std::memory_order_relaxed);
+        stats.sessionCount = g_Stats.sessionCount.load(std::memory_order_relaxed);
+        stats.playerStateUpdates = g_Stats.playerStateUpdates.load(std::memory_order_relaxed);
+        stats.totalBytesReceived = g_Stats.totalBytesReceived.load(std::memory_order_relaxed);
+        stats.totalBytesSent = g_Stats.totalBytesSent.load(std::memory_order_relaxed);
+        return stats;
+    }
+    
+    std::vector<HookLatencyInfo> GetHookLatencies() {
+        std::vector<HookLatencyInfo> hooks(2);
+        hooks[0].name = "ProcessNetworkPackets";
+        hooks[0].summary = g_ProcessNetworkPacketsLatency.Summarize();
+        hooks[0].recentMaxUs = HookLatency::TicksToMicros(g_ProcessNetworkPacketsLatency.TakeRecentMax());
+        hooks[1].name = "UpdateMultiplayerState";
+        hooks[1].summary = g_UpdateMultiplayerStateLatency.Summarize();
+        hooks[1].recentMaxUs = HookLatency::TicksToMicros(g_UpdateMultiplayerStateLatency.TakeRecentMax());
+        return hooks;
+    }
+    
+    void ResetHookLatencies() {
+        g_ProcessNetworkPacketsLatency.Reset();
+        g_UpdateMultiplayerStateLatency.Reset();
+    }
+    
+    // Enable or disable hooks created at startup (addresses of 0 failed to hook and are skipped)
+    static void ToggleOptInHooks(const DWORD_PTR* addresses, size_t count, bool enabled, const char* what) {
+        for (size_t i = 0; i < count; i++) {
+            if (!addresses[i]) continue;
+            MH_STATUS status = enabled ? MH_EnableHook((LPVOID)addresses[i]) : MH_DisableHook((LPVOID)addresses[i]);
+            if (status != MH_OK) {
+                LOG_ERROR("[MP] Failed to " << (enabled ? "enable " : "disable ") << what << " at 0x" << std::hex << addresses[i]
+                    << std::dec << ": " << MH_StatusToString(status));
+            }
+        }
+        LOG_INFO("[MP] " << what << (enabled ? " ENABLED" : " DISABLED"));
+    }
+    
+    void SetLatencyHooksEnabled(bool enabled) {
+        if (enabled == g_LatencyHooksEnabled) return;
+        
+        const DWORD_PTR addresses[] = { g_ProcessNetworkPacketsAddr, g_UpdateMultiplayerStateAddr };
+        ToggleOptInHooks(addresses, 2, enabled, "Latency hooks");
+        g_LatencyHooksEnabled = enabled;
+    }
+    
+    bool AreLatencyHooksEnabled() {
+        return g_LatencyHooksEnabled;
+    }
+    
+    void SetPacketHookEnabled(bool enabled) {
+        if (enabled == g_PacketHookEnabled) return;
+        
+        ToggleOptInHooks(&g_HandleNetworkPacketAddr, 1, enabled, "Packet hook");
+        g_PacketHookEnabled = enabled;
+    }
+    
+    bool IsPacketHookEnabled() {
+        return g_PacketHookEnabled;
+    }
+    
+    void SetPacketSenderOffset(uint32_t offset) {
+        g_PacketSenderOffset.store(offset, std::memory_order_relaxed);
+        LOG_INFO("[MP] Packet sender id: +0x" << std::hex << offset << std::dec);
     }
     
     void CheckHotkey() {
+        // Reopening the writers waits for their threads, so it happens here, not on the render thread
+        if (g_OutputDirectoryQueued.exchange(false)) {
+            std::string directory;
+            {
+                std::lock_guard<std::mutex> lock(g_OutputDirectoryMutex);
+                directory = g_QueuedOutputDirectory;
+            }
+            SetOutputDirectory(directory);
+        }
+        
+        // Write out buffered timeline events (keeps file I/O off the game thread)
+        PollGameState();
+        SessionTimeline::Pump();
+        
         // Use keybindings system for Save all logs action
         if (Keybindings::IsActionPressed(Keybindings::Action::SaveMultiplayerLogs)) {
             std::string keyName = Keybindings::GetKeyName(Keybindings::GetKey(Keybindings::Action::SaveMultiplayerLogs));
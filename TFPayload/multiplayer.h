@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <fstream>
+#include "hook_latency.h"
 
 namespace Multiplayer {
     // Phase 1: Monitoring and Logging
@@ -49,6 +50,16 @@ namespace Multiplayer {
     // Enable/disable session event logging
     void SetSessionLoggingEnabled(bool enabled);
     
+    // Directory for the session log, packet capture, sessions CSV and stats (the config file's
+    // "Output Directory", applied at startup and from the DevMenu File menu)
+    // Files that are already streaming are reopened there, which can block for a while, so call
+    // it at startup or on the key monitor thread; other threads use QueueOutputDirectory
+    void SetOutputDirectory(const std::string& directory);
+    std::string GetOutputDirectory();
+
+    // Any thread - applied by the next CheckHotkey tick
+    void QueueOutputDirectory(const std::string& directory);
+    
     // Get current session info (if in a session)
     SessionInfo GetCurrentSession();
     
@@ -72,11 +83,35 @@ namespace Multiplayer {
     };
     Stats GetStats();
     
+    // Latency of the original ProcessNetworkPackets / UpdateMultiplayerState calls
+    struct HookLatencyInfo {
+        const char* name;
+        HookLatency::Summary summary;
+        double recentMaxUs;                 // Largest call since the previous GetHookLatencies()
+    };
+    std::vector<HookLatencyInfo> GetHookLatencies();
+    void ResetHookLatencies();
+    
+    // ProcessNetworkPackets / UpdateMultiplayerState hooks (off by default). UpdateMultiplayerState
+    // also drives rider state recording and game state polling, so those only run while enabled
+    void SetLatencyHooksEnabled(bool enabled);
+    bool AreLatencyHooksEnabled();
+    
+    // HandleNetworkPacket hook (off by default) - the only source of PacketCapture and
+    // NetworkStats records
+    void SetPacketHookEnabled(bool enabled);
+    bool IsPacketHookEnabled();
+    
+    // Byte offset of the sender's player id inside a received packet. Until it is set, senders
+    // are numbered by the connection object the packet arrived on
+    void SetPacketSenderOffset(uint32_t offset);
+    
     // Hotkey handling for manual logging
     void CheckHotkey();
     
     // Phase 2+ Functions (Stubs for now - will be implemented later)
     // These are called by devMenu.cpp but not yet implemented
+    // They call into the game, so callers off the game thread must GameThread::Post() them
     void SendVoteTrack(uint32_t trackId = 0);
     void SendSelectBike(uint32_t bikeId = 0);
     void SendContinueToNextHeat();
@@ -0,0 +1,147 @@
+#include "pch.h"
+#include "network_stats.h"
+#include <Windows.h>
+#include <algorithm>
+#include <atomic>
+
+namespace NetworkStats {
+
+    static const uint32_t BUCKET_MS = 250;
+    static const uint32_t BUCKETS_PER_SECOND = 1000 / BUCKET_MS;
+    static const uint32_t RING_SIZE = 256;          // > 60 s of buckets plus the one being filled
+    static const int TYPE_SLOTS = 64;
+    static const int TALKER_SLOTS = 32;
+
+    static const uint32_t WINDOW_SECONDS[WINDOW_COUNT] = { 1, 10, 60 };
+
+    struct Bucket {
+        std::atomic<uint32_t> epoch{ 0 };           // Bucket number + 1 (0 = never used)
+        std::atomic<uint32_t> packets{ 0 };
+        std::atomic<uint32_t> bytes{ 0 };
+    };
+
+    struct Series {
+        std::atomic<uint64_t> tag{ 0 };             // (1 << 32) | key once claimed
+        std::atomic<uint64_t> packets{ 0 };
+        std::atomic<uint64_t> bytes{ 0 };
+        Bucket ring[RING_SIZE];
+
+        // Two threads recycling the same bucket at once can lose the other's first packet
+        void Add(uint32_t epoch, uint32_t size) {
+            Bucket& bucket = ring[epoch % RING_SIZE];
+            uint32_t seen = bucket.epoch.load(std::memory_order_acquire);
+            if (seen != epoch && bucket.epoch.compare_exchange_strong(seen, epoch, std::memory_order_acq_rel)) {
+                bucket.packets.store(0, std::memory_order_relaxed);
+                bucket.bytes.store(0, std::memory_order_relaxed);
+            }
+            bucket.packets.fetch_add(1, std::memory_order_relaxed);
+            bucket.bytes.fetch_add(size, std::memory_order_relaxed);
+            packets.fetch_add(1, std::memory_order_relaxed);
+            bytes.fetch_add(size, std::memory_order_relaxed);
+        }
+
+        void Clear() {
+            packets.store(0, std::memory_order_relaxed);
+            bytes.store(0, std::memory_order_relaxed);
+            for (uint32_t i = 0; i < RING_SIZE; i++) {
+                ring[i].epoch.store(0, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    static Series s_total;
+    static Series s_types[TYPE_SLOTS + 1];          // Last slot is OTHER_KEY
+    static Series s_talkers[TALKER_SLOTS + 1];
+
+    static uint32_t CurrentEpoch() {
+        return GetTickCount() / BUCKET_MS + 1;
+    }
+
+    // Open addressing on the key; a full table falls back to the overflow slot
+    static Series& FindSeries(Series* table, int slots, uint32_t key) {
+        uint64_t tag = (1ULL << 32) | key;
+        uint32_t start = (key * 2654435761u) % (uint32_t)slots;
+        for (int probe = 0; probe < slots; probe++) {
+            Series& series = table[(start + probe) % slots];
+            uint64_t current = series.tag.load(std::memory_order_acquire);
+            if (current == tag) return series;
+            if (current == 0 && series.tag.compare_exchange_strong(current, tag, std::memory_order_acq_rel)) {
+                return series;
+            }
+            if (current == tag) return series;      // Claimed by another thread just now
+        }
+        Series& other = table[slots];
+        other.tag.store((1ULL << 32) | OTHER_KEY, std::memory_order_relaxed);
+        return other;
+    }
+
+    void Record(uint32_t type, uint32_t size, uint32_t sourcePlayerId) {
+        uint32_t epoch = CurrentEpoch();
+        s_total.Add(epoch, size);
+        FindSeries(s_types, TYPE_SLOTS, type).Add(epoch, size);
+        FindSeries(s_talkers, TALKER_SLOTS, sourcePlayerId).Add(epoch, size);
+    }
+
+    // Only completed buckets count, so a window never reports a partly filled quarter-second
+    static void Summarize(const Series& series, uint32_t epoch, Row& row) {
+        row.key = (uint32_t)series.tag.load(std::memory_order_relaxed);
+        row.packets = series.packets.load(std::memory_order_relaxed);
+        row.bytes = series.bytes.load(std::memory_order_relaxed);
+
+        uint64_t windowPackets[WINDOW_COUNT] = {};
+        uint64_t windowBytes[WINDOW_COUNT] = {};
+        for (uint32_t i = 0; i < RING_SIZE; i++) {
+            const Bucket& bucket = series.ring[i];
+            uint32_t bucketEpoch = bucket.epoch.load(std::memory_order_acquire);
+            if (bucketEpoch == 0 || bucketEpoch >= epoch) continue;
+            uint32_t age = epoch - 1 - bucketEpoch;
+            if (age >= HISTORY_SECONDS * BUCKETS_PER_SECOND) continue;
+
+            uint32_t packets = bucket.packets.load(std::memory_order_relaxed);
+            uint32_t bytes = bucket.bytes.load(std::memory_order_relaxed);
+            row.history[HISTORY_SECONDS - 1 - age / BUCKETS_PER_SECOND] += (float)packets;
+            for (int w = 0; w < WINDOW_COUNT; w++) {
+                if (age < WINDOW_SECONDS[w] * BUCKETS_PER_SECOND) {
+                    windowPackets[w] += packets;
+                    windowBytes[w] += bytes;
+                }
+            }
+        }
+        for (int w = 0; w < WINDOW_COUNT; w++) {
+            row.packetsPerSec[w] = (float)windowPackets[w] / WINDOW_SECONDS[w];
+            row.bytesPerSec[w] = (float)windowBytes[w] / WINDOW_SECONDS[w];
+        }
+    }
+
+    static void SummarizeTable(const Series* table, int slots, uint32_t epoch, std::vector<Row>& rows) {
+        rows.clear();
+        for (int i = 0; i <= slots; i++) {
+            if (table[i].tag.load(std::memory_order_acquire) == 0) continue;
+            if (table[i].packets.load(std::memory_order_relaxed) == 0) continue;
+            rows.emplace_back();
+            Summarize(table[i], epoch, rows.back());
+        }
+        std::sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) {
+            if (a.bytesPerSec[WINDOW_10S] != b.bytesPerSec[WINDOW_10S]) {
+                return a.bytesPerSec[WINDOW_10S] > b.bytesPerSec[WINDOW_10S];
+            }
+            return a.bytes > b.bytes;
+        });
+    }
+
+    void TakeSnapshot(Snapshot& snapshot) {
+        uint32_t epoch = CurrentEpoch();
+        snapshot.total = Row();
+        Summarize(s_total, epoch, snapshot.total);
+        snapshot.total.key = 0;
+        SummarizeTable(s_types, TYPE_SLOTS, epoch, snapshot.types);
+        SummarizeTable(s_talkers, TALKER_SLOTS, epoch, snapshot.talkers);
+    }
+
+    void Reset() {
+        s_total.Clear();
+        for (auto& series : s_types) series.Clear();
+        for (auto& series : s_talkers) series.Clear();
+    }
+
+} // namespace NetworkStats
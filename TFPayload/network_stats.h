@@ -0,0 +1,48 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// Rolling per-packet-type and per-sender traffic rates for the network dashboard
+// Each series keeps a ring of 250 ms buckets stamped with the bucket they belong to, so
+// Record() is a few relaxed atomic adds (a stale bucket is recycled in place) and the 1s/10s/60s
+// windows are summed from the ring on demand instead of rescanning any packet log.
+
+namespace NetworkStats {
+
+    enum Window {
+        WINDOW_1S,
+        WINDOW_10S,
+        WINDOW_60S,
+        WINDOW_COUNT
+    };
+
+    const int HISTORY_SECONDS = 60;
+
+    // Key of the series that collects packet types which did not fit in the table
+    const uint32_t OTHER_KEY = 0xFFFFFFFF;
+
+    struct Row {
+        uint32_t key = 0;                           // Packet type or source player id
+        uint64_t packets = 0;                       // Since start or Reset()
+        uint64_t bytes = 0;
+        float packetsPerSec[WINDOW_COUNT] = {};
+        float bytesPerSec[WINDOW_COUNT] = {};
+        float history[HISTORY_SECONDS] = {};        // Packets per second, oldest first
+    };
+
+    struct Snapshot {
+        Row total;
+        std::vector<Row> types;                     // Busiest (10s bytes/s) first
+        std::vector<Row> talkers;                   // By source player id, busiest first
+    };
+
+    // Any thread - never blocks or allocates
+    void Record(uint32_t type, uint32_t size, uint32_t sourcePlayerId);
+
+    // Sum the rings into rates and history (a few hundred loads per active series)
+    void TakeSnapshot(Snapshot& snapshot);
+
+    // Clear counts and rates; known types and senders keep their slots
+    void Reset();
+
+} // namespace NetworkStats
@@ -0,0 +1,306 @@
+#include "pch.h"
+#include "packet_capture.h"
+#include "packet_capture_format.h"
+#include "background_writer.h"
+#include "logging.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+namespace PacketCapture {
+
+    struct Record {
+        int64_t ticks;              // QueryPerformanceCounter at capture
+        uint32_t type;
+        uint32_t size;              // Size reported by the packet header
+        uint32_t sourcePlayerId;
+        uint32_t destPlayerId;
+        uint32_t payloadStart;      // Arena position (monotonic) of the copied bytes
+        uint32_t payloadEnd;        // Arena position after this record's reservation
+        uint16_t captured;          // Bytes actually copied
+        uint8_t direction;
+        uint8_t flags;
+    };
+
+    using PacketCaptureFormat::FLAG_TRUNCATED;
+    using PacketCaptureFormat::FLAG_FAULTED;
+
+    // Producer and consumer indices live on separate cache lines
+    struct alignas(64) ProducerSide {
+        std::atomic<uint32_t> recordHead{ 0 };
+        uint32_t arenaHead = 0;     // Only touched by the producer
+    };
+
+    struct alignas(64) ConsumerSide {
+        std::atomic<uint32_t> recordTail{ 0 };
+        std::atomic<uint32_t> arenaTail{ 0 };
+    };
+
+    struct alignas(64) Counters {
+        std::atomic<uint64_t> captured{ 0 };
+        std::atomic<uint64_t> dropped{ 0 };
+        std::atomic<uint64_t> truncated{ 0 };
+        std::atomic<uint64_t> faulted{ 0 };
+        std::atomic<uint64_t> written{ 0 };
+        std::atomic<uint64_t> payloadBytesWritten{ 0 };
+    };
+
+    static ProducerSide s_producer;
+    static ConsumerSide s_consumer;
+    static Counters s_counters;
+
+    // Buffers stay allocated until unload so a hook racing Stop() never sees freed memory
+    static std::vector<Record> s_records;
+    static std::vector<uint8_t> s_arena;
+    static uint32_t s_recordMask = 0;
+    static uint32_t s_arenaMask = 0;
+    static uint32_t s_maxPayload = 0;
+
+    static std::atomic<bool> s_active{ false };
+    static std::atomic<uint32_t> s_producersInside{ 0 };    // Capture calls past the entry check
+
+    // Counts a Capture call for Stop, which waits for it before the ring can be reset
+    struct ProducerScope {
+        ProducerScope() { s_producersInside.fetch_add(1); }
+        ~ProducerScope() { s_producersInside.fetch_sub(1); }
+    };
+    static BackgroundWriter s_writerThread;
+    static DWORD s_drainIntervalMs = 20;
+
+    static std::ofstream s_file;
+    static std::unique_ptr<PacketCaptureFormat::BlockWriter> s_writer;
+    static std::string s_path;
+    static LARGE_INTEGER s_startTicks = {};
+    static LARGE_INTEGER s_frequency = {};
+
+    static uint32_t RoundUpPow2(uint32_t value) {
+        uint32_t result = 1;
+        while (result < value) result <<= 1;
+        return result;
+    }
+
+    // SEH-guarded copy - no C++ objects with destructors in this frame
+    static bool SafeCopy(void* dest, const void* src, size_t size) {
+        __try {
+            memcpy(dest, src, size);
+            return true;
+        } __except(EXCEPTION_EXECUTE_HANDLER) {
+            return false;
+        }
+    }
+
+    // ============================================================================
+    // Producer (game network thread)
+    // ============================================================================
+
+    void Capture(Direction direction, uint32_t type, uint32_t size,
+                 uint32_t sourcePlayerId, uint32_t destPlayerId, const void* payload) {
+        // Entered before the check (both sequentially consistent), so Stop either sees this
+        // call in progress or this call sees the capture stopped
+        ProducerScope scope;
+        if (!s_active.load()) return;
+
+        uint32_t head = s_producer.recordHead.load(std::memory_order_relaxed);
+        uint32_t tail = s_consumer.recordTail.load(std::memory_order_acquire);
+        if (head - tail > s_recordMask) {
+            s_counters.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        uint32_t want = payload ? size : 0;
+        uint8_t flags = 0;
+        if (want > s_maxPayload) {
+            want = s_maxPayload;
+            flags |= FLAG_TRUNCATED;
+        }
+
+        // Payloads are contiguous in the arena; skip the tail end rather than split one
+        uint32_t arenaSize = s_arenaMask + 1;
+        uint32_t start = s_producer.arenaHead;
+        uint32_t offset = start & s_arenaMask;
+        if (offset + want > arenaSize) {
+            start += arenaSize - offset;
+            offset = 0;
+        }
+        uint32_t end = start + want;
+        if (end - s_consumer.arenaTail.load(std::memory_order_acquire) > arenaSize) {
+            s_counters.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        if (want > 0 && !SafeCopy(&s_arena[offset], payload, want)) {
+            want = 0;
+            flags |= FLAG_FAULTED;
+        }
+
+        Record& record = s_records[head & s_recordMask];
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        record.ticks = now.QuadPart;
+        record.type = type;
+        record.size = size;
+        record.sourcePlayerId = sourcePlayerId;
+        record.destPlayerId = destPlayerId;
+        record.payloadStart = start;
+        record.payloadEnd = end;
+        record.captured = (uint16_t)want;
+        record.direction = (uint8_t)direction;
+        record.flags = flags;
+
+        s_producer.arenaHead = end;
+        s_producer.recordHead.store(head + 1, std::memory_order_release);
+
+        s_counters.captured.fetch_add(1, std::memory_order_relaxed);
+        if (flags & FLAG_TRUNCATED) s_counters.truncated.fetch_add(1, std::memory_order_relaxed);
+        if (flags & FLAG_FAULTED) s_counters.faulted.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // ============================================================================
+    // Consumer (writer thread)
+    // ============================================================================
+
+    static void WriteRecord(const Record& record) {
+        PacketCaptureFormat::RecordHeader header;
+        header.timestampUs = (uint64_t)((record.ticks - s_startTicks.QuadPart) * 1000000 / s_frequency.QuadPart);
+        header.type = record.type;
+        header.size = record.size;
+        header.sourcePlayerId = record.sourcePlayerId;
+        header.destPlayerId = record.destPlayerId;
+        header.capturedLength = record.captured;
+        header.direction = record.direction;
+        header.flags = record.flags;
+        s_writer->Append(header, &s_arena[record.payloadStart & s_arenaMask]);
+    }
+
+    static void Drain() {
+        uint32_t tail = s_consumer.recordTail.load(std::memory_order_relaxed);
+        uint32_t head = s_producer.recordHead.load(std::memory_order_acquire);
+        if (tail == head) return;
+
+        uint32_t count = head - tail;
+        uint64_t payloadBytes = 0;
+        while (tail != head) {
+            const Record& record = s_records[tail & s_recordMask];
+            WriteRecord(record);
+            payloadBytes += record.captured;
+            tail++;
+
+            // Hand space back to the producer in batches
+            if ((tail & 255) == 0 || tail == head) {
+                s_consumer.arenaTail.store(record.payloadEnd, std::memory_order_release);
+                s_consumer.recordTail.store(tail, std::memory_order_release);
+            }
+        }
+
+        s_counters.written.fetch_add(count, std::memory_order_relaxed);
+        s_counters.payloadBytesWritten.fetch_add(payloadBytes, std::memory_order_relaxed);
+    }
+
+    static void DrainAndFlush(bool flush) {
+        Drain();
+        if (flush) {
+            s_writer->Flush();
+        }
+    }
+
+    // ============================================================================
+    // Public API
+    // ============================================================================
+
+    bool Start(const std::string& path, const Config& config) {
+        if (s_active.load()) {
+            LOG_WARNING("[Capture] Already capturing to " << s_path);
+            return true;
+        }
+
+        uint32_t recordCapacity = RoundUpPow2(config.recordCapacity < 2 ? 2 : config.recordCapacity);
+        uint32_t arenaBytes = RoundUpPow2(config.arenaBytes < 4096 ? 4096 : config.arenaBytes);
+        if (s_records.size() != recordCapacity) s_records.assign(recordCapacity, Record());
+        if (s_arena.size() != arenaBytes) s_arena.assign(arenaBytes, 0);
+        s_recordMask = recordCapacity - 1;
+        s_arenaMask = arenaBytes - 1;
+        s_maxPayload = config.maxPayloadBytes;
+        if (s_maxPayload > arenaBytes / 4) s_maxPayload = arenaBytes / 4;
+        if (s_maxPayload > PacketCaptureFormat::MaxPayloadForBlock(PacketCaptureFormat::DEFAULT_BLOCK_SIZE)) {
+            s_maxPayload = PacketCaptureFormat::MaxPayloadForBlock(PacketCaptureFormat::DEFAULT_BLOCK_SIZE);
+        }
+        s_drainIntervalMs = config.drainIntervalMs;
+
+        s_producer.recordHead.store(0);
+        s_producer.arenaHead = 0;
+        s_consumer.recordTail.store(0);
+        s_consumer.arenaTail.store(0);
+
+        s_file.open(path, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!s_file.is_open()) {
+            LOG_ERROR("[Capture] Could not open capture file: " << path);
+            return false;
+        }
+        s_path = path;
+
+        QueryPerformanceFrequency(&s_frequency);
+        QueryPerformanceCounter(&s_startTicks);
+
+        uint64_t startUnixMicros = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        PacketCaptureFormat::FileHeader header = PacketCaptureFormat::MakeFileHeader(
+            PacketCaptureFormat::DEFAULT_BLOCK_SIZE, s_maxPayload, startUnixMicros);
+        s_file.write((const char*)&header, sizeof(header));
+        s_writer.reset(new PacketCaptureFormat::BlockWriter(s_file, PacketCaptureFormat::DEFAULT_BLOCK_SIZE));
+
+        if (!s_writerThread.Start(DrainAndFlush, s_drainIntervalMs)) {
+            LOG_ERROR("[Capture] Failed to create writer thread");
+            s_file.close();
+            return false;
+        }
+
+        s_active.store(true, std::memory_order_release);
+        LOG_INFO("[Capture] Capturing packets to " << path
+            << " (" << recordCapacity << " records, " << (arenaBytes / 1024) << " KB arena)");
+        return true;
+    }
+
+    void Stop() {
+        if (!s_active.exchange(false)) return;
+
+        // Let a packet already past the check finish, so a Start that follows can reset the ring
+        while (s_producersInside.load() != 0) {
+            Sleep(0);
+        }
+
+        if (s_writerThread.Stop()) {
+            s_file.close();
+        } else {
+            LOG_WARNING("[Capture] Writer thread did not exit in time");
+        }
+
+        Stats stats = GetStats();
+        LOG_INFO("[Capture] Stopped: " << stats.written << " packets written, " << stats.dropped << " dropped");
+    }
+
+    bool IsRunning() {
+        return s_active.load(std::memory_order_acquire);
+    }
+
+    bool Flush(DWORD timeoutMs) {
+        if (!s_active.load()) return false;
+        return s_writerThread.Flush(timeoutMs);
+    }
+
+    Stats GetStats() {
+        Stats stats;
+        stats.captured = s_counters.captured.load(std::memory_order_relaxed);
+        stats.dropped = s_counters.dropped.load(std::memory_order_relaxed);
+        stats.truncated = s_counters.truncated.load(std::memory_order_relaxed);
+        stats.faulted = s_counters.faulted.load(std::memory_order_relaxed);
+        stats.written = s_counters.written.load(std::memory_order_relaxed);
+        stats.payloadBytesWritten = s_counters.payloadBytesWritten.load(std::memory_order_relaxed);
+        stats.queued = s_producer.recordHead.load(std::memory_order_relaxed)
+            - s_consumer.recordTail.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+} // namespace PacketCapture
@@ -0,0 +1,54 @@
+#pragma once
+#include <Windows.h>
+#include <cstdint>
+#include <string>
+
+// Lock-free packet capture for Multiplayer
+// The game's network thread pushes fixed-size records into a single-producer/single-consumer
+// ring and copies a bounded slice of each payload into a byte arena. A background thread
+// drains both to disk in the .tfcap block format (packet_capture_format.h), so the hook never
+// takes a lock, allocates or touches the file.
+// When either the ring or the arena is full the packet is counted as dropped, not queued.
+
+namespace PacketCapture {
+
+    enum class Direction : uint8_t {
+        Recv = 0,
+        Send = 1
+    };
+
+    struct Config {
+        uint32_t recordCapacity = 16384;        // Rounded up to a power of two
+        uint32_t arenaBytes = 4 * 1024 * 1024;  // Rounded up to a power of two
+        uint32_t maxPayloadBytes = 1024;        // Longer payloads are truncated
+        DWORD drainIntervalMs = 20;
+    };
+
+    struct Stats {
+        uint64_t captured = 0;
+        uint64_t dropped = 0;                   // Ring or arena full
+        uint64_t truncated = 0;                 // Payload longer than maxPayloadBytes
+        uint64_t faulted = 0;                   // Payload pointer was unreadable
+        uint64_t written = 0;
+        uint64_t payloadBytesWritten = 0;
+        uint32_t queued = 0;                    // Records waiting for the writer
+    };
+
+    // Allocate the ring and start the writer thread
+    bool Start(const std::string& path, const Config& config = Config());
+
+    // Wait out any Capture call in progress, drain everything, stop the writer thread and close the file
+    void Stop();
+
+    bool IsRunning();
+
+    // Producer side - call from the game's network thread only
+    void Capture(Direction direction, uint32_t type, uint32_t size,
+                 uint32_t sourcePlayerId, uint32_t destPlayerId, const void* payload);
+
+    // Block until everything captured so far is on disk (or timeoutMs passes)
+    bool Flush(DWORD timeoutMs = 1000);
+
+    Stats GetStats();
+
+} // namespace PacketCapture
@@ -0,0 +1,136 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <vector>
+
+// On-disk format for PacketCapture (.tfcap)
+//
+//   FileHeader (64 bytes)
+//   Block 0, Block 1, ...          each exactly blockSize bytes
+//
+// A block starts with a BlockHeader followed by packed records (RecordHeader + payload bytes).
+// Records never span blocks and unused block space is zero padding, so a reader can split a
+// capture at any block boundary and scan the pieces in parallel.
+// Header-only and Windows-free so tools/packet_analyzer can share it.
+
+namespace PacketCaptureFormat {
+
+    const uint32_t FILE_MAGIC = 0x50434654;     // "TFCP"
+    const uint32_t BLOCK_MAGIC = 0x4B424654;    // "TFBK"
+    const uint16_t VERSION = 1;
+    const uint32_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    enum RecordFlags : uint8_t {
+        FLAG_TRUNCATED = 1 << 0,    // Payload longer than the snap length
+        FLAG_FAULTED = 1 << 1       // Payload pointer was unreadable
+    };
+
+#pragma pack(push, 1)
+    struct FileHeader {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t headerSize;
+        uint32_t blockSize;
+        uint32_t snapLength;            // Max payload bytes stored per record
+        uint64_t startUnixMicros;       // Wall clock at capture start
+        uint8_t reserved[40];
+    };
+
+    struct BlockHeader {
+        uint32_t magic;
+        uint32_t sequence;
+        uint32_t usedBytes;             // Including this header
+        uint32_t recordCount;
+    };
+
+    struct RecordHeader {
+        uint64_t timestampUs;           // Since capture start
+        uint32_t type;
+        uint32_t size;                  // Size reported by the packet header
+        uint32_t sourcePlayerId;
+        uint32_t destPlayerId;
+        uint16_t capturedLength;        // Payload bytes following this header
+        uint8_t direction;              // 0 = recv, 1 = send
+        uint8_t flags;
+    };
+#pragma pack(pop)
+
+    static_assert(sizeof(FileHeader) == 64, "FileHeader must stay 64 bytes");
+    static_assert(sizeof(BlockHeader) == 16, "BlockHeader must stay 16 bytes");
+    static_assert(sizeof(RecordHeader) == 28, "RecordHeader must stay 28 bytes");
+
+    inline FileHeader MakeFileHeader(uint32_t blockSize, uint32_t snapLength, uint64_t startUnixMicros) {
+        FileHeader header;
+        memset(&header, 0, sizeof(header));
+        header.magic = FILE_MAGIC;
+        header.version = VERSION;
+        header.headerSize = sizeof(FileHeader);
+        header.blockSize = blockSize;
+        header.snapLength = snapLength;
+        header.startUnixMicros = startUnixMicros;
+        return header;
+    }
+
+    // Largest payload that still fits in one block next to its headers
+    inline uint32_t MaxPayloadForBlock(uint32_t blockSize) {
+        return blockSize - (uint32_t)sizeof(BlockHeader) - (uint32_t)sizeof(RecordHeader);
+    }
+
+    // Packs records into fixed-size blocks and writes each block once it is full
+    class BlockWriter {
+    public:
+        BlockWriter(std::ostream& out, uint32_t blockSize)
+            : m_out(out), m_block(blockSize, 0) {
+            Reset();
+        }
+
+        // Returns false if the record can never fit in a block
+        bool Append(const RecordHeader& record, const uint8_t* payload) {
+            size_t needed = sizeof(RecordHeader) + record.capturedLength;
+            if (needed > m_block.size() - sizeof(BlockHeader)) return false;
+            if (m_used + needed > m_block.size()) Emit();
+
+            memcpy(&m_block[m_used], &record, sizeof(RecordHeader));
+            if (record.capturedLength > 0) {
+                memcpy(&m_block[m_used + sizeof(RecordHeader)], payload, record.capturedLength);
+            }
+            m_used += needed;
+            m_records++;
+            return true;
+        }
+
+        // Write the current partial block (padded) so everything appended so far is on disk
+        void Flush() {
+            if (m_records > 0) Emit();
+            m_out.flush();
+        }
+
+        uint32_t GetBlocksWritten() const { return m_sequence; }
+
+    private:
+        void Reset() {
+            m_used = sizeof(BlockHeader);
+            m_records = 0;
+        }
+
+        void Emit() {
+            BlockHeader header;
+            header.magic = BLOCK_MAGIC;
+            header.sequence = m_sequence++;
+            header.usedBytes = (uint32_t)m_used;
+            header.recordCount = m_records;
+            memcpy(&m_block[0], &header, sizeof(header));
+            memset(&m_block[m_used], 0, m_block.size() - m_used);
+            m_out.write((const char*)m_block.data(), m_block.size());
+            Reset();
+        }
+
+        std::ostream& m_out;
+        std::vector<uint8_t> m_block;
+        size_t m_used = 0;
+        uint32_t m_records = 0;
+        uint32_t m_sequence = 0;
+    };
+
+} // namespace PacketCaptureFormat
@@ -0,0 +1,398 @@
+// patch_manager.cpp
+// Declarative game code patches applied as verified, page-batched transactions
+#include "pch.h"
+#include "patch_manager.h"
+#include "logging.h"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace PatchManager {
+
+    static const int MAX_FORMS = 2;
+
+    // One encoding of a site; mask[i] == 0 for "??" bytes
+    struct Form {
+        uint8_t original[MAX_PATCH_BYTES];
+        uint8_t patched[MAX_PATCH_BYTES];
+        uint8_t mask[MAX_PATCH_BYTES];
+        size_t size;
+    };
+
+    struct Site {
+        const Patch* patch;
+        uint8_t* address;
+        Form forms[MAX_FORMS];
+        int formCount;
+        size_t readSize;                                // Longest form
+    };
+
+    // A site write queued by a transaction: bytes to write and what was there before
+    struct PendingWrite {
+        uint8_t* address;
+        size_t size;
+        uint8_t bytes[MAX_PATCH_BYTES];
+        uint8_t backup[MAX_PATCH_BYTES];
+        const Site* site;                               // nullptr for WriteCode
+    };
+
+    static std::mutex s_mutex;                          // Patches are toggled from the game thread and the menu
+    static std::vector<Site> s_sites;
+    static std::vector<PendingWrite> s_writes;          // Reused by each transaction
+    static DWORD s_pageSize = 0;
+
+    // ============================================================================
+    // Patterns
+    // ============================================================================
+
+    static int HexDigit(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        return -1;
+    }
+
+    // Parse "73 1F | 0F 83 ?? ?? ?? ??" into up to MAX_FORMS byte/mask runs; false if malformed
+    static bool ParsePattern(const char* pattern, uint8_t bytes[][MAX_PATCH_BYTES], uint8_t masks[][MAX_PATCH_BYTES],
+        size_t* sizes, int& formCount) {
+        formCount = 1;
+        sizes[0] = 0;
+        for (const char* p = pattern; *p; ) {
+            if (*p == ' ') {
+                p++;
+                continue;
+            }
+            if (*p == '|') {
+                if (sizes[formCount - 1] == 0 || formCount == MAX_FORMS) return false;
+                sizes[formCount++] = 0;
+                p++;
+                continue;
+            }
+
+            size_t& size = sizes[formCount - 1];
+            if (size == MAX_PATCH_BYTES || !p[1]) return false;
+            if (p[0] == '?' && p[1] == '?') {
+                bytes[formCount - 1][size] = 0;
+                masks[formCount - 1][size] = 0;
+            } else {
+                int high = HexDigit(p[0]), low = HexDigit(p[1]);
+                if (high < 0 || low < 0) return false;
+                bytes[formCount - 1][size] = (uint8_t)(high << 4 | low);
+                masks[formCount - 1][size] = 1;
+            }
+            size++;
+            p += 2;
+        }
+        return sizes[formCount - 1] != 0;
+    }
+
+    static bool BuildSite(uintptr_t baseAddress, const Patch& patch, Site& site) {
+        uint8_t originals[MAX_FORMS][MAX_PATCH_BYTES], masks[MAX_FORMS][MAX_PATCH_BYTES];
+        uint8_t patcheds[MAX_FORMS][MAX_PATCH_BYTES], patchedMasks[MAX_FORMS][MAX_PATCH_BYTES];
+        size_t originalSizes[MAX_FORMS], patchedSizes[MAX_FORMS];
+        int originalForms, patchedForms;
+
+        if (!ParsePattern(patch.original, originals, masks, originalSizes, originalForms) ||
+            !ParsePattern(patch.patched, patcheds, patchedMasks, patchedSizes, patchedForms) ||
+            originalForms != patchedForms) {
+            return false;
+        }
+
+        site.patch = &patch;
+        site.address = (uint8_t*)(baseAddress + patch.rva);
+        site.formCount = originalForms;
+        site.readSize = 0;
+        for (int f = 0; f < originalForms; f++) {
+            Form& form = site.forms[f];
+            form.size = originalSizes[f];
+            if (patchedSizes[f] != form.size) return false;
+            for (size_t i = 0; i < form.size; i++) {
+                // A "??" byte is kept, so it has to be "??" on both sides
+                if (masks[f][i] != patchedMasks[f][i]) return false;
+            }
+            memcpy(form.original, originals[f], form.size);
+            memcpy(form.patched, patcheds[f], form.size);
+            memcpy(form.mask, masks[f], form.size);
+            site.readSize = (std::max)(site.readSize, form.size);
+        }
+        return true;
+    }
+
+    static bool Matches(const uint8_t* current, const uint8_t* expected, const uint8_t* mask, size_t size) {
+        for (size_t i = 0; i < size; i++) {
+            if (mask[i] && current[i] != expected[i]) return false;
+        }
+        return true;
+    }
+
+    static std::string FormatBytes(const uint8_t* bytes, size_t size) {
+        std::ostringstream out;
+        out << std::hex << std::uppercase << std::setfill('0');
+        for (size_t i = 0; i < size; i++) {
+            if (i) out << ' ';
+            out << std::setw(2) << (int)bytes[i];
+        }
+        return out.str();
+    }
+
+    // ============================================================================
+    // Memory access
+    // SEH only - no destructors in these.
+    // ============================================================================
+
+    static bool ReadBytes(const uint8_t* address, uint8_t* out, size_t size) {
+        __try {
+            memcpy(out, address, size);
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER) {
+            return false;
+        }
+        return true;
+    }
+
+    // Copy writes [begin, count) into game code (their backups when restoring).
+    // Returns the index that faulted, or count.
+    static size_t CopyRange(const PendingWrite* writes, size_t begin, size_t count, bool restore) {
+        volatile size_t i = begin;
+        __try {
+            for (; i < count; i++) {
+                const PendingWrite& write = writes[i];
+                memcpy(write.address, restore ? write.backup : write.bytes, write.size);
+            }
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER) {
+            return i;
+        }
+        return count;
+    }
+
+    // Which form the site's current bytes match; returns false if neither side of any form does
+    static bool Classify(const Site& site, const uint8_t* current, int& form, bool& patched) {
+        for (int f = 0; f < site.formCount; f++) {
+            const Form& candidate = site.forms[f];
+            if (Matches(current, candidate.patched, candidate.mask, candidate.size)) {
+                form = f;
+                patched = true;
+                return true;
+            }
+            if (Matches(current, candidate.original, candidate.mask, candidate.size)) {
+                form = f;
+                patched = false;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static State ReadState(const Site& site) {
+        uint8_t current[MAX_PATCH_BYTES];
+        int form;
+        bool patched;
+        if (!ReadBytes(site.address, current, site.readSize) || !Classify(site, current, form, patched)) {
+            return State::Unknown;
+        }
+        return patched ? State::Patched : State::Original;
+    }
+
+    // ============================================================================
+    // Transactions
+    // ============================================================================
+
+    // Write every queued entry: one VirtualProtect per page there and back, one instruction
+    // cache flush. Rolls back and returns false if a page can't be unprotected or a write faults.
+    static bool Commit(std::vector<PendingWrite>& writes) {
+        if (s_pageSize == 0) {
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            s_pageSize = info.dwPageSize;
+        }
+
+        std::vector<uintptr_t> pages;
+        uintptr_t low = UINTPTR_MAX, high = 0;
+        for (const PendingWrite& write : writes) {
+            uintptr_t begin = (uintptr_t)write.address, end = begin + write.size;
+            for (uintptr_t page = begin & ~(uintptr_t)(s_pageSize - 1); page < end; page += s_pageSize) {
+                pages.push_back(page);
+            }
+            low = (std::min)(low, begin);
+            high = (std::max)(high, end);
+        }
+        std::sort(pages.begin(), pages.end());
+        pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+
+        std::vector<DWORD> oldProtect(pages.size());
+        size_t unprotected = 0;
+        for (; unprotected < pages.size(); unprotected++) {
+            if (!VirtualProtect((void*)pages[unprotected], s_pageSize, PAGE_EXECUTE_READWRITE, &oldProtect[unprotected])) {
+                LOG_ERROR("[Patch] Failed to change memory protection at 0x" << std::hex << pages[unprotected]
+                    << " (error " << std::dec << GetLastError() << ")");
+                break;
+            }
+        }
+
+        bool success = unprotected == pages.size();
+        if (success) {
+            size_t faulted = CopyRange(writes.data(), 0, writes.size(), false);
+            if (faulted < writes.size()) {
+                LOG_ERROR("[Patch] Write to 0x" << std::hex << (uintptr_t)writes[faulted].address << std::dec << " faulted, rolling back");
+                CopyRange(writes.data(), 0, faulted + 1, true);
+                success = false;
+            }
+        }
+
+        for (size_t i = 0; i < unprotected; i++) {
+            DWORD ignored;
+            VirtualProtect((void*)pages[i], s_pageSize, oldProtect[i], &ignored);
+        }
+        if (success) {
+            FlushInstructionCache(GetCurrentProcess(), (void*)low, high - low);
+            LOG_VERBOSE("[Patch] Wrote " << writes.size() << " site(s) across " << pages.size() << " page(s)");
+        }
+        return success;
+    }
+
+    static bool SetGroups(uint32_t groups, bool patch) {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_writes.clear();
+
+        // Verify everything before the first write
+        bool found = false;
+        for (const Site& site : s_sites) {
+            if (!(site.patch->groups & groups)) continue;
+            found = true;
+
+            PendingWrite write;
+            int form;
+            bool patched;
+            if (!ReadBytes(site.address, write.backup, site.readSize)) {
+                LOG_ERROR("[Patch] " << site.patch->name << ": cannot read 0x" << std::hex << (uintptr_t)site.address);
+                return false;
+            }
+            if (!Classify(site, write.backup, form, patched)) {
+                LOG_ERROR("[Patch] " << site.patch->name << ": unexpected bytes at 0x" << std::hex << (uintptr_t)site.address
+                    << std::dec << ": " << FormatBytes(write.backup, site.readSize) << " (expected " << site.patch->original
+                    << " or " << site.patch->patched << ")");
+                return false;
+            }
+            if (patched == patch) continue;
+
+            const Form& target = site.forms[form];
+            const uint8_t* bytes = patch ? target.patched : target.original;
+            write.address = site.address;
+            write.size = target.size;
+            write.site = &site;
+            for (size_t i = 0; i < target.size; i++) {
+                write.bytes[i] = target.mask[i] ? bytes[i] : write.backup[i];
+            }
+            s_writes.push_back(write);
+        }
+
+        if (!found) {
+            LOG_ERROR("[Patch] No patches registered for groups 0x" << std::hex << groups);
+            return false;
+        }
+        if (s_writes.empty()) return true;
+        if (!Commit(s_writes)) return false;
+
+        for (const PendingWrite& write : s_writes) {
+            LOG_VERBOSE("[Patch] " << (patch ? "Applied " : "Restored ") << write.site->patch->name);
+        }
+        return true;
+    }
+
+    // ============================================================================
+    // Public API
+    // ============================================================================
+
+    bool Register(uintptr_t baseAddress, const Patch* patches, size_t count) {
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        bool success = true;
+        for (size_t i = 0; i < count; i++) {
+            const Patch& patch = patches[i];
+            bool registered = std::any_of(s_sites.begin(), s_sites.end(),
+                [&patch](const Site& site) { return site.patch == &patch; });
+            if (registered) continue;
+
+            Site site;
+            if (!BuildSite(baseAddress, patch, site)) {
+                LOG_ERROR("[Patch] Malformed patch descriptor: " << patch.name);
+                success = false;
+                continue;
+            }
+            s_sites.push_back(site);
+        }
+        return success;
+    }
+
+    bool Apply(uint32_t groups) {
+        return SetGroups(groups, true);
+    }
+
+    bool Restore(uint32_t groups) {
+        return SetGroups(groups, false);
+    }
+
+    State GetState(uint32_t groups) {
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        bool anyOriginal = false, anyPatched = false;
+        for (const Site& site : s_sites) {
+            if (!(site.patch->groups & groups)) continue;
+            switch (ReadState(site)) {
+            case State::Original: anyOriginal = true; break;
+            case State::Patched:  anyPatched = true; break;
+            default:              return State::Unknown;
+            }
+        }
+
+        if (anyOriginal && anyPatched) return State::Mixed;
+        if (anyPatched) return State::Patched;
+        return anyOriginal ? State::Original : State::Unknown;
+    }
+
+    bool IsApplied(uint32_t groups) {
+        return GetState(groups) == State::Patched;
+    }
+
+    bool WriteCode(void* address, const void* data, size_t size) {
+        if (size == 0 || size > MAX_PATCH_BYTES) return false;
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_writes.clear();
+
+        PendingWrite write;
+        write.address = (uint8_t*)address;
+        write.size = size;
+        write.site = nullptr;
+        memcpy(write.bytes, data, size);
+        if (!ReadBytes(write.address, write.backup, size)) {
+            LOG_ERROR("[Patch] Cannot read 0x" << std::hex << (uintptr_t)address);
+            return false;
+        }
+        s_writes.push_back(write);
+        return Commit(s_writes);
+    }
+
+    void LogState() {
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        LOG_INFO("[Patch] " << s_sites.size() << " registered patch site(s):");
+        for (const Site& site : s_sites) {
+            State state = ReadState(site);
+            const char* stateName = state == State::Patched ? "patched" : state == State::Original ? "original" : "UNKNOWN";
+            LOG_INFO("[Patch]   0x" << std::hex << (uintptr_t)site.address << " groups 0x" << site.patch->groups
+                << std::dec << " " << stateName << " - " << site.patch->name);
+        }
+    }
+
+    void Shutdown() {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_sites.clear();
+        s_writes.clear();
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <Windows.h>
+#include <cstddef>
+#include <cstdint>
+
+// Central code patcher for the game module
+// Modules declare their patches as static tables (RVA, original bytes, patched bytes, groups)
+// and toggle them a group mask at a time. A transaction checks every site in the mask before
+// touching anything, then makes each affected page writable once, writes, restores the page
+// protection and flushes the instruction cache once. A site holding unexpected bytes fails
+// the whole transaction up front; a write that faults rolls back the sites already written.
+//
+// Byte patterns are hex strings: "73 1F". "??" matches any byte and is never written (used to
+// keep a jump's offset), and "|" separates alternative encodings of the same site, paired by
+// position between the original and patched strings: "75 ?? | 0F 85 ?? ?? ?? ??".
+
+namespace PatchManager {
+
+    // One bit per independently toggled patch set
+    enum Group : uint32_t {
+        GROUP_FAULT_CHECK                   = 1 << 0,   // SP completion fault limit
+        GROUP_TIME_CHECK                    = 1 << 1,   // SP completion time limit #1
+        GROUP_TIME_CHECK2                   = 1 << 2,   // SP completion time limit #2
+        GROUP_RACE_END_MESSAGE              = 1 << 3,
+        GROUP_TIMER_FREEZE                  = 1 << 4,
+        GROUP_MP_TIME_CHECKS                = 1 << 5,
+        GROUP_MP_FAULT_CHECKS               = 1 << 6,
+
+        GROUP_FINISH_LINE_CHECK             = 1 << 8,
+        GROUP_CHECKPOINT_EARLY_RETURN       = 1 << 9,
+        GROUP_UPDATE_CHECKPOINTS_CALL       = 1 << 10,
+        GROUP_UPDATE_CHECKPOINTS_FIRST_CALL = 1 << 11,
+
+        GROUP_LEADERBOARD_TRACK_CHECK       = 1 << 16,
+
+        GROUP_ALL_LIMITS = GROUP_FAULT_CHECK | GROUP_TIME_CHECK | GROUP_TIME_CHECK2 | GROUP_RACE_END_MESSAGE |
+                           GROUP_TIMER_FREEZE | GROUP_MP_TIME_CHECKS | GROUP_MP_FAULT_CHECKS,
+    };
+
+    struct Patch {
+        const char* name;
+        uintptr_t rva;
+        const char* original;
+        const char* patched;
+        uint32_t groups;
+    };
+
+    enum class State {
+        Original,
+        Patched,
+        Mixed,                              // Some sites patched, some not
+        Unknown,                            // A site holds neither form, or no site is registered
+    };
+
+    const size_t MAX_PATCH_BYTES = 32;
+
+    // Add a module's descriptor table (kept by pointer, so it must be static). Descriptors
+    // already registered are skipped; malformed ones are logged and left out.
+    bool Register(uintptr_t baseAddress, const Patch* patches, size_t count);
+
+    // Patch or restore every site in the groups as one transaction. Sites already in the
+    // requested state are left alone.
+    bool Apply(uint32_t groups);
+    bool Restore(uint32_t groups);
+
+    // Current state of the sites in the groups, read from game memory
+    State GetState(uint32_t groups);
+    bool IsApplied(uint32_t groups);
+
+    // Write raw bytes into game code (e.g. an immediate operand), with the same page
+    // protection and instruction cache handling as a patch
+    bool WriteCode(void* address, const void* data, size_t size);
+
+    // Log every registered site and its state
+    void LogState();
+
+    // Forget all sites (patched code is left as it is)
+    void Shutdown();
+}
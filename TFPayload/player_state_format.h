@@ -0,0 +1,348 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// On-disk format for per-race rider state recordings (.tfstate)
+//
+//   FileHeader (64 bytes)
+//   Chunk 0, Chunk 1, ...          ChunkHeader (16 bytes) + encoded frames
+//
+// Every frame stores each present rider's position and velocity quantized to integers and
+// encoded as the residual from a constant-acceleration prediction (2*q[t-1] - q[t-2]), so a
+// rider moving smoothly costs a mask byte plus a few one-byte varints per tick.
+// Predictors restart at each chunk, so chunks decode independently and a damaged chunk only
+// loses its own ticks. Reconstruction is exact in the quantized domain.
+// Header-only and Windows-free so tools/player_state_decoder can share it. Nothing in the
+// payload records races yet: the rider position/velocity offsets in the bike object and the
+// network player id of each bike slot are still unmapped.
+
+namespace PlayerStateFormat {
+
+    const uint32_t FILE_MAGIC = 0x53504654;     // "TFPS"
+    const uint32_t CHUNK_MAGIC = 0x43504654;    // "TFPC"
+    const uint16_t VERSION = 1;
+    const int MAX_RIDERS = 16;
+    const int FIELD_COUNT = 6;                  // Position xyz, velocity xyz
+
+    // Field mask bits in front of each rider record
+    const uint8_t MASK_CHECKPOINT = 1 << 6;
+    const uint8_t MASK_FLAGS = 1 << 7;
+
+    enum RiderFlags : uint8_t {
+        RIDER_READY = 1 << 0,
+        RIDER_LOCAL = 1 << 1
+    };
+
+#pragma pack(push, 1)
+    struct FileHeader {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t headerSize;
+        uint16_t maxRiders;
+        uint16_t chunkTicks;            // Ticks per chunk (predictor restart interval)
+        float positionQuantum;          // World units per position step
+        float velocityQuantum;          // World units/s per velocity step
+        uint64_t startUnixMicros;
+        char trackName[32];
+        uint8_t reserved[4];
+    };
+
+    struct ChunkHeader {
+        uint32_t magic;
+        uint32_t firstTick;
+        uint32_t frameCount;
+        uint32_t payloadBytes;
+    };
+#pragma pack(pop)
+
+    static_assert(sizeof(FileHeader) == 64, "FileHeader must stay 64 bytes");
+    static_assert(sizeof(ChunkHeader) == 16, "ChunkHeader must stay 16 bytes");
+
+    struct RiderSample {
+        uint32_t playerId;
+        float position[3];
+        float velocity[3];
+        uint32_t checkpointIndex;
+        uint8_t flags;
+    };
+
+    inline FileHeader MakeFileHeader(uint16_t chunkTicks, float positionQuantum, float velocityQuantum,
+                                     uint64_t startUnixMicros, const char* trackName) {
+        FileHeader header;
+        memset(&header, 0, sizeof(header));
+        header.magic = FILE_MAGIC;
+        header.version = VERSION;
+        header.headerSize = sizeof(FileHeader);
+        header.maxRiders = MAX_RIDERS;
+        header.chunkTicks = chunkTicks;
+        header.positionQuantum = positionQuantum;
+        header.velocityQuantum = velocityQuantum;
+        header.startUnixMicros = startUnixMicros;
+        if (trackName) {
+            strncpy(header.trackName, trackName, sizeof(header.trackName) - 1);
+        }
+        return header;
+    }
+
+    // ============================================================================
+    // Varint helpers
+    // ============================================================================
+
+    inline uint32_t ZigZag(int32_t value) {
+        return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+    }
+
+    inline int32_t UnZigZag(uint32_t value) {
+        return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+    }
+
+    inline void PutVarint(std::vector<uint8_t>& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back((uint8_t)(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back((uint8_t)value);
+    }
+
+    inline bool GetVarint(const uint8_t*& cursor, const uint8_t* end, uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64 && cursor < end; shift += 7) {
+            uint8_t byte = *cursor++;
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) return true;
+        }
+        return false;
+    }
+
+    inline int32_t Quantize(float value, float inverseQuantum) {
+        float scaled = value * inverseQuantum;
+        if (!(scaled > -1073741824.0f)) return -1073741824;     // Also catches NaN
+        if (scaled > 1073741823.0f) return 1073741823;
+        return (int32_t)lrintf(scaled);
+    }
+
+    // Predictor state shared by the encoder and decoder - both must evolve it identically
+    struct RiderHistory {
+        int count = 0;                  // Frames seen in this chunk (0 = next frame is a keyframe)
+        int32_t previous[FIELD_COUNT] = {};
+        int32_t beforePrevious[FIELD_COUNT] = {};
+        uint32_t checkpointIndex = 0;
+        uint8_t flags = 0;
+
+        // Wrapping unsigned arithmetic - residuals round-trip exactly even for extreme values
+        uint32_t Predict(int field) const {
+            if (count == 0) return 0;
+            if (count == 1) return (uint32_t)previous[field];
+            return 2u * (uint32_t)previous[field] - (uint32_t)beforePrevious[field];
+        }
+
+        void Push(const int32_t* values) {
+            memcpy(beforePrevious, previous, sizeof(previous));
+            memcpy(previous, values, sizeof(previous));
+            count++;
+        }
+    };
+
+    // ============================================================================
+    // Encoder - builds one chunk in memory
+    // ============================================================================
+
+    class ChunkEncoder {
+    public:
+        ChunkEncoder(float positionQuantum, float velocityQuantum)
+            : m_inversePosition(1.0f / positionQuantum), m_inverseVelocity(1.0f / velocityQuantum) {
+            m_payload.reserve(64 * 1024);
+        }
+
+        void Begin(uint32_t firstTick) {
+            m_payload.clear();
+            m_firstTick = firstTick;
+            m_lastTick = firstTick;
+            m_lastTimeUs = 0;
+            m_frames = 0;
+            for (int i = 0; i < MAX_RIDERS; i++) m_history[i] = RiderHistory();
+        }
+
+        // riders[slot] is used when bit `slot` of presentMask is set
+        void AddFrame(uint32_t tick, uint64_t timeUs, uint32_t presentMask, const RiderSample* riders) {
+            PutVarint(m_payload, tick - m_lastTick);
+            PutVarint(m_payload, m_frames == 0 ? timeUs : timeUs - m_lastTimeUs);
+            PutVarint(m_payload, presentMask);
+            m_lastTick = tick;
+            m_lastTimeUs = timeUs;
+            m_frames++;
+
+            for (int slot = 0; slot < MAX_RIDERS; slot++) {
+                RiderHistory& history = m_history[slot];
+                if (!(presentMask & (1u << slot))) {
+                    history.count = 0;      // Rider left - restart with a keyframe
+                    continue;
+                }
+                EncodeRider(history, riders[slot]);
+            }
+        }
+
+        const std::vector<uint8_t>& GetPayload() const { return m_payload; }
+        uint32_t GetFirstTick() const { return m_firstTick; }
+        uint32_t GetFrameCount() const { return m_frames; }
+
+        ChunkHeader MakeHeader() const {
+            ChunkHeader header;
+            header.magic = CHUNK_MAGIC;
+            header.firstTick = m_firstTick;
+            header.frameCount = m_frames;
+            header.payloadBytes = (uint32_t)m_payload.size();
+            return header;
+        }
+
+    private:
+        void EncodeRider(RiderHistory& history, const RiderSample& rider) {
+            int32_t values[FIELD_COUNT];
+            for (int i = 0; i < 3; i++) {
+                values[i] = Quantize(rider.position[i], m_inversePosition);
+                values[3 + i] = Quantize(rider.velocity[i], m_inverseVelocity);
+            }
+
+            uint32_t residuals[FIELD_COUNT];
+            uint8_t mask = 0;
+            for (int i = 0; i < FIELD_COUNT; i++) {
+                residuals[i] = ZigZag((int32_t)((uint32_t)values[i] - history.Predict(i)));
+                if (residuals[i] != 0) mask |= (uint8_t)(1 << i);
+            }
+            bool keyframe = history.count == 0;
+            int32_t checkpointDelta = (int32_t)(rider.checkpointIndex - (keyframe ? 0 : history.checkpointIndex));
+            if (checkpointDelta != 0) mask |= MASK_CHECKPOINT;
+            if (keyframe || rider.flags != history.flags) mask |= MASK_FLAGS;
+
+            m_payload.push_back(mask);
+            if (keyframe) PutVarint(m_payload, rider.playerId);
+            for (int i = 0; i < FIELD_COUNT; i++) {
+                if (residuals[i] != 0) PutVarint(m_payload, residuals[i]);
+            }
+            if (mask & MASK_CHECKPOINT) PutVarint(m_payload, ZigZag(checkpointDelta));
+            if (mask & MASK_FLAGS) m_payload.push_back(rider.flags);
+
+            history.checkpointIndex = rider.checkpointIndex;
+            history.flags = rider.flags;
+            history.Push(values);
+        }
+
+        float m_inversePosition;
+        float m_inverseVelocity;
+        std::vector<uint8_t> m_payload;
+        RiderHistory m_history[MAX_RIDERS];
+        uint32_t m_firstTick = 0;
+        uint32_t m_lastTick = 0;
+        uint64_t m_lastTimeUs = 0;
+        uint32_t m_frames = 0;
+    };
+
+    // ============================================================================
+    // Decoder - walks the frames of one chunk
+    // ============================================================================
+
+    struct Frame {
+        uint32_t tick = 0;
+        uint64_t timeUs = 0;            // Since race start
+        uint32_t presentMask = 0;
+        RiderSample riders[MAX_RIDERS];
+    };
+
+    class ChunkDecoder {
+    public:
+        ChunkDecoder(const FileHeader& file, const ChunkHeader& chunk, const uint8_t* payload)
+            : m_positionQuantum(file.positionQuantum), m_velocityQuantum(file.velocityQuantum),
+              m_cursor(payload), m_end(payload + chunk.payloadBytes),
+              m_framesLeft(chunk.frameCount), m_tick(chunk.firstTick) {
+            memset(m_playerIds, 0, sizeof(m_playerIds));
+        }
+
+        // Returns false at the end of the chunk or on malformed data
+        bool Next(Frame& frame) {
+            if (m_framesLeft == 0) return false;
+            uint64_t tickDelta, timeDelta, mask;
+            if (!GetVarint(m_cursor, m_end, tickDelta) || !GetVarint(m_cursor, m_end, timeDelta) ||
+                !GetVarint(m_cursor, m_end, mask)) {
+                return false;
+            }
+            m_tick += (uint32_t)tickDelta;
+            m_timeUs = m_first ? timeDelta : m_timeUs + timeDelta;
+            m_first = false;
+
+            frame.tick = m_tick;
+            frame.timeUs = m_timeUs;
+            frame.presentMask = (uint32_t)mask;
+            for (int slot = 0; slot < MAX_RIDERS; slot++) {
+                RiderHistory& history = m_history[slot];
+                if (!(mask & (1u << slot))) {
+                    history.count = 0;
+                    continue;
+                }
+                if (!DecodeRider(slot, history, frame.riders[slot])) return false;
+            }
+            m_framesLeft--;
+            return true;
+        }
+
+    private:
+        bool DecodeRider(int slot, RiderHistory& history, RiderSample& rider) {
+            if (m_cursor >= m_end) return false;
+            uint8_t mask = *m_cursor++;
+            bool keyframe = history.count == 0;
+            uint64_t value;
+
+            if (keyframe) {
+                if (!GetVarint(m_cursor, m_end, value)) return false;
+                m_playerIds[slot] = (uint32_t)value;
+            }
+
+            int32_t values[FIELD_COUNT];
+            for (int i = 0; i < FIELD_COUNT; i++) {
+                int32_t residual = 0;
+                if (mask & (1 << i)) {
+                    if (!GetVarint(m_cursor, m_end, value)) return false;
+                    residual = UnZigZag((uint32_t)value);
+                }
+                values[i] = (int32_t)(history.Predict(i) + (uint32_t)residual);
+            }
+
+            uint32_t checkpointIndex = keyframe ? 0 : history.checkpointIndex;
+            if (mask & MASK_CHECKPOINT) {
+                if (!GetVarint(m_cursor, m_end, value)) return false;
+                checkpointIndex += (uint32_t)UnZigZag((uint32_t)value);
+            }
+            uint8_t flags = history.flags;
+            if (mask & MASK_FLAGS) {
+                if (m_cursor >= m_end) return false;
+                flags = *m_cursor++;
+            }
+
+            history.checkpointIndex = checkpointIndex;
+            history.flags = flags;
+            history.Push(values);
+
+            rider.playerId = m_playerIds[slot];
+            for (int i = 0; i < 3; i++) {
+                rider.position[i] = values[i] * m_positionQuantum;
+                rider.velocity[i] = values[3 + i] * m_velocityQuantum;
+            }
+            rider.checkpointIndex = checkpointIndex;
+            rider.flags = flags;
+            return true;
+        }
+
+        float m_positionQuantum;
+        float m_velocityQuantum;
+        const uint8_t* m_cursor;
+        const uint8_t* m_end;
+        uint32_t m_framesLeft;
+        uint32_t m_tick;
+        uint64_t m_timeUs = 0;
+        bool m_first = true;
+        uint32_t m_playerIds[MAX_RIDERS];
+        RiderHistory m_history[MAX_RIDERS];
+    };
+
+} // namespace PlayerStateFormat
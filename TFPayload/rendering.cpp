@@ -2,6 +2,9 @@
 #include "pch.h"
 #include "rendering.h"
 #include "devMenu.h"
+#include "devMenuSync.h"
+#include "game_thread.h"
+#include "tweakable_sampler.h"
 #include "logging.h"
 #include "imgui/imgui.h"
 #include <iostream>
@@ -24,6 +27,15 @@ static bool g_LastDevMenuVisible = false;
 // Safe callback with protection
 void TFPayloadRenderCallback()
 {
+    // Run engine calls queued by hotkeys and DevMenu buttons at a fixed point in the frame
+    GameThread::Drain();
+
+    // Pull in tweakables the game changed since the last frame
+    DevMenuSync::ApplyLiveChanges();
+
+    // Record sampled tweakables and the frame time (no-op with no channels)
+    TweakableSampler::Sample();
+
     // Get and set ImGui context from ProxyDLL
     if (g_GetImGuiContext) {
         ImGuiContext* ctx = g_GetImGuiContext();
@@ -83,8 +95,11 @@ void TFPayloadRenderCallback()
             ImGui::End();
         }
         
-        // Try to render DevMenu (or just keybindings window)
-        if (g_DevMenu && (g_DevMenu->IsVisible() || g_DevMenu->IsKeybindingsWindowVisible())) {
+        // Try to render DevMenu (or just its standalone windows)
+        if (g_DevMenu && (g_DevMenu->IsVisible() || g_DevMenu->IsKeybindingsWindowVisible() ||
+                          g_DevMenu->IsAnalyticsWindowVisible() || g_DevMenu->IsNetworkOverlayVisible() ||
+                          g_DevMenu->IsNetworkDashboardVisible() || g_DevMenu->IsSamplerWindowVisible() ||
+                          g_DevMenu->IsChangesWindowVisible())) {
             try {
                 g_DevMenu->Render();
             }
@@ -97,6 +112,11 @@ void TFPayloadRenderCallback()
                 g_DevMenu->Hide();
             }
         }
+
+        // Write this frame's menu edits to the game in one batch
+        if (g_DevMenu) {
+            g_DevMenu->GetJournal().Flush();
+        }
     }
     catch (const std::exception& e) {
         LOG_ERROR("[Render] Callback exception: " << e.what());
@@ -2,7 +2,12 @@
 #include "respawn.h"
 #include "logging.h"
 #include "keybindings.h"
+#include "game_thread.h"
+#include "patch_manager.h"
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 #include <Windows.h>
 
 namespace Respawn {
@@ -54,6 +59,55 @@ namespace Respawn {
     static constexpr uint32_t DEFAULT_TIME_LIMIT = 0x1A5E0;    // 30 minutes
     static constexpr uint32_t DEFAULT_FAULT_LIMIT = 0x1F4;     // 500 faults
 
+    // ============================================================================
+    // Code Patches (applied through PatchManager)
+    // CALL operands are fixed: caller and callee are both in the game module.
+    // ============================================================================
+
+    static const PatchManager::Patch PATCHES[] = {
+        // JNC -> NOPs
+        { "Fault limit check (SP)", COMPLETION_COND_FAULT_JNC_RVA, "73 1F", "90 90", PatchManager::GROUP_FAULT_CHECK },
+        { "Time limit check #1 (SP)", COMPLETION_COND_TIME_JNC_RVA, "73 30", "90 90", PatchManager::GROUP_TIME_CHECK },
+        // JC -> JMP
+        { "Time limit check #2 (SP)", COMPLETION_COND_TIME2_JC_RVA, "72 13", "EB 13", PatchManager::GROUP_TIME_CHECK2 },
+        // PUSH EAX; PUSH 1; MOV ECX,EDI; CALL InitializeObjectStruct ->
+        // TEST EAX,EAX; JNZ +0x25; PUSH 0; PUSH 1; MOV ... (skips the finish message if limits were exceeded)
+        { "Race end message", UPDATE_RACE_END_PUSH_RVA, "50 6A 01 8B CF E8 63 4C DD", "85 C0 75 25 6A 00 6A 01 8B",
+            PatchManager::GROUP_RACE_END_MESSAGE },
+        { "RaceUpdate timer freeze", RACEUPDATE_TIMER_CHECK_RVA + 6, "73 12", "90 90", PatchManager::GROUP_TIMER_FREEZE },
+        { "Time limit check (MP mode 1)", MULTIPLAYER_MODE1_TIME_JNC_RVA, "73 04", "90 90", PatchManager::GROUP_MP_TIME_CHECKS },
+        { "Time limit check (MP mode 2)", MULTIPLAYER_MODE2_TIME_JNC_RVA, "73 04", "90 90", PatchManager::GROUP_MP_TIME_CHECKS },
+        // JNZ respawn on fault >= 500 -> NOPs
+        { "Fault limit check (MP mode 1)", MULTIPLAYER_MODE1_FAULT_JNZ_RVA, "75 C9", "90 90", PatchManager::GROUP_MP_FAULT_CHECKS },
+        { "Fault limit check (MP mode 2)", MULTIPLAYER_MODE2_FAULT_JNZ_RVA, "75 C9", "90 90", PatchManager::GROUP_MP_FAULT_CHECKS },
+
+        // JNZ -> JMP so the finish logic is always skipped (short or near form, offset kept)
+        { "Finish line check", PROCESS_CHECKPOINT_FINISH_CHECK_RVA, "75 ?? | 0F 85 ?? ?? ?? ??", "EB ?? | 90 E9 ?? ?? ?? ??",
+            PatchManager::GROUP_FINISH_LINE_CHECK },
+        // MOV ECX,0x10; OR [EAX+0xA],CX; OR [EAX+0x8],CX ->
+        // TEST word ptr [EAX+0x8],0x10; JNZ 0x928fc0 (exit); NOP - skip checkpoints already triggered
+        { "Checkpoint early return", PROCESS_CHECKPOINT_EARLY_CHECK_RVA + 0xD,
+            "B9 10 00 00 00 66 09 48 0A 66 09 48 08",
+            "66 F7 40 08 10 00 0F 85 1F 02 00 00 90",
+            PatchManager::GROUP_CHECKPOINT_EARLY_RETURN },
+        // 0x9297ac-0x9297c2: PUSH ECX; MOVSS [ESP],XMM0; PUSH EDI; MOV ECX,ESI; CALL ProcessCheckpointReached;
+        // MOV EBX,[EBP-0x24]; MOV [ESI+0x1dc],EDI -> JMP 0x9297c3 + NOPs
+        { "UpdateCheckpointsInRange loop call", UPDATE_CHECKPOINTS_CALL_RVA,
+            "51 F3 0F 11 04 24 57 8B CE E8 A6 F3 FF FF 8B 5D DC 89 BE DC 01 00 00",
+            "EB 15 90 90 90 90 90 90 90 90 90 90 90 90 90 90 90 90 90 90 90 90 90",
+            PatchManager::GROUP_UPDATE_CHECKPOINTS_CALL },
+        // 0x929529-0x92953f: XORPS XMM0,XMM0; PUSH ECX; MOV ECX,[ESI+0x1dc]; MOVSS [ESP],XMM0; PUSH ECX;
+        // MOV ECX,ESI; CALL ProcessCheckpointReached -> JMP 0x929540 + NOPs
+        { "UpdateCheckpointsInRange first call", UPDATE_CHECKPOINTS_FIRST_CALL_RVA,
+            "0F 57 C0 51 8B 8E DC 01 00 00 F3 0F 11 04 24 51 8B CE E8 20 F6 FF FF",
+            "EB 15 90 90 90 90 90 90 90 90 90 90 90 90 90 90 90 90 90 90 90 90 90",
+            PatchManager::GROUP_UPDATE_CHECKPOINTS_FIRST_CALL },
+    };
+
+    // Patched together by DisableFinishLine
+    static constexpr uint32_t FINISH_LINE_GROUPS = PatchManager::GROUP_FINISH_LINE_CHECK |
+        PatchManager::GROUP_UPDATE_CHECKPOINTS_CALL | PatchManager::GROUP_UPDATE_CHECKPOINTS_FIRST_CALL;
+
     // ============================================================================
     // Function Pointer Types
     // ============================================================================
@@ -260,86 +314,149 @@ namespace Respawn {
         return nextNode;
     }
 
-    static void* GetCheckpointAtIndex(void* listBase, int index) {
-        void* node = GetFirstListNode(listBase);
+    static void* GetCurrentCheckpoint(void* bikePtr) {
+        if (!bikePtr || IsBadReadPtr(bikePtr, 0x200)) {
+            return nullptr;
+        }
 
-        for (int i = 0; node != nullptr && i < index; i++) {
-            node = GetNextListNode(node);
-            if (node && IsBadReadPtr(node, 0x10)) {
-                return nullptr;
-            }
+        uintptr_t checkpointAddr = reinterpret_cast<uintptr_t>(bikePtr) + 0x1dc;
+        if (IsBadReadPtr((void*)checkpointAddr, sizeof(void*))) {
+            return nullptr;
         }
 
-        if (!node) {
+        void* checkpoint = *reinterpret_cast<void**>(checkpointAddr);
+        if (!checkpoint || IsBadReadPtr(checkpoint, 0x160)) {
             return nullptr;
         }
 
-        return GetCheckpointFromNode(node);
+        return checkpoint;
     }
 
-    static int CountCheckpoints(void* listBase) {
+    // ============================================================================
+    // Checkpoint Cache
+    // ============================================================================
+    // The checkpoint list is walked once per track into arrays, so index -> node -> checkpoint
+    // and checkpoint -> index are O(1). Track updates drop the cache (OnTrackChanged), and since
+    // pooled nodes can be reused for a new track without a notification, every lookup also checks
+    // (in O(1)) that both ends of the list are unchanged: the head and its checkpoint, and the
+    // tail's checkpoint and next link. The node a lookup returns must still hold its checkpoint;
+    // otherwise the list is walked again.
+
+    static constexpr int MAX_CHECKPOINTS = 1000;
+
+    struct CheckpointCache {
+        void* listBase = nullptr;
+        void* firstNode = nullptr;
+        void* firstCheckpoint = nullptr;
+        void* lastNode = nullptr;
+        void* lastCheckpoint = nullptr;
+        void* lastNext = nullptr;                           // Tail's next link (null, or the head if circular)
+        std::vector<void*> nodes;                           // By index
+        std::vector<void*> checkpoints;                     // By index, nullptr for unreadable nodes
+        std::unordered_map<void*, int> indexByCheckpoint;
+        void* missedCheckpoint = nullptr;                   // Last lookup that wasn't found even after a rebuild
+    };
+
+    // Respawn runs on the game thread, the DevMenu on the render thread, the recorder in multiplayer hooks
+    static std::mutex g_checkpointCacheMutex;
+    static CheckpointCache g_checkpointCache;
+
+    static void RebuildCheckpointCache(void* listBase) {
+        CheckpointCache& cache = g_checkpointCache;
+        cache.listBase = listBase;
+        cache.nodes.clear();
+        cache.checkpoints.clear();
+        cache.indexByCheckpoint.clear();
+        cache.missedCheckpoint = nullptr;
+
         void* node = GetFirstListNode(listBase);
-        void* firstNode = node;
-        int count = 0;
+        cache.firstNode = node;
+        cache.firstCheckpoint = node ? GetCheckpointFromNode(node) : nullptr;
 
-        while (node != nullptr && count < 1000) {
-            count++;
-            node = GetNextListNode(node);
+        while (node != nullptr && (int)cache.nodes.size() < MAX_CHECKPOINTS) {
+            void* checkpoint = GetCheckpointFromNode(node);
+            if (checkpoint) {
+                cache.indexByCheckpoint.emplace(checkpoint, (int)cache.nodes.size());
+            }
+            cache.nodes.push_back(node);
+            cache.checkpoints.push_back(checkpoint);
 
-            if (node == firstNode) {
+            node = GetNextListNode(node);
+            if (node == cache.firstNode) {
                 break;
             }
-
             if (node && IsBadReadPtr(node, 0x10)) {
                 break;
             }
         }
 
-        return count;
+        cache.lastNode = cache.nodes.empty() ? nullptr : cache.nodes.back();
+        cache.lastCheckpoint = cache.checkpoints.empty() ? nullptr : cache.checkpoints.back();
+        cache.lastNext = GetNextListNode(cache.lastNode);
+
+        LOG_VERBOSE("[Respawn] Cached " << std::dec << cache.nodes.size() << " checkpoints");
     }
 
-    static void* GetCurrentCheckpoint(void* bikePtr) {
-        if (!bikePtr || IsBadReadPtr(bikePtr, 0x200)) {
-            return nullptr;
+    // Caller holds g_checkpointCacheMutex
+    static CheckpointCache& GetCheckpointCache(void* listBase) {
+        CheckpointCache& cache = g_checkpointCache;
+        void* firstNode = GetFirstListNode(listBase);
+        bool current = listBase == cache.listBase && firstNode == cache.firstNode &&
+            (!firstNode || GetCheckpointFromNode(firstNode) == cache.firstCheckpoint) &&
+            (!cache.lastNode || (GetCheckpointFromNode(cache.lastNode) == cache.lastCheckpoint &&
+                                 GetNextListNode(cache.lastNode) == cache.lastNext));
+        if (!current) {
+            RebuildCheckpointCache(listBase);
         }
+        return cache;
+    }
 
-        uintptr_t checkpointAddr = reinterpret_cast<uintptr_t>(bikePtr) + 0x1dc;
-        if (IsBadReadPtr((void*)checkpointAddr, sizeof(void*))) {
+    static void InvalidateCheckpointCache() {
+        std::lock_guard<std::mutex> lock(g_checkpointCacheMutex);
+        g_checkpointCache = CheckpointCache();
+    }
+
+    static void* GetCheckpointAtIndex(void* listBase, int index) {
+        std::lock_guard<std::mutex> lock(g_checkpointCacheMutex);
+        CheckpointCache* cache = &GetCheckpointCache(listBase);
+        if (index < 0 || index >= (int)cache->nodes.size()) {
             return nullptr;
         }
 
-        void* checkpoint = *reinterpret_cast<void**>(checkpointAddr);
-        if (!checkpoint || IsBadReadPtr(checkpoint, 0x160)) {
-            return nullptr;
+        // A node that no longer holds its checkpoint means the list was rebuilt in place
+        if (GetCheckpointFromNode(cache->nodes[index]) != cache->checkpoints[index]) {
+            RebuildCheckpointCache(listBase);
+            if (index >= (int)cache->nodes.size()) {
+                return nullptr;
+            }
         }
+        return cache->checkpoints[index];
+    }
 
-        return checkpoint;
+    static int CountCheckpoints(void* listBase) {
+        std::lock_guard<std::mutex> lock(g_checkpointCacheMutex);
+        return (int)GetCheckpointCache(listBase).nodes.size();
     }
 
     static int FindCheckpointNodeIndex(void* listBase, void* targetCheckpoint) {
-        void* node = GetFirstListNode(listBase);
-        void* firstNode = node;
-        int index = 0;
-
-        while (node != nullptr && index < 1000) {
-            void* checkpoint = GetCheckpointFromNode(node);
-            if (checkpoint == targetCheckpoint) {
-                return index;
-            }
-
-            index++;
-            node = GetNextListNode(node);
-
-            if (node == firstNode) {
-                break;
-            }
-
-            if (node && IsBadReadPtr(node, 0x10)) {
-                break;
-            }
+        std::lock_guard<std::mutex> lock(g_checkpointCacheMutex);
+        CheckpointCache& cache = GetCheckpointCache(listBase);
+        auto it = cache.indexByCheckpoint.find(targetCheckpoint);
+        if (it != cache.indexByCheckpoint.end() && GetCheckpointFromNode(cache.nodes[it->second]) == targetCheckpoint) {
+            return it->second;
+        }
+        if (it == cache.indexByCheckpoint.end() && targetCheckpoint == cache.missedCheckpoint) {
+            return -1;
         }
 
-        return -1;
+        // Not where the cache says: walk the list again in case it changed
+        RebuildCheckpointCache(listBase);
+        it = cache.indexByCheckpoint.find(targetCheckpoint);
+        if (it == cache.indexByCheckpoint.end()) {
+            cache.missedCheckpoint = targetCheckpoint;
+            return -1;
+        }
+        return it->second;
     }
 
     // ============================================================================
@@ -621,28 +738,27 @@ namespace Respawn {
     // Limit Modification Functions
     // ============================================================================
 
-    bool SetFaultLimit(uint32_t newLimit) {
+    static bool WriteLimit(uintptr_t rva, uint32_t newLimit, const char* which) {
         if (!g_initialized) {
             LOG_ERROR("[Limits] Not initialized");
             return false;
         }
 
-        uintptr_t patchAddr = g_baseAddress + FAULT_LIMIT_CMP_RVA;
-
-        DWORD oldProtect;
-        if (!VirtualProtect((void*)patchAddr, sizeof(uint32_t), PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[Limits] Failed to change memory protection for fault limit");
+        uint32_t* patchAddr = reinterpret_cast<uint32_t*>(g_baseAddress + rva);
+        uint32_t currentLimit = *patchAddr;
+        if (!PatchManager::WriteCode(patchAddr, &newLimit, sizeof(newLimit))) {
+            LOG_ERROR("[Limits] Failed to write " << which << " limit");
             return false;
         }
 
-        uint32_t currentLimit = *reinterpret_cast<uint32_t*>(patchAddr);
-        *reinterpret_cast<uint32_t*>(patchAddr) = newLimit;
-        VirtualProtect((void*)patchAddr, sizeof(uint32_t), oldProtect, &oldProtect);
-
-        LOG_INFO("[Limits] Changed fault limit from " << std::dec << currentLimit << " to " << newLimit);
+        LOG_INFO("[Limits] Changed " << which << " limit from " << std::dec << currentLimit << " to " << newLimit);
         return true;
     }
 
+    bool SetFaultLimit(uint32_t newLimit) {
+        return WriteLimit(FAULT_LIMIT_CMP_RVA, newLimit, "fault");
+    }
+
     uint32_t GetFaultLimit() {
         if (!g_initialized) {
             return DEFAULT_FAULT_LIMIT;
@@ -657,25 +773,7 @@ namespace Respawn {
     }
 
     bool SetTimeLimit(uint32_t newLimit) {
-        if (!g_initialized) {
-            LOG_ERROR("[Limits] Not initialized");
-            return false;
-        }
-
-        uintptr_t patchAddr = g_baseAddress + TIME_LIMIT_CMP_RVA;
-
-        DWORD oldProtect;
-        if (!VirtualProtect((void*)patchAddr, sizeof(uint32_t), PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[Limits] Failed to change memory protection for time limit");
-            return false;
-        }
-
-        uint32_t currentLimit = *reinterpret_cast<uint32_t*>(patchAddr);
-        *reinterpret_cast<uint32_t*>(patchAddr) = newLimit;
-        VirtualProtect((void*)patchAddr, sizeof(uint32_t), oldProtect, &oldProtect);
-
-        LOG_INFO("[Limits] Changed time limit from " << std::dec << currentLimit << " to " << newLimit);
-        return true;
+        return WriteLimit(TIME_LIMIT_CMP_RVA, newLimit, "time");
     }
 
     uint32_t GetTimeLimit() {
@@ -706,973 +804,83 @@ namespace Respawn {
         return success;
     }
 
-    // Limit Bypass Functions
-    bool DisableCompletionConditionCheck() {
-        if (!g_initialized) {
-            LOG_ERROR("[CompletionFix] Not initialized");
-            return false;
-        }
-
-        uintptr_t jncAddr = g_baseAddress + COMPLETION_COND_FAULT_JNC_RVA;
-
-        LOG_VERBOSE("[CompletionFix] Patching fault limit check at 0x" << std::hex << jncAddr);
-
-        if (IsBadReadPtr((void*)jncAddr, 6)) {
-            LOG_ERROR("[CompletionFix] Cannot read JNC address");
-            return false;
-        }
-
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(jncAddr);
-
-        if (bytes[0] == 0x90 && bytes[1] == 0x90) {
-            LOG_VERBOSE("[CompletionFix] Already patched (found NOPs)");
-            return true;
-        }
-
-        bool isShortJNC = (bytes[0] == 0x73);
-        bool isLongJNC = (bytes[0] == 0x0F && bytes[1] == 0x83);
-
-        if (!isShortJNC && !isLongJNC) {
-            LOG_ERROR("[CompletionFix] Expected JNC, found 0x"
-                << std::hex << (int)bytes[0] << " " << (int)bytes[1]);
-            return false;
-        }
-
-        DWORD oldProtect;
-        int patchSize = isShortJNC ? 2 : 6;
-
-        if (!VirtualProtect((void*)jncAddr, patchSize, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[CompletionFix] Failed to change memory protection");
-            return false;
-        }
-
-        for (int i = 0; i < patchSize; i++) {
-            bytes[i] = 0x90;
-        }
-
-        VirtualProtect((void*)jncAddr, patchSize, oldProtect, &oldProtect);
-
-        LOG_VERBOSE("[CompletionFix] SUCCESS! Fault limit check disabled");
-        return true;
-    }
-
-    bool DisableTimeCompletionCheck() {
-        if (!g_initialized) {
-            LOG_ERROR("[TimeFix] Not initialized");
-            return false;
-        }
-
-        uintptr_t jncAddr = g_baseAddress + COMPLETION_COND_TIME_JNC_RVA;
-
-        LOG_VERBOSE("[TimeFix] Patching time limit check #1 at 0x" << std::hex << jncAddr);
-
-        if (IsBadReadPtr((void*)jncAddr, 6)) {
-            LOG_ERROR("[TimeFix] Cannot read JNC address");
-            return false;
-        }
-
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(jncAddr);
-
-        if (bytes[0] == 0x90 && bytes[1] == 0x90) {
-            LOG_INFO("[TimeFix] Already patched (found NOPs)");
-            return true;
-        }
-
-        bool isShortJNC = (bytes[0] == 0x73);
-        bool isLongJNC = (bytes[0] == 0x0F && bytes[1] == 0x83);
-
-        if (!isShortJNC && !isLongJNC) {
-            LOG_ERROR("[TimeFix] Expected JNC, found 0x"
-                << std::hex << (int)bytes[0] << " " << (int)bytes[1]);
-            return false;
-        }
-
-        DWORD oldProtect;
-        int patchSize = isShortJNC ? 2 : 6;
-
-        if (!VirtualProtect((void*)jncAddr, patchSize, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[TimeFix] Failed to change memory protection");
-            return false;
-        }
-
-        for (int i = 0; i < patchSize; i++) {
-            bytes[i] = 0x90;
-        }
-
-        VirtualProtect((void*)jncAddr, patchSize, oldProtect, &oldProtect);
-
-        LOG_VERBOSE("[TimeFix] SUCCESS! Time limit check #1 disabled");
-        return true;
-    }
-
-    bool DisableTimeCompletionCheck2() {
-        if (!g_initialized) {
-            LOG_ERROR("[TimeFix2] Not initialized");
-            return false;
-        }
-
-        uintptr_t jcAddr = g_baseAddress + COMPLETION_COND_TIME2_JC_RVA;
-
-        LOG_VERBOSE("[TimeFix2] Patching time limit check #2 at 0x" << std::hex << jcAddr);
-
-        if (IsBadReadPtr((void*)jcAddr, 2)) {
-            LOG_ERROR("[TimeFix2] Cannot read JC address");
-            return false;
-        }
-
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(jcAddr);
-
-        if ((bytes[0] == 0xEB && bytes[1] == 0x13) || (bytes[0] == 0x90 && bytes[1] == 0x90)) {
-            LOG_VERBOSE("[TimeFix2] Already patched (found " << (bytes[0] == 0xEB ? "JMP" : "NOPs") << ")");
-            return true;
-        }
-
-        if (bytes[0] != 0x72) {
-            LOG_ERROR("[TimeFix2] Expected JC (0x72), found 0x" << std::hex << (int)bytes[0]);
-            return false;
-        }
-
-        DWORD oldProtect;
-        if (!VirtualProtect((void*)jcAddr, 2, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[TimeFix2] Failed to change memory protection");
-            return false;
-        }
-
-        bytes[0] = 0xEB;
-        bytes[1] = 0x13;
-
-        VirtualProtect((void*)jcAddr, 2, oldProtect, &oldProtect);
-
-        LOG_VERBOSE("[TimeFix2] SUCCESS! Changed JC to JMP - timer won't freeze!");
-        return true;
-    }
-
-    bool ForceRaceEndSuccess() {
-        if (!g_initialized) {
-            LOG_ERROR("[FinalFix] Not initialized");
-            return false;
-        }
-
-        uintptr_t pushAddr = g_baseAddress + UPDATE_RACE_END_PUSH_RVA;
-
-        LOG_VERBOSE("[FinalFix] Patching UpdateRaceEndState at 0x" << std::hex << pushAddr);
-
-        if (IsBadReadPtr((void*)pushAddr, 9)) {
-            LOG_ERROR("[FinalFix] Cannot read patch address");
-            return false;
-        }
-
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(pushAddr);
-
-        if (bytes[0] == 0x85 && bytes[1] == 0xC0) {
-            LOG_VERBOSE("[FinalFix] Already patched (found TEST EAX,EAX)");
-            return true;
-        }
-
-        if (bytes[0] != 0x50) {
-            LOG_ERROR("[FinalFix] Expected PUSH EAX (0x50), found 0x" << std::hex << (int)bytes[0]);
-            return false;
-        }
-
-        DWORD oldProtect;
-        if (!VirtualProtect((void*)pushAddr, 9, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[FinalFix] Failed to change memory protection");
-            return false;
-        }
-
-        bytes[0] = 0x85;  // TEST
-        bytes[1] = 0xC0;  // EAX, EAX
-        bytes[2] = 0x75;  // JNZ
-        bytes[3] = 0x25;  // +0x25
-        bytes[4] = 0x6A;  // PUSH
-        bytes[5] = 0x00;  // 0
-        bytes[6] = 0x6A;  // PUSH
-        bytes[7] = 0x01;  // 0x1
-        bytes[8] = 0x8B;  // MOV
-
-        VirtualProtect((void*)pushAddr, 9, oldProtect, &oldProtect);
-
-        LOG_VERBOSE("[LimitBypass] SUCCESS! Will skip finish message if limits exceeded");
-        return true;
-    }
-
-    bool DisableRaceUpdateTimerFreeze() {
-        if (!g_initialized) {
-            LOG_ERROR("[TimerFreezeFix] Not initialized");
-            return false;
-        }
-
-        uintptr_t jncAddr = g_baseAddress + RACEUPDATE_TIMER_CHECK_RVA + 6;
-
-        LOG_VERBOSE("[TimerFreezeFix] Patching timer freeze JNC in RaceUpdate at 0x" << std::hex << jncAddr);
-
-        if (IsBadReadPtr((void*)jncAddr, 6)) {
-            LOG_ERROR("[TimerFreezeFix] Cannot read JNC address");
-            return false;
-        }
-
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(jncAddr);
-
-        if (bytes[0] == 0x90 && bytes[1] == 0x90) {
-            LOG_VERBOSE("[TimerFreezeFix] Already patched (found NOPs)");
-            return true;
-        }
-
-        DWORD oldProtect;
-        int patchSize;
-
-        if (bytes[0] == 0x73) {
-            patchSize = 2;
-            LOG_VERBOSE("[TimerFreezeFix] Found short JNC (73 " << std::hex << (int)bytes[1] << ")");
-        }
-        else if (bytes[0] == 0x0F && bytes[1] == 0x83) {
-            patchSize = 6;
-            LOG_VERBOSE("[TimerFreezeFix] Found long JNC (0F 83)");
-        }
-        else {
-            LOG_ERROR("[TimerFreezeFix] Expected JNC (73 or 0F 83), found: "
-                << std::hex << (int)bytes[0] << " " << (int)bytes[1]);
-            return false;
-        }
-
-        if (!VirtualProtect((void*)jncAddr, patchSize, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[TimerFreezeFix] Failed to change memory protection");
-            return false;
-        }
-
-        for (int i = 0; i < patchSize; i++) {
-            bytes[i] = 0x90;
-        }
-
-        VirtualProtect((void*)jncAddr, patchSize, oldProtect, &oldProtect);
-
-        LOG_VERBOSE("[TimerFreezeFix] SUCCESS! NOPed " << std::dec << patchSize << " bytes - Timer will continue past 30 minutes!");
-        return true;
-    }
-
-    bool DisableMultiplayerTimeChecks() {
-        if (!g_initialized) {
-            LOG_ERROR("[MPTimeFix] Not initialized");
-            return false;
-        }
-
-        bool success = true;
-
-        // Patch multiplayer mode 1 time check
-        uintptr_t mp1JncAddr = g_baseAddress + MULTIPLAYER_MODE1_TIME_JNC_RVA;
-        LOG_VERBOSE("[MPTimeFix] Patching multiplayer mode 1 time check at 0x" << std::hex << mp1JncAddr);
-
-        if (IsBadReadPtr((void*)mp1JncAddr, 6)) {
-            LOG_ERROR("[MPTimeFix] Cannot read MP1 JNC address");
-            success = false;
-        }
-        else {
-            uint8_t* bytes = reinterpret_cast<uint8_t*>(mp1JncAddr);
-
-            if (bytes[0] == 0x90 && bytes[1] == 0x90) {
-                LOG_VERBOSE("[MPTimeFix] MP1 already patched");
-            }
-            else {
-                bool isShortJNC = (bytes[0] == 0x73);
-                bool isLongJNC = (bytes[0] == 0x0F && bytes[1] == 0x83);
-
-                if (isShortJNC || isLongJNC) {
-                    DWORD oldProtect;
-                    int patchSize = isShortJNC ? 2 : 6;
-
-                    if (VirtualProtect((void*)mp1JncAddr, patchSize, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-                        for (int i = 0; i < patchSize; i++) {
-                            bytes[i] = 0x90;
-                        }
-                        VirtualProtect((void*)mp1JncAddr, patchSize, oldProtect, &oldProtect);
-                        LOG_VERBOSE("[MPTimeFix] MP1 time check disabled");
-                    }
-                    else {
-                        LOG_ERROR("[MPTimeFix] Failed to patch MP1");
-                        success = false;
-                    }
-                }
-                else {
-                    LOG_ERROR("[MPTimeFix] MP1: Expected JNC, found 0x" << std::hex << (int)bytes[0]);
-                    success = false;
-                }
-            }
-        }
-
-        // Patch multiplayer mode 2 time check
-        uintptr_t mp2JncAddr = g_baseAddress + MULTIPLAYER_MODE2_TIME_JNC_RVA;
-        LOG_VERBOSE("[MPTimeFix] Patching multiplayer mode 2 time check at 0x" << std::hex << mp2JncAddr);
-
-        if (IsBadReadPtr((void*)mp2JncAddr, 6)) {
-            LOG_ERROR("[MPTimeFix] Cannot read MP2 JNC address");
-            success = false;
-        }
-        else {
-            uint8_t* bytes = reinterpret_cast<uint8_t*>(mp2JncAddr);
-
-            if (bytes[0] == 0x90 && bytes[1] == 0x90) {
-                LOG_VERBOSE("[MPTimeFix] MP2 already patched");
-            }
-            else {
-                bool isShortJNC = (bytes[0] == 0x73);
-                bool isLongJNC = (bytes[0] == 0x0F && bytes[1] == 0x83);
-
-                if (isShortJNC || isLongJNC) {
-                    DWORD oldProtect;
-                    int patchSize = isShortJNC ? 2 : 6;
-
-                    if (VirtualProtect((void*)mp2JncAddr, patchSize, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-                        for (int i = 0; i < patchSize; i++) {
-                            bytes[i] = 0x90;
-                        }
-                        VirtualProtect((void*)mp2JncAddr, patchSize, oldProtect, &oldProtect);
-                        LOG_VERBOSE("[MPTimeFix] MP2 time check disabled");
-                    }
-                    else {
-                        LOG_ERROR("[MPTimeFix] Failed to patch MP2");
-                        success = false;
-                    }
-                }
-                else {
-                    LOG_ERROR("[MPTimeFix] MP2: Expected JNC, found 0x" << std::hex << (int)bytes[0]);
-                    success = false;
-                }
-            }
-        }
-
-        if (success) {
-            LOG_VERBOSE("[MPTimeFix] SUCCESS! Multiplayer time checks disabled");
-        }
-
-        return success;
-    }
-
-    bool DisableMultiplayerFaultChecks() {
-        if (!g_initialized) {
-            LOG_ERROR("[MPFaultFix] Not initialized");
-            return false;
-        }
-
-        bool success = true;
-
-        // Patch multiplayer mode 1 fault check (NOP the JNZ that respawns on fault >= 500)
-        uintptr_t mp1JnzAddr = g_baseAddress + MULTIPLAYER_MODE1_FAULT_JNZ_RVA;
-        LOG_VERBOSE("[MPFaultFix] Patching multiplayer mode 1 fault check at 0x" << std::hex << mp1JnzAddr);
-
-        if (IsBadReadPtr((void*)mp1JnzAddr, 6)) {
-            LOG_ERROR("[MPFaultFix] Cannot read MP1 JNZ address");
-            success = false;
-        }
-        else {
-            uint8_t* bytes = reinterpret_cast<uint8_t*>(mp1JnzAddr);
-
-            if (bytes[0] == 0x90 && bytes[1] == 0x90) {
-                LOG_VERBOSE("[MPFaultFix] MP1 already patched");
-            }
-            else {
-                // Check for short JNZ (0x75) or long JNZ (0x0F 0x85)
-                bool isShortJNZ = (bytes[0] == 0x75);
-                bool isLongJNZ = (bytes[0] == 0x0F && bytes[1] == 0x85);
-
-                if (isShortJNZ || isLongJNZ) {
-                    DWORD oldProtect;
-                    int patchSize = isShortJNZ ? 2 : 6;
-
-                    if (VirtualProtect((void*)mp1JnzAddr, patchSize, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-                        for (int i = 0; i < patchSize; i++) {
-                            bytes[i] = 0x90;
-                        }
-                        VirtualProtect((void*)mp1JnzAddr, patchSize, oldProtect, &oldProtect);
-                        LOG_VERBOSE("[MPFaultFix] MP1 fault check disabled");
-                    }
-                    else {
-                        LOG_ERROR("[MPFaultFix] Failed to patch MP1");
-                        success = false;
-                    }
-                }
-                else {
-                    LOG_ERROR("[MPFaultFix] MP1: Expected JNZ, found 0x" << std::hex << (int)bytes[0]);
-                    success = false;
-                }
-            }
-        }
-
-        // Patch multiplayer mode 2 fault check
-        uintptr_t mp2JnzAddr = g_baseAddress + MULTIPLAYER_MODE2_FAULT_JNZ_RVA;
-        LOG_VERBOSE("[MPFaultFix] Patching multiplayer mode 2 fault check at 0x" << std::hex << mp2JnzAddr);
-
-        if (IsBadReadPtr((void*)mp2JnzAddr, 6)) {
-            LOG_ERROR("[MPFaultFix] Cannot read MP2 JNZ address");
-            success = false;
-        }
-        else {
-            uint8_t* bytes = reinterpret_cast<uint8_t*>(mp2JnzAddr);
-
-            if (bytes[0] == 0x90 && bytes[1] == 0x90) {
-                LOG_VERBOSE("[MPFaultFix] MP2 already patched");
-            }
-            else {
-                bool isShortJNZ = (bytes[0] == 0x75);
-                bool isLongJNZ = (bytes[0] == 0x0F && bytes[1] == 0x85);
-
-                if (isShortJNZ || isLongJNZ) {
-                    DWORD oldProtect;
-                    int patchSize = isShortJNZ ? 2 : 6;
-
-                    if (VirtualProtect((void*)mp2JnzAddr, patchSize, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-                        for (int i = 0; i < patchSize; i++) {
-                            bytes[i] = 0x90;
-                        }
-                        VirtualProtect((void*)mp2JnzAddr, patchSize, oldProtect, &oldProtect);
-                        LOG_VERBOSE("[MPFaultFix] MP2 fault check disabled");
-                    }
-                    else {
-                        LOG_ERROR("[MPFaultFix] Failed to patch MP2");
-                        success = false;
-                    }
-                }
-                else {
-                    LOG_ERROR("[MPFaultFix] MP2: Expected JNZ, found 0x" << std::hex << (int)bytes[0]);
-                    success = false;
-                }
-            }
-        }
-
-        if (success) {
-            LOG_VERBOSE("[MPFaultFix] SUCCESS! Multiplayer fault checks disabled");
-        }
-
-        return success;
-    }
-
-    bool DisableAllLimitValidation() {
-        LOG_INFO("[LimitBypass] Disable Fault (500) + Time (30Min) Limits ");
-
-        bool faultConditionSuccess = DisableCompletionConditionCheck();
-        bool timeConditionSuccess = DisableTimeCompletionCheck();
-        bool timeCondition2Success = DisableTimeCompletionCheck2();
-        bool messageSuccess = ForceRaceEndSuccess();
-        bool timerFreezeSuccess = DisableRaceUpdateTimerFreeze();
-        bool multiplayerTimeSuccess = DisableMultiplayerTimeChecks();
-        bool multiplayerFaultSuccess = DisableMultiplayerFaultChecks();
-
-        if (faultConditionSuccess && timeConditionSuccess && timeCondition2Success &&
-            messageSuccess && timerFreezeSuccess && multiplayerTimeSuccess &&
-            multiplayerFaultSuccess) {
-            LOG_VERBOSE("[LimitBypass] SUCCESS! All patches applied:");
-            LOG_VERBOSE("[LimitBypass]   1. Fault limit check disabled (SP)");
-            LOG_VERBOSE("[LimitBypass]   2. Time limit check #1 disabled (SP)");
-            LOG_VERBOSE("[LimitBypass]   3. Time limit check #2 disabled (SP)");
-            LOG_VERBOSE("[LimitBypass]   4. Finish message patched");
-            LOG_VERBOSE("[LimitBypass]   5. Timer freeze DISABLED");
-            LOG_VERBOSE("[LimitBypass]   6. Multiplayer time checks DISABLED");
-            LOG_VERBOSE("[LimitBypass]   7. Multiplayer fault checks DISABLED");
-            LOG_VERBOSE("[LimitBypass] You can now play indefinitely in SP/MP!");
-            LOG_VERBOSE("[LimitBypass] Note: MP may crash on track 2 finish with exceeded limits");
-            return true;
-        }
-        else {
-            LOG_ERROR("[LimitBypass] Patch FAILED");
-            LOG_ERROR("[LimitBypass]   Fault (SP): " << (faultConditionSuccess ? "OK" : "FAIL"));
-            LOG_ERROR("[LimitBypass]   Time1 (SP): " << (timeConditionSuccess ? "OK" : "FAIL"));
-            LOG_ERROR("[LimitBypass]   Time2 (SP): " << (timeCondition2Success ? "OK" : "FAIL"));
-            LOG_ERROR("[LimitBypass]   Message: " << (messageSuccess ? "OK" : "FAIL"));
-            LOG_ERROR("[LimitBypass]   TimerFreeze: " << (timerFreezeSuccess ? "OK" : "FAIL"));
-            LOG_ERROR("[LimitBypass]   MP Time: " << (multiplayerTimeSuccess ? "OK" : "FAIL"));
-            LOG_ERROR("[LimitBypass]   MP Fault: " << (multiplayerFaultSuccess ? "OK" : "FAIL"));
-            return false;
-        }
-    }
-
-    // ============================================================================
-    // Enable Validation Functions (restore original bytes)
-    // ============================================================================
-
-    bool EnableCompletionConditionCheck() {
-        if (!g_initialized) {
-            LOG_ERROR("[CompletionRestore] Not initialized");
-            return false;
-        }
-
-        uintptr_t jncAddr = g_baseAddress + COMPLETION_COND_FAULT_JNC_RVA;
-
-        LOG_VERBOSE("[CompletionRestore] Restoring fault limit check at 0x" << std::hex << jncAddr);
-
-        if (IsBadReadPtr((void*)jncAddr, 6)) {
-            LOG_ERROR("[CompletionRestore] Cannot read JNC address");
-            return false;
-        }
-
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(jncAddr);
-
-        // Check if already restored (has JNC instruction)
-        if ((bytes[0] == 0x73) || (bytes[0] == 0x0F && bytes[1] == 0x83)) {
-            LOG_VERBOSE("[CompletionRestore] Already restored (found JNC)");
-            return true;
-        }
-
-        // Check if it's NOPed (needs restoration)
-        if (bytes[0] != 0x90) {
-            LOG_ERROR("[CompletionRestore] Unexpected bytes at address: 0x" << std::hex << (int)bytes[0]);
-            return false;
-        }
-
-        DWORD oldProtect;
-        // Restore to short JNC (0x73 0x09) - jumps 9 bytes if NC
-        if (!VirtualProtect((void*)jncAddr, 2, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[CompletionRestore] Failed to change memory protection");
-            return false;
-        }
-
-        bytes[0] = 0x73;  // JNC (short jump)
-        bytes[1] = 0x1F;  // Jump offset (+31 bytes, to 0x931588)
-
-        VirtualProtect((void*)jncAddr, 2, oldProtect, &oldProtect);
-
-        LOG_VERBOSE("[CompletionRestore] SUCCESS! Fault limit check restored");
-        return true;
-    }
-
-    bool EnableTimeCompletionCheck() {
-        if (!g_initialized) {
-            LOG_ERROR("[TimeRestore] Not initialized");
-            return false;
-        }
-
-        uintptr_t jncAddr = g_baseAddress + COMPLETION_COND_TIME_JNC_RVA;
-
-        LOG_VERBOSE("[TimeRestore] Restoring time limit check #1 at 0x" << std::hex << jncAddr);
-
-        if (IsBadReadPtr((void*)jncAddr, 6)) {
-            LOG_ERROR("[TimeRestore] Cannot read JNC address");
-            return false;
-        }
-
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(jncAddr);
-
-        // Check if already restored
-        if ((bytes[0] == 0x73) || (bytes[0] == 0x0F && bytes[1] == 0x83)) {
-            LOG_VERBOSE("[TimeRestore] Already restored (found JNC)");
-            return true;
-        }
-
-        if (bytes[0] != 0x90) {
-            LOG_ERROR("[TimeRestore] Unexpected bytes at address: 0x" << std::hex << (int)bytes[0]);
-            return false;
-        }
-
-        DWORD oldProtect;
-        // Restore to short JNC (0x73 0x30) - jumps 48 bytes if NC
-        if (!VirtualProtect((void*)jncAddr, 2, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[TimeRestore] Failed to change memory protection");
-            return false;
-        }
-
-        bytes[0] = 0x73;  // JNC (short jump)
-        bytes[1] = 0x30;  // Jump offset (+48 bytes)
-
-        VirtualProtect((void*)jncAddr, 2, oldProtect, &oldProtect);
-
-        LOG_VERBOSE("[TimeRestore] SUCCESS! Time limit check #1 restored");
-        return true;
-    }
-
-    bool EnableTimeCompletionCheck2() {
-        if (!g_initialized) {
-            LOG_ERROR("[TimeRestore2] Not initialized");
-            return false;
-        }
-
-        uintptr_t jcAddr = g_baseAddress + COMPLETION_COND_TIME2_JC_RVA;
-
-        LOG_VERBOSE("[TimeRestore2] Restoring time limit check #2 at 0x" << std::hex << jcAddr);
-
-        if (IsBadReadPtr((void*)jcAddr, 2)) {
-            LOG_ERROR("[TimeRestore2] Cannot read JC address");
-            return false;
-        }
-
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(jcAddr);
-
-        // Check if already restored (has JC instruction)
-        if (bytes[0] == 0x72) {
-            LOG_VERBOSE("[TimeRestore2] Already restored (found JC)");
-            return true;
-        }
-
-        // Check if it's JMP (needs restoration to JC)
-        if (bytes[0] != 0xEB && bytes[0] != 0x90) {
-            LOG_ERROR("[TimeRestore2] Unexpected bytes: 0x" << std::hex << (int)bytes[0]);
-            return false;
-        }
-
-        DWORD oldProtect;
-        if (!VirtualProtect((void*)jcAddr, 2, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[TimeRestore2] Failed to change memory protection");
-            return false;
-        }
-
-        bytes[0] = 0x72;  // JC (jump if carry)
-        bytes[1] = 0x13;  // Jump offset (+19 bytes)
-
-        VirtualProtect((void*)jcAddr, 2, oldProtect, &oldProtect);
-
-        LOG_VERBOSE("[TimeRestore2] SUCCESS! Changed JMP back to JC - timer will freeze correctly!");
-        return true;
-    }
-
-    bool RestoreRaceEndSuccess() {
-        if (!g_initialized) {
-            LOG_ERROR("[FinalRestore] Not initialized");
-            return false;
-        }
-
-        uintptr_t pushAddr = g_baseAddress + UPDATE_RACE_END_PUSH_RVA;
-
-        LOG_VERBOSE("[FinalRestore] Restoring UpdateRaceEndState at 0x" << std::hex << pushAddr);
-
-        if (IsBadReadPtr((void*)pushAddr, 9)) {
-            LOG_ERROR("[FinalRestore] Cannot read patch address");
-            return false;
-        }
-
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(pushAddr);
-
-        // Check if already restored (has PUSH EAX)
-        if (bytes[0] == 0x50) {
-            LOG_VERBOSE("[FinalRestore] Already restored (found PUSH EAX)");
-            return true;
-        }
-
-        // Check if it's patched (has TEST EAX,EAX)
-        if (bytes[0] != 0x85 || bytes[1] != 0xC0) {
-            LOG_ERROR("[FinalRestore] Unexpected bytes: 0x" << std::hex << (int)bytes[0] << " " << (int)bytes[1]);
-            return false;
-        }
-
-        DWORD oldProtect;
-        if (!VirtualProtect((void*)pushAddr, 9, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[FinalRestore] Failed to change memory protection");
-            return false;
-        }
-
-        // Restore original bytes:
-        // 00980d93: PUSH EAX           (50)
-        // 00980d94: PUSH 0x1           (6A 01)
-        // 00980d96: MOV ECX,EDI        (8B CF)
-        // 00980d98: CALL <target>      (E8 xx xx xx xx)
-        //
-        // The CALL target is at RVA 0x55a00 (InitializeObjectStruct)
-        // We need to calculate the relative offset at runtime
-        
-        uintptr_t callInstrAddr = pushAddr + 5;  // Address of the CALL instruction
-        uintptr_t callTarget = g_baseAddress + 0x55a00;  // InitializeObjectStruct
-        uintptr_t nextInstrAddr = callInstrAddr + 5;  // Address after CALL
-        int32_t relativeOffset = (int32_t)(callTarget - nextInstrAddr);
-        
-        bytes[0] = 0x50;  // PUSH EAX
-        bytes[1] = 0x6A;  // PUSH
-        bytes[2] = 0x01;  // 0x1
-        bytes[3] = 0x8B;  // MOV
-        bytes[4] = 0xCF;  // ECX, EDI
-        bytes[5] = 0xE8;  // CALL (near)
-        // Write the relative offset as little-endian
-        *reinterpret_cast<int32_t*>(&bytes[6]) = relativeOffset;
-
-        VirtualProtect((void*)pushAddr, 10, oldProtect, &oldProtect);
-
-        LOG_VERBOSE("[FinalRestore] SUCCESS! Finish message restored (CALL offset: 0x" << std::hex << relativeOffset << ")");
-        return true;
-    }
-
-    bool EnableRaceUpdateTimerFreeze() {
-        if (!g_initialized) {
-            LOG_ERROR("[TimerFreezeRestore] Not initialized");
-            return false;
-        }
-
-        uintptr_t jncAddr = g_baseAddress + RACEUPDATE_TIMER_CHECK_RVA + 6;
-
-        LOG_VERBOSE("[TimerFreezeRestore] Restoring timer freeze JNC in RaceUpdate at 0x" << std::hex << jncAddr);
-
-        if (IsBadReadPtr((void*)jncAddr, 6)) {
-            LOG_ERROR("[TimerFreezeRestore] Cannot read JNC address");
-            return false;
-        }
-
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(jncAddr);
-
-        // Check if already restored
-        if ((bytes[0] == 0x73) || (bytes[0] == 0x0F && bytes[1] == 0x83)) {
-            LOG_VERBOSE("[TimerFreezeRestore] Already restored (found JNC)");
-            return true;
-        }
-
-        if (bytes[0] != 0x90) {
-            LOG_ERROR("[TimerFreezeRestore] Unexpected bytes: 0x" << std::hex << (int)bytes[0]);
-            return false;
-        }
-
-        DWORD oldProtect;
-        // Restore to short JNC (0x73 0x12) - jumps 18 bytes if NC
-        if (!VirtualProtect((void*)jncAddr, 2, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[TimerFreezeRestore] Failed to change memory protection");
-            return false;
-        }
-
-        bytes[0] = 0x73;  // JNC (short jump)
-        bytes[1] = 0x12;  // Jump offset (+18 bytes)
-
-        VirtualProtect((void*)jncAddr, 2, oldProtect, &oldProtect);
-
-        LOG_VERBOSE("[TimerFreezeRestore] SUCCESS! Timer will freeze at 30 minutes again!");
-        return true;
-    }
-
-    bool EnableMultiplayerTimeChecks() {
-        if (!g_initialized) {
-            LOG_ERROR("[MPTimeRestore] Not initialized");
-            return false;
-        }
-
-        bool success = true;
-
-        // Restore multiplayer mode 1 time check
-        uintptr_t mp1JncAddr = g_baseAddress + MULTIPLAYER_MODE1_TIME_JNC_RVA;
-        LOG_VERBOSE("[MPTimeRestore] Restoring multiplayer mode 1 time check at 0x" << std::hex << mp1JncAddr);
-
-        if (IsBadReadPtr((void*)mp1JncAddr, 6)) {
-            LOG_ERROR("[MPTimeRestore] Cannot read MP1 JNC address");
-            success = false;
-        }
-        else {
-            uint8_t* bytes = reinterpret_cast<uint8_t*>(mp1JncAddr);
-
-            if ((bytes[0] == 0x73) || (bytes[0] == 0x0F && bytes[1] == 0x83)) {
-                LOG_VERBOSE("[MPTimeRestore] MP1 already restored");
-            }
-            else if (bytes[0] == 0x90) {
-                DWORD oldProtect;
-                if (VirtualProtect((void*)mp1JncAddr, 2, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-                    bytes[0] = 0x73;  // JNC (short)
-                    bytes[1] = 0x04;  // Jump offset
-                    VirtualProtect((void*)mp1JncAddr, 2, oldProtect, &oldProtect);
-                    LOG_VERBOSE("[MPTimeRestore] MP1 time check restored");
-                }
-                else {
-                    LOG_ERROR("[MPTimeRestore] Failed to patch MP1");
-                    success = false;
-                }
-            }
-        }
-
-        // Restore multiplayer mode 2 time check
-        uintptr_t mp2JncAddr = g_baseAddress + MULTIPLAYER_MODE2_TIME_JNC_RVA;
-        LOG_VERBOSE("[MPTimeRestore] Restoring multiplayer mode 2 time check at 0x" << std::hex << mp2JncAddr);
-
-        if (IsBadReadPtr((void*)mp2JncAddr, 6)) {
-            LOG_ERROR("[MPTimeRestore] Cannot read MP2 JNC address");
-            success = false;
-        }
-        else {
-            uint8_t* bytes = reinterpret_cast<uint8_t*>(mp2JncAddr);
-
-            if ((bytes[0] == 0x73) || (bytes[0] == 0x0F && bytes[1] == 0x83)) {
-                LOG_VERBOSE("[MPTimeRestore] MP2 already restored");
-            }
-            else if (bytes[0] == 0x90) {
-                DWORD oldProtect;
-                if (VirtualProtect((void*)mp2JncAddr, 2, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-                    bytes[0] = 0x73;  // JNC (short)
-                    bytes[1] = 0x04;  // Jump offset
-                    VirtualProtect((void*)mp2JncAddr, 2, oldProtect, &oldProtect);
-                    LOG_VERBOSE("[MPTimeRestore] MP2 time check restored");
-                }
-                else {
-                    LOG_ERROR("[MPTimeRestore] Failed to patch MP2");
-                    success = false;
-                }
-            }
-        }
-
-        if (success) {
-            LOG_VERBOSE("[MPTimeRestore] SUCCESS! Multiplayer time checks restored");
-        }
-
-        return success;
-    }
-
-    bool EnableMultiplayerFaultChecks() {
-        if (!g_initialized) {
-            LOG_ERROR("[MPFaultRestore] Not initialized");
-            return false;
-        }
-
-        bool success = true;
-
-        // Restore multiplayer mode 1 fault check
-        uintptr_t mp1JnzAddr = g_baseAddress + MULTIPLAYER_MODE1_FAULT_JNZ_RVA;
-        LOG_VERBOSE("[MPFaultRestore] Restoring multiplayer mode 1 fault check at 0x" << std::hex << mp1JnzAddr);
-
-        if (IsBadReadPtr((void*)mp1JnzAddr, 6)) {
-            LOG_ERROR("[MPFaultRestore] Cannot read MP1 JNZ address");
-            success = false;
-        }
-        else {
-            uint8_t* bytes = reinterpret_cast<uint8_t*>(mp1JnzAddr);
-
-            if ((bytes[0] == 0x75) || (bytes[0] == 0x0F && bytes[1] == 0x85)) {
-                LOG_VERBOSE("[MPFaultRestore] MP1 already restored");
-            }
-            else if (bytes[0] == 0x90) {
-                DWORD oldProtect;
-                if (VirtualProtect((void*)mp1JnzAddr, 2, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-                    bytes[0] = 0x75;  // JNZ (short)
-                    bytes[1] = 0xC9;  // Jump offset
-                    VirtualProtect((void*)mp1JnzAddr, 2, oldProtect, &oldProtect);
-                    LOG_VERBOSE("[MPFaultRestore] MP1 fault check restored");
-                }
-                else {
-                    LOG_ERROR("[MPFaultRestore] Failed to patch MP1");
-                    success = false;
-                }
-            }
-        }
-
-        // Restore multiplayer mode 2 fault check
-        uintptr_t mp2JnzAddr = g_baseAddress + MULTIPLAYER_MODE2_FAULT_JNZ_RVA;
-        LOG_VERBOSE("[MPFaultRestore] Restoring multiplayer mode 2 fault check at 0x" << std::hex << mp2JnzAddr);
-
-        if (IsBadReadPtr((void*)mp2JnzAddr, 6)) {
-            LOG_ERROR("[MPFaultRestore] Cannot read MP2 JNZ address");
-            success = false;
-        }
-        else {
-            uint8_t* bytes = reinterpret_cast<uint8_t*>(mp2JnzAddr);
-
-            if ((bytes[0] == 0x75) || (bytes[0] == 0x0F && bytes[1] == 0x85)) {
-                LOG_VERBOSE("[MPFaultRestore] MP2 already restored");
-            }
-            else if (bytes[0] == 0x90) {
-                DWORD oldProtect;
-                if (VirtualProtect((void*)mp2JnzAddr, 2, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-                    bytes[0] = 0x75;  // JNZ (short)
-                    bytes[1] = 0xC9;  // Jump offset
-                    VirtualProtect((void*)mp2JnzAddr, 2, oldProtect, &oldProtect);
-                    LOG_VERBOSE("[MPFaultRestore] MP2 fault check restored");
-                }
-                else {
-                    LOG_ERROR("[MPFaultRestore] Failed to patch MP2");
-                    success = false;
-                }
-            }
-        }
-
-        if (success) {
-            LOG_VERBOSE("[MPFaultRestore] SUCCESS! Multiplayer fault checks restored");
-        }
-
-        return success;
-    }
-
-    bool EnableFaultValidation() {
-        return EnableCompletionConditionCheck();
-    }
-
-    bool EnableTimeValidation() {
-        bool success = true;
-        success &= EnableTimeCompletionCheck();
-        success &= EnableTimeCompletionCheck2();
-        return success;
-    }
-
-    bool EnableAllLimitValidation() {
-        LOG_INFO("[LimitRestore] Enable Fault (500) + Time (30Min) Limits ");
-
-        bool faultConditionSuccess = EnableCompletionConditionCheck();
-        bool timeConditionSuccess = EnableTimeCompletionCheck();
-        bool timeCondition2Success = EnableTimeCompletionCheck2();
-        bool messageSuccess = RestoreRaceEndSuccess();
-        bool timerFreezeSuccess = EnableRaceUpdateTimerFreeze();
-        bool multiplayerTimeSuccess = EnableMultiplayerTimeChecks();
-        bool multiplayerFaultSuccess = EnableMultiplayerFaultChecks();
-
-        if (faultConditionSuccess && timeConditionSuccess && timeCondition2Success &&
-            messageSuccess && timerFreezeSuccess && multiplayerTimeSuccess &&
-            multiplayerFaultSuccess) {
-            LOG_VERBOSE("[LimitRestore] SUCCESS! All validations restored:");
-            LOG_VERBOSE("[LimitRestore]   1. Fault limit check enabled (SP)");
-            LOG_VERBOSE("[LimitRestore]   2. Time limit check #1 enabled (SP)");
-            LOG_VERBOSE("[LimitRestore]   3. Time limit check #2 enabled (SP)");
-            LOG_VERBOSE("[LimitRestore]   4. Finish message restored");
-            LOG_VERBOSE("[LimitRestore]   5. Timer freeze ENABLED");
-            LOG_VERBOSE("[LimitRestore]   6. Multiplayer time checks ENABLED");
-            LOG_VERBOSE("[LimitRestore]   7. Multiplayer fault checks ENABLED");
-            LOG_VERBOSE("[LimitRestore] Limits are now being enforced normally!");
-            return true;
-        }
-        else {
-            LOG_ERROR("[LimitRestore] Restore FAILED");
-            LOG_ERROR("[LimitRestore]   Fault (SP): " << (faultConditionSuccess ? "OK" : "FAIL"));
-            LOG_ERROR("[LimitRestore]   Time1 (SP): " << (timeConditionSuccess ? "OK" : "FAIL"));
-            LOG_ERROR("[LimitRestore]   Time2 (SP): " << (timeCondition2Success ? "OK" : "FAIL"));
-            LOG_ERROR("[LimitRestore]   Message: " << (messageSuccess ? "OK" : "FAIL"));
-            LOG_ERROR("[LimitRestore]   TimerFreeze: " << (timerFreezeSuccess ? "OK" : "FAIL"));
-            LOG_ERROR("[LimitRestore]   MP Time: " << (multiplayerTimeSuccess ? "OK" : "FAIL"));
-            LOG_ERROR("[LimitRestore]   MP Fault: " << (multiplayerFaultSuccess ? "OK" : "FAIL"));
-            return false;
-        }
-    }
-
-    bool DisableFaultValidation() {
-        return DisableCompletionConditionCheck();
-    }
-
-    bool DisableTimeValidation() {
-        bool success = true;
-        success &= DisableTimeCompletionCheck();
-        success &= DisableTimeCompletionCheck2();
-        return success;
-    }
-
     // ============================================================================
-    // Limit Validation State Query Functions
+    // Limit Validation Patches (see PATCHES)
     // ============================================================================
 
-    bool IsFaultValidationDisabled() {
+    static bool ApplyPatches(uint32_t groups) {
         if (!g_initialized) {
+            LOG_ERROR("[Respawn] Not initialized");
             return false;
         }
+        return PatchManager::Apply(groups);
+    }
 
-        // Check if the fault limit check is patched (NOPed out)
-        uintptr_t jncAddr = g_baseAddress + COMPLETION_COND_FAULT_JNC_RVA;
-
-        if (IsBadReadPtr((void*)jncAddr, 2)) {
+    static bool RestorePatches(uint32_t groups) {
+        if (!g_initialized) {
+            LOG_ERROR("[Respawn] Not initialized");
             return false;
         }
+        return PatchManager::Restore(groups);
+    }
 
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(jncAddr);
+    bool DisableFaultValidation() {
+        return ApplyPatches(PatchManager::GROUP_FAULT_CHECK);
+    }
 
-        // If first two bytes are NOPs, the fault validation is disabled
-        return (bytes[0] == 0x90 && bytes[1] == 0x90);
+    bool DisableTimeValidation() {
+        return ApplyPatches(PatchManager::GROUP_TIME_CHECK | PatchManager::GROUP_TIME_CHECK2);
     }
 
-    bool IsTimeValidationDisabled() {
-        if (!g_initialized) {
+    bool EnableFaultValidation() {
+        return RestorePatches(PatchManager::GROUP_FAULT_CHECK);
+    }
+
+    bool EnableTimeValidation() {
+        return RestorePatches(PatchManager::GROUP_TIME_CHECK | PatchManager::GROUP_TIME_CHECK2);
+    }
+
+    bool DisableRaceUpdateTimerFreeze() {
+        return ApplyPatches(PatchManager::GROUP_TIMER_FREEZE);
+    }
+
+    bool DisableTimeCompletionCheck2() {
+        return ApplyPatches(PatchManager::GROUP_TIME_CHECK2);
+    }
+
+    bool DisableAllLimitValidation() {
+        LOG_INFO("[LimitBypass] Disable Fault (500) + Time (30Min) Limits ");
+
+        if (!ApplyPatches(PatchManager::GROUP_ALL_LIMITS)) {
+            LOG_ERROR("[LimitBypass] Patch FAILED - no limit check was changed");
             return false;
         }
+        LOG_VERBOSE("[LimitBypass] SUCCESS! SP/MP fault and time checks, finish message and timer freeze patched");
+        LOG_VERBOSE("[LimitBypass] Note: MP may crash on track 2 finish with exceeded limits");
+        return true;
+    }
 
-        // Check if the time limit check is patched (NOPed out)
-        uintptr_t jncAddr = g_baseAddress + COMPLETION_COND_TIME_JNC_RVA;
+    bool EnableAllLimitValidation() {
+        LOG_INFO("[LimitRestore] Enable Fault (500) + Time (30Min) Limits ");
 
-        if (IsBadReadPtr((void*)jncAddr, 2)) {
+        if (!RestorePatches(PatchManager::GROUP_ALL_LIMITS)) {
+            LOG_ERROR("[LimitRestore] Restore FAILED - no limit check was changed");
             return false;
         }
+        LOG_VERBOSE("[LimitRestore] SUCCESS! Limits are now being enforced normally!");
+        return true;
+    }
+
+    // ============================================================================
+    // Limit Validation State Query Functions
+    // ============================================================================
 
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(jncAddr);
+    bool IsFaultValidationDisabled() {
+        return g_initialized && PatchManager::IsApplied(PatchManager::GROUP_FAULT_CHECK);
+    }
 
-        // If first two bytes are NOPs, the time validation is disabled
-        return (bytes[0] == 0x90 && bytes[1] == 0x90);
+    bool IsTimeValidationDisabled() {
+        return g_initialized && PatchManager::IsApplied(PatchManager::GROUP_TIME_CHECK);
     }
 
     // ============================================================================
@@ -1862,6 +1070,10 @@ namespace Respawn {
             return false;
         }
 
+        if (!PatchManager::Register(baseAddress, PATCHES, sizeof(PATCHES) / sizeof(PATCHES[0]))) {
+            LOG_WARNING("[Respawn] Some code patches could not be registered");
+        }
+
         g_initialized = true;
 
         return true;
@@ -1874,6 +1086,7 @@ namespace Respawn {
 
         g_initialized = false;
         g_globalStructPtr = nullptr;
+        InvalidateCheckpointCache();
         g_handlePlayerRespawnFunc = nullptr;
         g_executeTaskWithLocking = nullptr;
         g_executeAsyncTask = nullptr;
@@ -1881,6 +1094,10 @@ namespace Respawn {
         LOG_VERBOSE("[Respawn] Shutdown complete");
     }
 
+    void OnTrackChanged() {
+        InvalidateCheckpointCache();
+    }
+
     bool RespawnAtCheckpoint() {
         return RespawnAtCheckpointOffset(0);
     }
@@ -2382,21 +1599,9 @@ namespace Respawn {
         // First, enable the checkpoint (clears triggered bit 0x10)
         bool result = EnableCheckpoint(finishLineIndex);
         
-        // Second, unpatch the code to restore finish logic
-        if (!UnpatchFinishLineCheck()) {
-            LOG_ERROR("[FinishLine] Failed to unpatch finish line check");
-            return false;
-        }
-        
-        // Third, restore the SECOND call to ProcessCheckpointReached in UpdateCheckpointsInRange
-        if (!UnpatchUpdateCheckpointsCall()) {
-            LOG_ERROR("[FinishLine] Failed to unpatch second UpdateCheckpoints call");
-            return false;
-        }
-        
-        // Finally, restore the FIRST call to ProcessCheckpointReached in UpdateCheckpointsInRange  
-        if (!UnpatchUpdateCheckpointsFirstCall()) {
-            LOG_ERROR("[FinishLine] Failed to unpatch first UpdateCheckpoints call");
+        // Then restore the finish check and both ProcessCheckpointReached calls in UpdateCheckpointsInRange
+        if (!RestorePatches(FINISH_LINE_GROUPS)) {
+            LOG_ERROR("[FinishLine] Failed to unpatch finish line code");
             return false;
         }
         
@@ -2428,27 +1633,14 @@ namespace Respawn {
 
         int finishLineIndex = checkpointCount - 1;
         
-        // First, NOP out the FIRST call to ProcessCheckpointReached in UpdateCheckpointsInRange
-        // This call is at 0x92953b and happens when current checkpoint equals first valid element
-        if (!PatchUpdateCheckpointsFirstCall()) {
-            LOG_ERROR("[FinishLine] Failed to patch first UpdateCheckpoints call");
-            return false;
-        }
-        
-        // Second, NOP out the SECOND call to ProcessCheckpointReached in UpdateCheckpointsInRange
-        // This call is in the main loop at 0x9297b5
-        if (!PatchUpdateCheckpointsCall()) {
-            LOG_ERROR("[FinishLine] Failed to patch second UpdateCheckpoints call");
-            return false;
-        }
-        
-        // Third, patch the code to skip finish logic
-        if (!PatchFinishLineCheck()) {
-            LOG_ERROR("[FinishLine] Failed to patch finish line check");
+        // First, skip both ProcessCheckpointReached calls in UpdateCheckpointsInRange (0x92953b and
+        // the main loop at 0x9297b5) and the finish logic, in one patch transaction
+        if (!ApplyPatches(FINISH_LINE_GROUPS)) {
+            LOG_ERROR("[FinishLine] Failed to patch finish line code");
             return false;
         }
         
-        // Finally, disable the checkpoint (sets triggered bit 0x10)
+        // Then disable the checkpoint (sets triggered bit 0x10)
         bool result = DisableCheckpoint(finishLineIndex);
         
         if (result) {
@@ -2459,554 +1651,35 @@ namespace Respawn {
     }
 
     bool PatchUpdateCheckpointsCall() {
-        if (!g_initialized) {
-            LOG_ERROR("[UpdateCheckpointsPatch] Not initialized");
-            return false;
-        }
-
-        // We need to skip the entire checkpoint processing block when finish line is disabled
-        //
-        // Original code at 0x9297ac-0x9297c3:
-        //   009297ac: PUSH ECX                     
-        //   009297ad: MOVSS dword ptr [ESP],XMM0  
-        //   009297b2: PUSH EDI                     ; Push checkpoint pointer
-        //   009297b3: MOV ECX,ESI                  ; this = bike
-        //   009297b5: CALL 0x00928b60              ; ProcessCheckpointReached
-        //   009297ba: MOV EBX,dword ptr [EBP + -0x24]
-        //   009297bd: MOV dword ptr [ESI + 0x1dc],EDI  ; Update current checkpoint
-        //   009297c3: ... (continue)
-        //
-        // We want to jump from 0x9297ac directly to 0x9297c3 to skip all of this
-        // Jump distance: 0x9297c3 - 0x9297ac = 0x17 bytes
-        // JMP short can handle this (2 bytes: EB 15 - offset is 0x15 because it's relative to next instruction)
-        
-        uintptr_t patchAddr = g_baseAddress + UPDATE_CHECKPOINTS_CALL_RVA; // 0x9297ac (PUSH ECX)
-        
-        LOG_VERBOSE("[UpdateCheckpointsPatch] Patching checkpoint processing block at 0x" << std::hex << patchAddr);
-        
-        if (IsBadReadPtr((void*)patchAddr, 24)) {
-            LOG_ERROR("[UpdateCheckpointsPatch] Cannot read patch address");
-            return false;
-        }
-        
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(patchAddr);
-        
-        // Check if already patched (starts with JMP)
-        if (bytes[0] == 0xEB) {
-            LOG_VERBOSE("[UpdateCheckpointsPatch] Already patched");
-            return true;
-        }
-        
-        // Verify it's a PUSH ECX instruction
-        if (bytes[0] != 0x51) {
-            LOG_ERROR("[UpdateCheckpointsPatch] Expected PUSH ECX (0x51), found 0x" << std::hex << (int)bytes[0]);
-            return false;
-        }
-        
-        DWORD oldProtect;
-        if (!VirtualProtect((void*)patchAddr, 24, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[UpdateCheckpointsPatch] Failed to change memory protection");
-            return false;
-        }
-        
-        // JMP short to 0x9297c3
-        // From 0x9297ac, next instruction would be 0x9297ae
-        // Target is 0x9297c3
-        // Offset = 0x9297c3 - 0x9297ae = 0x15
-        bytes[0] = 0xEB;  // JMP short
-        bytes[1] = 0x15;  // Offset (+21 bytes)
-        
-        // Fill rest with NOPs for safety
-        for (int i = 2; i < 24; i++) {
-            bytes[i] = 0x90;  // NOP
-        }
-        
-        VirtualProtect((void*)patchAddr, 24, oldProtect, &oldProtect);
-        
-        LOG_VERBOSE("[UpdateCheckpointsPatch] SUCCESS! Added JMP to skip checkpoint processing!");
-        return true;
+        return ApplyPatches(PatchManager::GROUP_UPDATE_CHECKPOINTS_CALL);
     }
 
     bool UnpatchUpdateCheckpointsCall() {
-        if (!g_initialized) {
-            LOG_ERROR("[UpdateCheckpointsUnpatch] Not initialized");
-            return false;
-        }
-        
-        uintptr_t patchAddr = g_baseAddress + UPDATE_CHECKPOINTS_CALL_RVA;
-        
-        LOG_VERBOSE("[UpdateCheckpointsUnpatch] Restoring checkpoint processing block at 0x" << std::hex << patchAddr);
-        
-        if (IsBadReadPtr((void*)patchAddr, 24)) {
-            LOG_ERROR("[UpdateCheckpointsUnpatch] Cannot read patch address");
-            return false;
-        }
-        
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(patchAddr);
-        
-        // Check if already restored
-        if (bytes[0] == 0x51) {
-            LOG_VERBOSE("[UpdateCheckpointsUnpatch] Already restored");
-            return true;
-        }
-        
-        // Verify it's a JMP
-        if (bytes[0] != 0xEB) {
-            LOG_ERROR("[UpdateCheckpointsUnpatch] Unexpected bytes: 0x" << std::hex << (int)bytes[0]);
-            return false;
-        }
-        
-        DWORD oldProtect;
-        if (!VirtualProtect((void*)patchAddr, 24, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[UpdateCheckpointsUnpatch] Failed to change memory protection");
-            return false;
-        }
-        
-        // Restore original code:
-        // 009297ac: PUSH ECX (1 byte: 51)
-        bytes[0] = 0x51;
-        
-        // 009297ad: MOVSS dword ptr [ESP],XMM0 (5 bytes: F3 0F 11 04 24)
-        bytes[1] = 0xF3;
-        bytes[2] = 0x0F;
-        bytes[3] = 0x11;
-        bytes[4] = 0x04;
-        bytes[5] = 0x24;
-        
-        // 009297b2: PUSH EDI (1 byte: 57)
-        bytes[6] = 0x57;
-        
-        // 009297b3: MOV ECX,ESI (2 bytes: 8B CE)
-        bytes[7] = 0x8B;
-        bytes[8] = 0xCE;
-        
-        // 009297b5: CALL 0x00928b60 (5 bytes: E8 + offset)
-        int32_t callOffset = 0x928b60 - (0x9297b5 + 5);
-        bytes[9] = 0xE8;
-        *reinterpret_cast<int32_t*>(&bytes[10]) = callOffset;
-        
-        // 009297ba: MOV EBX,dword ptr [EBP + -0x24] (3 bytes: 8B 5D DC)
-        bytes[14] = 0x8B;
-        bytes[15] = 0x5D;
-        bytes[16] = 0xDC;
-        
-        // 009297bd: MOV dword ptr [ESI + 0x1dc],EDI (6 bytes: 89 BE DC 01 00 00)
-        bytes[17] = 0x89;
-        bytes[18] = 0xBE;
-        bytes[19] = 0xDC;
-        bytes[20] = 0x01;
-        bytes[21] = 0x00;
-        bytes[22] = 0x00;
-        
-        VirtualProtect((void*)patchAddr, 24, oldProtect, &oldProtect);
-        
-        LOG_VERBOSE("[UpdateCheckpointsUnpatch] SUCCESS! Restored checkpoint processing block!");
-        return true;
+        return RestorePatches(PatchManager::GROUP_UPDATE_CHECKPOINTS_CALL);
     }
 
-    // Patch the FIRST call to ProcessCheckpointReached in UpdateCheckpointsInRange
-    // This call happens at 0x92953b when current checkpoint equals first valid element
     bool PatchUpdateCheckpointsFirstCall() {
-        if (!g_initialized) {
-            LOG_ERROR("[UpdateCheckpointsFirstPatch] Not initialized");
-            return false;
-        }
-
-        // Original code at 0x929529-0x929540:
-        //   00929529: XORPS XMM0,XMM0         ; 3 bytes: 0F 57 C0
-        //   0092952c: PUSH ECX               ; 1 byte: 51
-        //   0092952d: MOV ECX,[ESI+0x1dc]    ; 6 bytes: 8B 8E DC 01 00 00
-        //   00929533: MOVSS [ESP],XMM0       ; 5 bytes: F3 0F 11 04 24
-        //   00929538: PUSH ECX               ; 1 byte: 51
-        //   00929539: MOV ECX,ESI            ; 2 bytes: 8B CE
-        //   0092953b: CALL 0x00928b60        ; 5 bytes: E8 xx xx xx xx
-        //   00929540: MOV EAX,...            ; next instruction
-        //
-        // Total: 23 bytes from 0x929529 to 0x929540
-        // We want to jump from 0x929529 to 0x929540
-        // JMP short offset = 0x929540 - 0x92952b = 0x15 (21 bytes)
-        
-        uintptr_t patchAddr = g_baseAddress + UPDATE_CHECKPOINTS_FIRST_CALL_RVA;
-        
-        LOG_VERBOSE("[UpdateCheckpointsFirstPatch] Patching first checkpoint call at 0x" << std::hex << patchAddr);
-        
-        if (IsBadReadPtr((void*)patchAddr, 23)) {
-            LOG_ERROR("[UpdateCheckpointsFirstPatch] Cannot read patch address");
-            return false;
-        }
-        
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(patchAddr);
-        
-        // Check if already patched (starts with JMP)
-        if (bytes[0] == 0xEB) {
-            LOG_VERBOSE("[UpdateCheckpointsFirstPatch] Already patched");
-            return true;
-        }
-        
-        // Verify we have the expected XORPS instruction (0F 57 C0)
-        if (bytes[0] != 0x0F || bytes[1] != 0x57 || bytes[2] != 0xC0) {
-            LOG_ERROR("[UpdateCheckpointsFirstPatch] Expected XORPS (0F 57 C0), found 0x" 
-                << std::hex << (int)bytes[0] << " 0x" << (int)bytes[1] << " 0x" << (int)bytes[2]);
-            return false;
-        }
-        
-        DWORD oldProtect;
-        if (!VirtualProtect((void*)patchAddr, 23, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[UpdateCheckpointsFirstPatch] Failed to change memory protection");
-            return false;
-        }
-        
-        // JMP short to 0x929540
-        // From 0x929529, next instruction would be 0x92952b
-        // Target is 0x929540
-        // Offset = 0x929540 - 0x92952b = 0x15 (21 bytes)
-        bytes[0] = 0xEB;  // JMP short
-        bytes[1] = 0x15;  // Offset (+21 bytes)
-        
-        // Fill rest with NOPs
-        for (int i = 2; i < 23; i++) {
-            bytes[i] = 0x90;
-        }
-        
-        VirtualProtect((void*)patchAddr, 23, oldProtect, &oldProtect);
-        
-        LOG_VERBOSE("[UpdateCheckpointsFirstPatch] SUCCESS! Added JMP to skip first checkpoint call!");
-        return true;
+        return ApplyPatches(PatchManager::GROUP_UPDATE_CHECKPOINTS_FIRST_CALL);
     }
 
     bool UnpatchUpdateCheckpointsFirstCall() {
-        if (!g_initialized) {
-            LOG_ERROR("[UpdateCheckpointsFirstUnpatch] Not initialized");
-            return false;
-        }
-        
-        uintptr_t patchAddr = g_baseAddress + UPDATE_CHECKPOINTS_FIRST_CALL_RVA;
-        
-        LOG_VERBOSE("[UpdateCheckpointsFirstUnpatch] Restoring first checkpoint call at 0x" << std::hex << patchAddr);
-        
-        if (IsBadReadPtr((void*)patchAddr, 23)) {
-            LOG_ERROR("[UpdateCheckpointsFirstUnpatch] Cannot read patch address");
-            return false;
-        }
-        
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(patchAddr);
-        
-        // Check if already restored (has XORPS)
-        if (bytes[0] == 0x0F && bytes[1] == 0x57) {
-            LOG_VERBOSE("[UpdateCheckpointsFirstUnpatch] Already restored");
-            return true;
-        }
-        
-        // Verify it's our JMP
-        if (bytes[0] != 0xEB) {
-            LOG_ERROR("[UpdateCheckpointsFirstUnpatch] Unexpected bytes: 0x" << std::hex << (int)bytes[0]);
-            return false;
-        }
-        
-        DWORD oldProtect;
-        if (!VirtualProtect((void*)patchAddr, 23, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[UpdateCheckpointsFirstUnpatch] Failed to change memory protection");
-            return false;
-        }
-        
-        // Restore original code:
-        // 00929529: XORPS XMM0,XMM0 (3 bytes: 0F 57 C0)
-        bytes[0] = 0x0F;
-        bytes[1] = 0x57;
-        bytes[2] = 0xC0;
-        
-        // 0092952c: PUSH ECX (1 byte: 51)
-        bytes[3] = 0x51;
-        
-        // 0092952d: MOV ECX,dword ptr [ESI + 0x1dc] (6 bytes: 8B 8E DC 01 00 00)
-        bytes[4] = 0x8B;
-        bytes[5] = 0x8E;
-        bytes[6] = 0xDC;
-        bytes[7] = 0x01;
-        bytes[8] = 0x00;
-        bytes[9] = 0x00;
-        
-        // 00929533: MOVSS dword ptr [ESP],XMM0 (5 bytes: F3 0F 11 04 24)
-        bytes[10] = 0xF3;
-        bytes[11] = 0x0F;
-        bytes[12] = 0x11;
-        bytes[13] = 0x04;
-        bytes[14] = 0x24;
-        
-        // 00929538: PUSH ECX (1 byte: 51)
-        bytes[15] = 0x51;
-        
-        // 00929539: MOV ECX,ESI (2 bytes: 8B CE)
-        bytes[16] = 0x8B;
-        bytes[17] = 0xCE;
-        
-        // 0092953b: CALL 0x00928b60 (5 bytes: E8 + offset)
-        // Calculate relative call offset: target - (call_addr + 5)
-        int32_t callOffset = 0x928b60 - (0x92953b + 5);
-        bytes[18] = 0xE8;
-        *reinterpret_cast<int32_t*>(&bytes[19]) = callOffset;
-        
-        VirtualProtect((void*)patchAddr, 23, oldProtect, &oldProtect);
-        
-        LOG_VERBOSE("[UpdateCheckpointsFirstUnpatch] SUCCESS! Restored first checkpoint call!");
-        return true;
+        return RestorePatches(PatchManager::GROUP_UPDATE_CHECKPOINTS_FIRST_CALL);
     }
 
     bool PatchCheckpointEarlyReturn() {
-        if (!g_initialized) {
-            LOG_ERROR("[CheckpointEarlyReturn] Not initialized");
-            return false;
-        }
-
-        // We need to add a check at 0x928d88 that tests if the checkpoint has bit 0x10 set
-        // If it does, we should jump to the exit (0x928fc0) to skip all processing
-        // 
-        // Original code at 0x928d88:
-        //   00928d88: MOV EAX,dword ptr [ESI]       ; Get checkpoint inner pointer
-        //   00928d8a: TEST EAX,EAX                  ; Check if null
-        //   00928d8c: JZ 0x00928da2                 ; Skip if null
-        //   00928d8e: MOV EAX,dword ptr [EAX + 0x44] ; Get flags struct pointer  
-        //   00928d91: TEST EAX,EAX                  ; Check if null
-        //   00928d93: JZ 0x00928da2                 ; Skip if null
-        //   00928d95: MOV ECX,0x10                  ; Load bit mask
-        //   00928d9a: OR word ptr [EAX + 0xa],CX    ; Set triggered bit at offset 0xA
-        //   00928d9e: OR word ptr [EAX + 0x8],CX    ; Set triggered bit at offset 0x8
-        //
-        // We want to insert a check BEFORE the OR instructions to see if the bit is already set,
-        // and if so, jump to 0x928fc0 (the function exit)
-        //
-        // New code at 0x928d95:
-        //   00928d95: TEST word ptr [EAX + 0x8],0x10  ; Check if already triggered (6 bytes: 66 F7 40 08 10 00)
-        //   00928d9b: JNZ 0x00928fc0                  ; Jump to exit if triggered (6 bytes: 0F 85 1F 02 00 00)
-        //   00928da1: NOP                             ; Padding (1 byte: 90)
-        //   00928da2: ... (continue with rest)
-        //
-        // This requires 13 bytes total (0x928d95 to 0x928da1)
-        // Original has: MOV ECX,0x10 (5 bytes) + OR [EAX+0xa],CX (4 bytes) + OR [EAX+0x8],CX (4 bytes) = 13 bytes
-        // Perfect match!
-        
-        uintptr_t patchAddr = g_baseAddress + PROCESS_CHECKPOINT_EARLY_CHECK_RVA + 0xD; // Start at 0x928d95
-        
-        LOG_VERBOSE("[CheckpointEarlyReturn] Patching checkpoint early return at 0x" << std::hex << patchAddr);
-        
-        if (IsBadReadPtr((void*)patchAddr, 13)) {
-            LOG_ERROR("[CheckpointEarlyReturn] Cannot read patch address");
-            return false;
-        }
-        
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(patchAddr);
-        
-        // Check if already patched (first bytes should be TEST)
-        if (bytes[0] == 0x66 && bytes[1] == 0xF7) {
-            LOG_VERBOSE("[CheckpointEarlyReturn] Already patched");
-            return true;
-        }
-        
-        // Verify we have the original code
-        if (bytes[0] != 0xB9 || bytes[1] != 0x10) { // MOV ECX, 0x10
-            LOG_ERROR("[CheckpointEarlyReturn] Unexpected bytes: 0x" << std::hex << (int)bytes[0] << " 0x" << (int)bytes[1]);
-            return false;
-        }
-        
-        DWORD oldProtect;
-        if (!VirtualProtect((void*)patchAddr, 13, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[CheckpointEarlyReturn] Failed to change memory protection");
-            return false;
-        }
-        
-        // Calculate jump offset to 0x928fc0 from 0x928d9b (after the JNZ instruction)
-        // JNZ target = 0x928fc0, JNZ at 0x928d9b, next instruction at 0x928da1
-        // Offset = 0x928fc0 - 0x928da1 = 0x21F
-        int32_t jumpOffset = 0x21F;
-        
-        // Write new code:
-        // TEST word ptr [EAX + 0x8], 0x10  (6 bytes)
-        bytes[0] = 0x66;  // Operand size prefix for word operation
-        bytes[1] = 0xF7;  // TEST r/m16, imm16
-        bytes[2] = 0x40;  // ModR/M byte: [EAX + disp8]
-        bytes[3] = 0x08;  // Displacement: +0x8
-        bytes[4] = 0x10;  // Immediate value low byte
-        bytes[5] = 0x00;  // Immediate value high byte
-        
-        // JNZ 0x928fc0 (6 bytes)
-        bytes[6] = 0x0F;  // Two-byte opcode prefix
-        bytes[7] = 0x85;  // JNZ (near)
-        *reinterpret_cast<int32_t*>(&bytes[8]) = jumpOffset; // Offset (little-endian)
-        
-        // NOP (1 byte)
-        bytes[12] = 0x90;
-        
-        VirtualProtect((void*)patchAddr, 13, oldProtect, &oldProtect);
-        
-        LOG_VERBOSE("[CheckpointEarlyReturn] SUCCESS! Added early return check for triggered checkpoints!");
-        return true;
+        return ApplyPatches(PatchManager::GROUP_CHECKPOINT_EARLY_RETURN);
     }
 
     bool UnpatchCheckpointEarlyReturn() {
-        if (!g_initialized) {
-            LOG_ERROR("[CheckpointEarlyReturnRestore] Not initialized");
-            return false;
-        }
-        
-        uintptr_t patchAddr = g_baseAddress + PROCESS_CHECKPOINT_EARLY_CHECK_RVA + 0xD;
-        
-        LOG_VERBOSE("[CheckpointEarlyReturnRestore] Restoring original checkpoint code at 0x" << std::hex << patchAddr);
-        
-        if (IsBadReadPtr((void*)patchAddr, 13)) {
-            LOG_ERROR("[CheckpointEarlyReturnRestore] Cannot read patch address");
-            return false;
-        }
-        
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(patchAddr);
-        
-        // Check if already restored
-        if (bytes[0] == 0xB9 && bytes[1] == 0x10) {
-            LOG_VERBOSE("[CheckpointEarlyReturnRestore] Already restored");
-            return true;
-        }
-        
-        // Verify it's patched code
-        if (bytes[0] != 0x66 || bytes[1] != 0xF7) {
-            LOG_ERROR("[CheckpointEarlyReturnRestore] Unexpected bytes: 0x" << std::hex << (int)bytes[0] << " 0x" << (int)bytes[1]);
-            return false;
-        }
-        
-        DWORD oldProtect;
-        if (!VirtualProtect((void*)patchAddr, 13, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[CheckpointEarlyReturnRestore] Failed to change memory protection");
-            return false;
-        }
-        
-        // Restore original code:
-        // MOV ECX, 0x10 (5 bytes)
-        bytes[0] = 0xB9;  // MOV ECX, imm32
-        bytes[1] = 0x10;  
-        bytes[2] = 0x00;
-        bytes[3] = 0x00;
-        bytes[4] = 0x00;
-        
-        // OR word ptr [EAX + 0xA], CX (4 bytes)
-        bytes[5] = 0x66;  // Operand size prefix
-        bytes[6] = 0x09;  // OR r/m16, r16
-        bytes[7] = 0x48;  // ModR/M: [EAX + disp8], CX
-        bytes[8] = 0x0A;  // Displacement: +0xA
-        
-        // OR word ptr [EAX + 0x8], CX (4 bytes)
-        bytes[9] = 0x66;   // Operand size prefix
-        bytes[10] = 0x09;  // OR r/m16, r16  
-        bytes[11] = 0x48;  // ModR/M: [EAX + disp8], CX
-        bytes[12] = 0x08;  // Displacement: +0x8
-        
-        VirtualProtect((void*)patchAddr, 13, oldProtect, &oldProtect);
-        
-        LOG_VERBOSE("[CheckpointEarlyReturnRestore] SUCCESS! Restored original checkpoint processing!");
-        return true;
+        return RestorePatches(PatchManager::GROUP_CHECKPOINT_EARLY_RETURN);
     }
 
     bool PatchFinishLineCheck() {
-        if (!g_initialized) {
-            LOG_ERROR("[FinishLinePatch] Not initialized");
-            return false;
-        }
-
-        // This patches the JNZ instruction that skips the finish logic
-        // When finish line is disabled, we want to ALWAYS skip (convert JNZ to JMP)
-        uintptr_t jnzAddr = g_baseAddress + PROCESS_CHECKPOINT_FINISH_CHECK_RVA;
-        
-        LOG_VERBOSE("[FinishLinePatch] Patching finish line check at 0x" << std::hex << jnzAddr);
-        
-        if (IsBadReadPtr((void*)jnzAddr, 6)) {
-            LOG_ERROR("[FinishLinePatch] Cannot read JNZ address");
-            return false;
-        }
-        
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(jnzAddr);
-        
-        // Check what we have
-        if (bytes[0] == 0xEB) {
-            LOG_VERBOSE("[FinishLinePatch] Already patched (found JMP)");
-            return true;
-        }
-        
-        if (bytes[0] == 0x75 || (bytes[0] == 0x0F && bytes[1] == 0x85)) {
-            // It's JNZ, we need to convert to JMP
-            DWORD oldProtect;
-            int patchSize = (bytes[0] == 0x75) ? 2 : 6;
-            
-            if (!VirtualProtect((void*)jnzAddr, patchSize, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-                LOG_ERROR("[FinishLinePatch] Failed to change memory protection");
-                return false;
-            }
-            
-            if (patchSize == 2) {
-                // Short JNZ -> Short JMP
-                bytes[0] = 0xEB;  // JMP (short)
-                // Keep the same offset (bytes[1])
-            } else {
-                // Long JNZ -> Long JMP
-                bytes[0] = 0xE9;  // JMP (near)
-                // Keep the same offset (bytes[1-4])
-            }
-            
-            VirtualProtect((void*)jnzAddr, patchSize, oldProtect, &oldProtect);
-            
-            LOG_VERBOSE("[FinishLinePatch] SUCCESS! Converted JNZ to JMP - finish line won't trigger finish logic!");
-            return true;
-        }
-        
-        LOG_ERROR("[FinishLinePatch] Unexpected instruction: 0x" << std::hex << (int)bytes[0]);
-        return false;
+        return ApplyPatches(PatchManager::GROUP_FINISH_LINE_CHECK);
     }
 
     bool UnpatchFinishLineCheck() {
-        if (!g_initialized) {
-            LOG_ERROR("[FinishLineUnpatch] Not initialized");
-            return false;
-        }
-        
-        uintptr_t jmpAddr = g_baseAddress + PROCESS_CHECKPOINT_FINISH_CHECK_RVA;
-        
-        LOG_VERBOSE("[FinishLineUnpatch] Restoring finish line check at 0x" << std::hex << jmpAddr);
-        
-        if (IsBadReadPtr((void*)jmpAddr, 6)) {
-            LOG_ERROR("[FinishLineUnpatch] Cannot read JMP address");
-            return false;
-        }
-        
-        uint8_t* bytes = reinterpret_cast<uint8_t*>(jmpAddr);
-        
-        // Check if already restored
-        if (bytes[0] == 0x75 || (bytes[0] == 0x0F && bytes[1] == 0x85)) {
-            LOG_VERBOSE("[FinishLineUnpatch] Already restored (found JNZ)");
-            return true;
-        }
-        
-        if (bytes[0] != 0xEB && bytes[0] != 0xE9) {
-            LOG_ERROR("[FinishLineUnpatch] Unexpected instruction: 0x" << std::hex << (int)bytes[0]);
-            return false;
-        }
-        
-        DWORD oldProtect;
-        int patchSize = (bytes[0] == 0xEB) ? 2 : 6;
-        
-        if (!VirtualProtect((void*)jmpAddr, patchSize, PAGE_EXECUTE_READWRITE, &oldProtect)) {
-            LOG_ERROR("[FinishLineUnpatch] Failed to change memory protection");
-            return false;
-        }
-        
-        if (patchSize == 2) {
-            // Short JMP -> Short JNZ
-            bytes[0] = 0x75;  // JNZ (short)
-        } else {
-            // Long JMP -> Long JNZ
-            bytes[0] = 0x0F;
-            bytes[1] = 0x85;
-        }
-        
-        VirtualProtect((void*)jmpAddr, patchSize, oldProtect, &oldProtect);
-        
-        LOG_VERBOSE("[FinishLineUnpatch] SUCCESS! Restored JNZ - finish line will trigger finish logic normally!");
-        return true;
+        return RestorePatches(PatchManager::GROUP_FINISH_LINE_CHECK);
     }
 
     bool ToggleFinishLine() {
@@ -3029,7 +1702,7 @@ namespace Respawn {
             if (currentFaults >= (int)faultLimit) {
                 if (!g_faultOutTriggered) {
                     LOG_VERBOSE("[LimitEnforce] Faults (" << currentFaults << ") >= limit (" << faultLimit << "). Triggering fault-out!");
-                    InstantFaultOut();
+                    GameThread::Post("InstantFaultOut", &InstantFaultOut);
                     g_faultOutTriggered = true;
                 }
             } else {
@@ -3050,7 +1723,7 @@ namespace Respawn {
             if (currentTimeMs >= timeLimitMs) {
                 if (!g_timeOutTriggered) {
                     LOG_VERBOSE("[LimitEnforce] Time (" << currentTimeMs/1000 << "s) >= limit (" << timeLimitMs/1000 << "s). Triggering time-out!");
-                    InstantTimeOut();
+                    GameThread::Post("InstantTimeOut", &InstantTimeOut);
                     g_timeOutTriggered = true;
                 }
             } else {
@@ -3064,86 +1737,91 @@ namespace Respawn {
 
         bool ctrlPressed = (GetAsyncKeyState(VK_CONTROL) & 0x8000) != 0;
 
+        // Everything below calls into the game, so it is queued for the game thread
+        // (this runs on KeyMonitorThread)
+
         // Respawn at current checkpoint
         if (Keybindings::IsActionPressed(Keybindings::Action::RespawnAtCheckpoint)) {
-            RespawnAtCheckpoint();
+            GameThread::Post("RespawnAtCheckpoint", &RespawnAtCheckpoint);
         }
 
         // Previous checkpoint
         if (Keybindings::IsActionPressed(Keybindings::Action::RespawnPrevCheckpoint)) {
-            RespawnAtPreviousCheckpoint();
+            GameThread::Post("RespawnAtPreviousCheckpoint", &RespawnAtPreviousCheckpoint);
         }
 
         // Next checkpoint
         if (Keybindings::IsActionPressed(Keybindings::Action::RespawnNextCheckpoint)) {
-            RespawnAtNextCheckpoint();
+            GameThread::Post("RespawnAtNextCheckpoint", &RespawnAtNextCheckpoint);
         }
 
         // Forward 5 checkpoints
         if (Keybindings::IsActionPressed(Keybindings::Action::RespawnForward5)) {
-            RespawnAtCheckpointOffset(5);
+            GameThread::Post("RespawnAtCheckpointOffset", []() { return RespawnAtCheckpointOffset(5); });
         }
 
         // Increment fault counter
         if (Keybindings::IsActionPressed(Keybindings::Action::IncrementFault)) {
-            IncrementFaultCounter();
+            GameThread::Post("IncrementFaultCounter", &IncrementFaultCounter);
         }
 
         // Debug fault counter
         if (Keybindings::IsActionPressed(Keybindings::Action::DebugFaultCounter)) {
-            DebugFaultCounterPath();
+            GameThread::Post("DebugFaultCounterPath", &DebugFaultCounterPath);
         }
 
         // Add 100 faults
         if (Keybindings::IsActionPressed(Keybindings::Action::Add100Faults)) {
-            IncrementFaultCounterBy(100);
+            GameThread::Post("IncrementFaultCounterBy", []() { return IncrementFaultCounterBy(100); });
         }
 
         // Subtract 100 faults
         if (Keybindings::IsActionPressed(Keybindings::Action::Subtract100Faults)) {
-            IncrementFaultCounterBy(-100);
+            GameThread::Post("IncrementFaultCounterBy", []() { return IncrementFaultCounterBy(-100); });
         }
 
         // Reset faults to 0
         if (Keybindings::IsActionPressed(Keybindings::Action::ResetFaults)) {
-            SetFaultCounterValue(0);
+            GameThread::Post("SetFaultCounterValue", []() { return SetFaultCounterValue(0); });
         }
 
         // Debug time counter
         if (Keybindings::IsActionPressed(Keybindings::Action::DebugTimeCounter)) {
-            DebugTimeCounter();
+            GameThread::Post("DebugTimeCounter", &DebugTimeCounter);
         }
 
         // Add 60 seconds / 3600 frames at 60fps
         if (Keybindings::IsActionPressed(Keybindings::Action::Add60Seconds)) {
-            AdjustRaceTimeMs(3600);
+            GameThread::Post("AdjustRaceTimeMs", []() { return AdjustRaceTimeMs(3600); });
         }
 
         // Subtract 60 seconds / 3600 frames at 60fps
         if (Keybindings::IsActionPressed(Keybindings::Action::Subtract60Seconds)) {
-            AdjustRaceTimeMs(-3600);
+            GameThread::Post("AdjustRaceTimeMs", []() { return AdjustRaceTimeMs(-3600); });
         }
 
         // Add 10 minute / 36000 frames at 60fps
         if (Keybindings::IsActionPressed(Keybindings::Action::Add10Minute)) {
-            AdjustRaceTimeMs(36000);
+            GameThread::Post("AdjustRaceTimeMs", []() { return AdjustRaceTimeMs(36000); });
         }
 
         // Reset time to 0
         if (Keybindings::IsActionPressed(Keybindings::Action::ResetTime)) {
-            SetRaceTimeMs(0);
+            GameThread::Post("SetRaceTimeMs", []() { return SetRaceTimeMs(0); });
         }
 
         // Toggle ALL limit validation (F4)
         if (Keybindings::IsActionPressed(Keybindings::Action::ToggleLimitValidation)) {
-            // Check current state by looking at one of the patches
-            if (IsFaultValidationDisabled() || IsTimeValidationDisabled()) {
-                // Currently disabled, so enable
-                EnableAllLimitValidation();
-            } else {
-                // Currently enabled, so disable
-                DisableAllLimitValidation();
-            }
+            GameThread::Post("ToggleLimitValidation", []() {
+                // Check current state by looking at one of the patches
+                if (IsFaultValidationDisabled() || IsTimeValidationDisabled()) {
+                    // Currently disabled, so enable
+                    return EnableAllLimitValidation();
+                } else {
+                    // Currently enabled, so disable
+                    return DisableAllLimitValidation();
+                }
+            });
         }
 
         // Ctrl+0-9 = Jump to checkpoint
@@ -3154,7 +1832,7 @@ namespace Respawn {
 
                 if (keyIsPressed && !g_numberKeysPressed[i]) {
                     LOG_VERBOSE("[Respawn] Ctrl+" << i << " pressed, jumping to checkpoint " << i);
-                    RespawnAtCheckpointIndex(i);
+                    GameThread::Post("RespawnAtCheckpointIndex", [i]() { return RespawnAtCheckpointIndex(i); });
                 }
 
                 g_numberKeysPressed[i] = keyIsPressed;
@@ -8,6 +8,9 @@ namespace Respawn {
     // Shutdown and cleanup
     void Shutdown();
 
+    // Drop cached checkpoint state when a track is loaded
+    void OnTrackChanged();
+
     // Respawn the rider/bike at the current checkpoint
     bool RespawnAtCheckpoint();
 
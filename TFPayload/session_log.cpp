@@ -0,0 +1,177 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include "pch.h"
+#include "session_log.h"
+#include "background_writer.h"
+#include "logging.h"
+#include <atomic>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <mutex>
+
+namespace SessionLog {
+
+    struct Counters {
+        std::atomic<uint64_t> lines{ 0 };
+        std::atomic<uint64_t> dropped{ 0 };
+        std::atomic<uint64_t> batches{ 0 };
+        std::atomic<uint64_t> bytesWritten{ 0 };
+    };
+
+    static Counters s_counters;
+
+    // Producers append to s_pending; the writer swaps it with s_batch so both keep their capacity
+    static std::mutex s_mutex;
+    static std::string s_pending;
+    static std::string s_batch;
+    static uint32_t s_maxPendingBytes = 0;
+    static std::atomic<uint32_t> s_pendingBytes{ 0 };
+
+    // Timestamp cache (guarded by s_mutex)
+    static time_t s_cachedSecond = 0;
+    static char s_cachedStamp[32] = {};
+
+    static std::atomic<bool> s_active{ false };
+    static BackgroundWriter s_writer;
+    static DWORD s_flushIntervalMs = 100;
+    static DWORD s_lastWrite = 0;               // Writer thread only
+
+    static std::ofstream s_file;
+    static std::string s_path;
+
+    // Caller holds s_mutex
+    static const char* CachedTimestamp() {
+        time_t now = time(nullptr);
+        if (now != s_cachedSecond || s_cachedStamp[0] == '\0') {
+            s_cachedSecond = now;
+            strftime(s_cachedStamp, sizeof(s_cachedStamp), "%Y-%m-%d %H:%M:%S", std::localtime(&now));
+        }
+        return s_cachedStamp;
+    }
+
+    static void WriteBatch() {
+        {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            if (s_pending.empty()) return;
+            s_pending.swap(s_batch);
+            s_pendingBytes.store(0, std::memory_order_relaxed);
+        }
+
+        s_file.write(s_batch.data(), s_batch.size());
+        s_file.flush();
+        s_counters.batches.fetch_add(1, std::memory_order_relaxed);
+        s_counters.bytesWritten.fetch_add(s_batch.size(), std::memory_order_relaxed);
+        s_batch.clear();
+    }
+
+    // The writer wakes every slice but only writes when the interval is up, a flush was
+    // requested, or the batch is filling up faster than the interval drains it
+    static const DWORD WAKE_SLICE_MS = 10;
+
+    static void Drain(bool flush) {
+        bool filling = s_pendingBytes.load(std::memory_order_relaxed) >= s_maxPendingBytes / 4;
+        if (flush || filling || GetTickCount() - s_lastWrite >= s_flushIntervalMs) {
+            WriteBatch();
+            s_lastWrite = GetTickCount();
+        }
+    }
+
+    // ============================================================================
+    // Public API
+    // ============================================================================
+
+    bool Start(const std::string& path, const Config& config) {
+        if (s_active.load()) {
+            LOG_WARNING("[SessionLog] Already logging to " << s_path);
+            return true;
+        }
+
+        s_maxPendingBytes = config.maxPendingBytes < 4096 ? 4096 : config.maxPendingBytes;
+        s_flushIntervalMs = config.flushIntervalMs;
+        {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            s_pending.clear();
+            s_pending.reserve(s_maxPendingBytes);
+            s_pendingBytes.store(0, std::memory_order_relaxed);
+        }
+        s_batch.clear();
+        s_batch.reserve(s_maxPendingBytes);
+
+        s_file.open(path, std::ios::out | std::ios::app | std::ios::binary);
+        if (!s_file.is_open()) {
+            LOG_ERROR("[SessionLog] Could not open session log: " << path);
+            return false;
+        }
+        s_path = path;
+
+        s_lastWrite = GetTickCount();
+        if (!s_writer.Start(Drain, WAKE_SLICE_MS)) {
+            LOG_ERROR("[SessionLog] Failed to create writer thread");
+            s_file.close();
+            return false;
+        }
+
+        s_active.store(true, std::memory_order_release);
+        LOG_VERBOSE("[SessionLog] Logging session events to " << path);
+        return true;
+    }
+
+    void Stop() {
+        if (!s_active.exchange(false)) return;
+
+        if (s_writer.Stop()) {
+            s_file.close();
+        } else {
+            LOG_WARNING("[SessionLog] Writer thread did not exit in time");
+        }
+
+        Stats stats = GetStats();
+        LOG_VERBOSE("[SessionLog] Stopped: " << stats.lines << " lines in " << stats.batches
+            << " writes, " << stats.dropped << " dropped");
+    }
+
+    bool IsRunning() {
+        return s_active.load(std::memory_order_acquire);
+    }
+
+    void Write(const std::string& line) {
+        if (!s_active.load(std::memory_order_acquire)) return;
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+        const char* stamp = CachedTimestamp();
+        size_t needed = line.size() + strlen(stamp) + 4;
+        if (s_pending.size() + needed > s_maxPendingBytes) {
+            s_counters.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        s_pending += '[';
+        s_pending += stamp;
+        s_pending += "] ";
+        s_pending += line;
+        s_pending += '\n';
+        s_pendingBytes.store((uint32_t)s_pending.size(), std::memory_order_relaxed);
+        s_counters.lines.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool Flush(DWORD timeoutMs) {
+        if (!s_active.load()) return false;
+        return s_writer.Flush(timeoutMs);
+    }
+
+    std::string GetTimestampString() {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        return CachedTimestamp();
+    }
+
+    Stats GetStats() {
+        Stats stats;
+        stats.lines = s_counters.lines.load(std::memory_order_relaxed);
+        stats.dropped = s_counters.dropped.load(std::memory_order_relaxed);
+        stats.batches = s_counters.batches.load(std::memory_order_relaxed);
+        stats.bytesWritten = s_counters.bytesWritten.load(std::memory_order_relaxed);
+        stats.pendingBytes = s_pendingBytes.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+} // namespace SessionLog
@@ -0,0 +1,57 @@
+#pragma once
+#include <Windows.h>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+// Buffered session log for Multiplayer
+// Callers append timestamped lines to an in-memory batch under a short lock; a background
+// thread swaps the batch out and writes it to a file that stays open for the whole session,
+// so hooks never open, write or close the file themselves.
+// When the pending batch is over maxPendingBytes new lines are counted as dropped.
+
+namespace SessionLog {
+
+    struct Config {
+        uint32_t maxPendingBytes = 1024 * 1024;
+        DWORD flushIntervalMs = 100;
+    };
+
+    struct Stats {
+        uint64_t lines = 0;
+        uint64_t dropped = 0;
+        uint64_t batches = 0;                   // Writes issued by the writer thread
+        uint64_t bytesWritten = 0;
+        uint32_t pendingBytes = 0;
+    };
+
+    // Open the log (appending) and start the writer thread
+    bool Start(const std::string& path, const Config& config = Config());
+
+    // Write everything pending, stop the writer thread and close the file
+    void Stop();
+
+    bool IsRunning();
+
+    // Queue one line, prefixed with the cached timestamp - safe from any thread
+    void Write(const std::string& line);
+
+    // Block until everything written so far is on disk (or timeoutMs passes)
+    bool Flush(DWORD timeoutMs = 1000);
+
+    // "YYYY-MM-DD HH:MM:SS", reformatted at most once per second
+    std::string GetTimestampString();
+
+    Stats GetStats();
+
+} // namespace SessionLog
+
+// Stream-style helper matching the LOG_* macros; skips formatting when the log is closed
+#define SESSION_LOG(...) \
+    do { \
+        if (SessionLog::IsRunning()) { \
+            std::ostringstream oss; \
+            oss << __VA_ARGS__; \
+            SessionLog::Write(oss.str()); \
+        } \
+    } while(0)
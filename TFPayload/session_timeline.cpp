@@ -0,0 +1,141 @@
+#include "pch.h"
+#include "session_timeline.h"
+#include "logging.h"
+#include <Windows.h>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+namespace SessionTimeline {
+
+    using SessionTimelineFormat::Event;
+
+    // Session hooks fire a few dozen times per race; this only fills if Pump() stops running
+    static const size_t MAX_PENDING = 4096;
+
+    static std::atomic<bool> s_running{ false };
+    static std::atomic<uint32_t> s_sessionId{ 0 };
+    static LARGE_INTEGER s_startTicks = {};
+    static LARGE_INTEGER s_frequency = {};
+
+    static std::mutex s_pendingMutex;
+    static std::vector<Event> s_pending;
+
+    // File state (Start/Stop/Pump)
+    static std::mutex s_fileMutex;
+    static std::ofstream s_file;
+
+    struct Counters {
+        std::atomic<uint64_t> recorded{ 0 };
+        std::atomic<uint64_t> dropped{ 0 };
+        std::atomic<uint64_t> written{ 0 };
+    };
+
+    static Counters s_counters;
+
+    // Caller holds s_fileMutex
+    static void WritePending() {
+        std::vector<Event> events;
+        {
+            std::lock_guard<std::mutex> lock(s_pendingMutex);
+            events.swap(s_pending);
+        }
+        if (events.empty() || !s_file.is_open()) return;
+
+        s_file.write((const char*)events.data(), events.size() * sizeof(Event));
+        s_file.flush();
+        s_counters.written.fetch_add(events.size(), std::memory_order_relaxed);
+    }
+
+    // ============================================================================
+    // Public API
+    // ============================================================================
+
+    bool Start(const std::string& path) {
+        std::lock_guard<std::mutex> fileLock(s_fileMutex);
+        if (s_running) return true;
+
+        s_file.open(path, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!s_file.is_open()) {
+            LOG_ERROR("[Timeline] Could not open timeline file: " << path);
+            return false;
+        }
+
+        uint64_t startUnixMicros = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        SessionTimelineFormat::FileHeader header = SessionTimelineFormat::MakeFileHeader(startUnixMicros);
+        s_file.write((const char*)&header, sizeof(header));
+        s_file.flush();
+
+        QueryPerformanceFrequency(&s_frequency);
+        QueryPerformanceCounter(&s_startTicks);
+        {
+            std::lock_guard<std::mutex> lock(s_pendingMutex);
+            s_pending.clear();
+            s_pending.reserve(256);
+        }
+        s_running = true;
+
+        LOG_VERBOSE("[Timeline] Recording session timeline to " << path);
+        return true;
+    }
+
+    void Stop() {
+        std::lock_guard<std::mutex> fileLock(s_fileMutex);
+        if (!s_running.exchange(false)) return;
+        WritePending();
+        s_file.close();
+    }
+
+    bool IsRunning() {
+        return s_running;
+    }
+
+    void Record(EventType type, uint32_t arg0, uint32_t arg1) {
+        if (type == SessionTimelineFormat::EVENT_SESSION_CREATED || type == SessionTimelineFormat::EVENT_SESSION_JOIN) {
+            s_sessionId.store(arg0, std::memory_order_relaxed);
+        }
+        if (!s_running) {
+            s_counters.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // Stamp and append under the lock so the file stays in time order across threads
+        std::lock_guard<std::mutex> lock(s_pendingMutex);
+        if (s_pending.size() >= MAX_PENDING) {
+            s_counters.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+
+        Event event;
+        event.timeMicros = (uint64_t)((now.QuadPart - s_startTicks.QuadPart) * 1000000 / s_frequency.QuadPart);
+        event.type = (uint16_t)type;
+        event.reserved = 0;
+        event.sessionId = s_sessionId.load(std::memory_order_relaxed);
+        event.arg0 = arg0;
+        event.arg1 = arg1;
+        s_pending.push_back(event);
+        s_counters.recorded.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Pump() {
+        std::lock_guard<std::mutex> fileLock(s_fileMutex);
+        if (!s_running) return;
+        WritePending();
+    }
+
+    Stats GetStats() {
+        Stats stats;
+        stats.recorded = s_counters.recorded.load(std::memory_order_relaxed);
+        stats.dropped = s_counters.dropped.load(std::memory_order_relaxed);
+        stats.written = s_counters.written.load(std::memory_order_relaxed);
+        stats.sessionId = s_sessionId.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+} // namespace SessionTimeline
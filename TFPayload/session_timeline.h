@@ -0,0 +1,40 @@
+#pragma once
+#include "session_timeline_format.h"
+#include <cstdint>
+#include <string>
+
+// Typed, timestamped record of the session-level multiplayer hooks
+// Hooks call Record() next to their text log line; events are stamped with a monotonic
+// microsecond clock (QueryPerformanceCounter) and buffered in memory until Pump() appends
+// them to the .tftl file (session_timeline_format.h). tools/session_timeline turns the file
+// into per-session phase durations (matchmaking, lobby, load, race, results).
+
+namespace SessionTimeline {
+
+    using SessionTimelineFormat::EventType;
+
+    struct Stats {
+        uint64_t recorded = 0;
+        uint64_t dropped = 0;                   // Buffer full or not started
+        uint64_t written = 0;
+        uint32_t sessionId = 0;                 // Stamped on new events
+    };
+
+    // Open the timeline file and start the clock
+    bool Start(const std::string& path);
+
+    // Write what is buffered and close the file
+    void Stop();
+
+    bool IsRunning();
+
+    // Any thread - a short critical section, no I/O. SESSION_CREATED / SESSION_JOIN also set
+    // the session id stamped on every later event.
+    void Record(EventType type, uint32_t arg0 = 0, uint32_t arg1 = 0);
+
+    // Background thread - append buffered events to the file
+    void Pump();
+
+    Stats GetStats();
+
+} // namespace SessionTimeline
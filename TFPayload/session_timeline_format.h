@@ -0,0 +1,116 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+
+// On-disk format for SessionTimeline (.tftl)
+//
+//   FileHeader (32 bytes)
+//   Event, Event, ...              24 bytes each, in the order they were recorded
+//
+// Each event is one session-level hook firing, stamped with a monotonic microsecond clock
+// that starts at the header's wall-clock time. tools/session_timeline rebuilds the
+// matchmaking / lobby / load / race / results phases from the event sequence.
+// Header-only and Windows-free so the tool can share it.
+
+namespace SessionTimelineFormat {
+
+    const uint32_t FILE_MAGIC = 0x4C544654;     // "TFTL"
+    const uint16_t VERSION = 1;
+
+    // Values are stored in the file - append only, never renumber
+    enum EventType : uint16_t {
+        EVENT_MENU_OPENED = 1,                  // PrepareAndLoadMultiplayerMenu
+        EVENT_JOIN_MODE = 2,                    // SetMultiplayerJoinMode (arg0 = mode, arg1 = param_2)
+        EVENT_MULTIPLAYER_MODE = 3,             // SetMultiplayerMode (arg0 = 0 online, 1 local)
+        EVENT_RANKED_REQUESTED = 4,             // SendStartLiveQuickGameMessage
+        EVENT_PRIVATE_CREATED = 5,              // SendCreatePrivateRaceMessage
+        EVENT_MATCHMAKING_STARTED = 6,          // start_matchmaking
+        EVENT_SESSION_INITIALIZED = 7,          // InitializeMultiplayerSession
+        EVENT_SESSION_CREATED = 8,              // HandleSessionCreateEvent (arg0 = session id)
+        EVENT_SESSION_JOIN = 9,                 // HandleSessionJoinRequest (arg0 = session id)
+        EVENT_LOBBY_ONLINE = 10,                // SendMoveToLiveLobbyMessage
+        EVENT_LOBBY_LOCAL = 11,                 // MoveToLocalMultiplayerLobby
+        EVENT_LOBBY_START = 12,                 // HandleMultiplayerLobbyStart (arg0 = mode/state)
+        EVENT_LOBBY_TO_RACE = 13,               // HandleMultiplayerLobbyStart2 (arg0 = param_1)
+        EVENT_PRIVATE_STARTED = 14,             // SendStartPrivateRaceMessage
+        EVENT_GAME_START_BROADCAST = 15,        // BroadcastGameStartToPlayers
+        EVENT_GAME_START_BY_MODE = 16,          // handle_game_start_by_mode (arg0 = from invite)
+        EVENT_RACE_LOADING = 17,                // StartGameOrReturnToLobby (arg0 = param_1)
+        EVENT_START_RACE = 18,                  // StartRace
+        EVENT_LOAD_AND_START = 19,              // LoadAndStartRace entered (arg0 = param_2)
+        EVENT_LOAD_AND_START_RETURNED = 20,     // LoadAndStartRace returned (arg0 = result)
+        EVENT_MULTIPLAYER_SESSION_START = 21,   // StartMultiplayerSession
+        EVENT_NETWORK = 22,                     // NotifyNetworkEvent (arg0 = event type)
+        EVENT_GAME_STATE = 23,                  // Race state changed (arg0 = new state, arg1 = old state)
+        EVENT_TYPE_COUNT
+    };
+
+    // Race states seen in the game manager (game manager + 0x08)
+    const uint32_t GAME_STATE_RACING = 6;       // HandleRaceFinish expects at least this
+    const uint32_t GAME_STATE_FINISHED = 9;
+
+#pragma pack(push, 1)
+    struct FileHeader {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t headerSize;
+        uint16_t eventSize;
+        uint16_t reserved0;
+        uint64_t startUnixMicros;       // Wall clock at timeMicros == 0
+        uint8_t reserved[12];
+    };
+
+    struct Event {
+        uint64_t timeMicros;            // Monotonic, since startUnixMicros
+        uint16_t type;                  // EventType
+        uint16_t reserved;
+        uint32_t sessionId;             // Last created/joined session (0 = none yet)
+        uint32_t arg0;
+        uint32_t arg1;
+    };
+#pragma pack(pop)
+
+    static_assert(sizeof(FileHeader) == 32, "FileHeader must stay 32 bytes");
+    static_assert(sizeof(Event) == 24, "Event must stay 24 bytes");
+
+    inline FileHeader MakeFileHeader(uint64_t startUnixMicros) {
+        FileHeader header;
+        memset(&header, 0, sizeof(header));
+        header.magic = FILE_MAGIC;
+        header.version = VERSION;
+        header.headerSize = sizeof(FileHeader);
+        header.eventSize = sizeof(Event);
+        header.startUnixMicros = startUnixMicros;
+        return header;
+    }
+
+    inline const char* GetEventName(uint16_t type) {
+        switch (type) {
+            case EVENT_MENU_OPENED: return "MenuOpened";
+            case EVENT_JOIN_MODE: return "JoinMode";
+            case EVENT_MULTIPLAYER_MODE: return "MultiplayerMode";
+            case EVENT_RANKED_REQUESTED: return "RankedRequested";
+            case EVENT_PRIVATE_CREATED: return "PrivateCreated";
+            case EVENT_MATCHMAKING_STARTED: return "MatchmakingStarted";
+            case EVENT_SESSION_INITIALIZED: return "SessionInitialized";
+            case EVENT_SESSION_CREATED: return "SessionCreated";
+            case EVENT_SESSION_JOIN: return "SessionJoin";
+            case EVENT_LOBBY_ONLINE: return "LobbyOnline";
+            case EVENT_LOBBY_LOCAL: return "LobbyLocal";
+            case EVENT_LOBBY_START: return "LobbyStart";
+            case EVENT_LOBBY_TO_RACE: return "LobbyToRace";
+            case EVENT_PRIVATE_STARTED: return "PrivateStarted";
+            case EVENT_GAME_START_BROADCAST: return "GameStartBroadcast";
+            case EVENT_GAME_START_BY_MODE: return "GameStartByMode";
+            case EVENT_RACE_LOADING: return "RaceLoading";
+            case EVENT_START_RACE: return "StartRace";
+            case EVENT_LOAD_AND_START: return "LoadAndStartRace";
+            case EVENT_LOAD_AND_START_RETURNED: return "LoadAndStartRaceReturned";
+            case EVENT_MULTIPLAYER_SESSION_START: return "MultiplayerSessionStart";
+            case EVENT_NETWORK: return "NetworkEvent";
+            case EVENT_GAME_STATE: return "GameState";
+            default: return "Unknown";
+        }
+    }
+
+} // namespace SessionTimelineFormat
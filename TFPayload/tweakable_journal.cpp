@@ -0,0 +1,219 @@
+// tweakable_journal.cpp
+// Per-frame coalesced game writes and undo/redo for DevMenu tweakables
+#include "pch.h"
+#include "tweakable_journal.h"
+#include "devMenuSync.h"
+#include "logging.h"
+#include <ostream>
+
+namespace {
+    // Streams a slot value the way the menu shows it
+    struct ValueText {
+        TweakableType type;
+        TweakableValue value;
+    };
+
+    std::ostream& operator<<(std::ostream& out, const ValueText& text) {
+        switch (text.type) {
+        case TweakableType::Float: return out << text.value.f;
+        case TweakableType::Bool:  return out << (text.value.i ? "true" : "false");
+        default:                   return out << text.value.i;
+        }
+    }
+}
+
+void TweakableJournal::Bind(TweakableRegistry* registry) {
+    m_registry = registry;
+    uint32_t count = registry->GetCount();
+
+    m_committed.resize(count);
+    for (uint32_t slot = 0; slot < count; slot++) {
+        m_committed[slot] = registry->GetValue(slot);
+    }
+    m_isPending.assign(count, 0);
+    m_isTouched.assign(count, 0);
+    m_pending.clear();
+    m_touched.clear();
+    m_undo.clear();
+    m_redo.clear();
+    m_undoSteps = 0;
+    m_entryOpen = false;
+    m_inBatch = false;
+
+    m_pending.reserve(16);
+    m_writeAddresses.reserve(16);
+    m_writeValues.reserve(16);
+}
+
+void TweakableJournal::OnTweakableChanged(TweakableRegistry&, uint32_t slot) {
+    MarkPending(slot, PENDING_EDIT);
+}
+
+void TweakableJournal::Set(uint32_t slot, TweakableValue value) {
+    m_registry->SetValue(slot, value);
+    MarkPending(slot, m_inBatch ? PENDING_BATCH : PENDING_EDIT);
+}
+
+void TweakableJournal::BeginBatch(const char* label) {
+    m_inBatch = true;
+    m_batchLabel = label;
+}
+
+void TweakableJournal::EndBatch() {
+    m_inBatch = false;
+}
+
+void TweakableJournal::MarkPending(uint32_t slot, Pending kind) {
+    if (m_isPending[slot] == PENDING_NONE) {
+        m_pending.push_back(slot);
+    }
+    // A batch write wins over an edit of the same slot in the same frame
+    if (kind > m_isPending[slot]) m_isPending[slot] = kind;
+}
+
+// Start a new undo step, dropping the oldest one if the history is full
+uint32_t TweakableJournal::NewStep() {
+    if (m_undoSteps >= MAX_UNDO && !m_undo.empty()) {
+        uint32_t oldest = m_undo.front().step;
+        auto end = m_undo.begin();
+        while (end != m_undo.end() && end->step == oldest) ++end;
+        m_undo.erase(m_undo.begin(), end);
+        m_undoSteps--;
+    }
+    m_undoSteps++;
+    return m_nextStep++;
+}
+
+// Remember the value and queue it for this frame's batch write
+void TweakableJournal::Commit(uint32_t slot, TweakableValue value) {
+    m_committed[slot] = value;
+    if (!m_isTouched[slot]) {
+        m_isTouched[slot] = 1;
+        m_touched.push_back(slot);
+    }
+
+    void* address = m_registry->GetGameValue(slot);
+    if (address) {
+        m_writeAddresses.push_back(address);
+        m_writeValues.push_back((uint32_t)value.i);
+    }
+}
+
+void TweakableJournal::CloseOpenEntry() {
+    if (!m_entryOpen) return;
+    m_entryOpen = false;
+
+    // A drag that ended where it started isn't worth an undo step
+    const Entry& entry = m_undo.back();
+    if (entry.before.i == entry.after.i) {
+        m_undo.pop_back();
+        m_undoSteps--;
+        return;
+    }
+    LogChange("Set", entry.slot, entry.before, entry.after);
+}
+
+void TweakableJournal::LogChange(const char* action, uint32_t slot, TweakableValue from, TweakableValue to) const {
+    TweakableType type = m_registry->GetType(slot);
+    LOG_VERBOSE("[Journal] " << action << " " << m_registry->GetName(slot) << " (ID=" << m_registry->GetId(slot) << "): "
+        << ValueText{ type, from } << " -> " << ValueText{ type, to }
+        << (m_registry->GetGameValue(slot) ? "" : " (not in game memory, menu only)"));
+}
+
+void TweakableJournal::Flush() {
+    if (!m_registry) return;
+
+    DWORD now = GetTickCount();
+    if (m_entryOpen && now - m_lastEditTick > COALESCE_MS) {
+        CloseOpenEntry();
+    }
+
+    uint32_t batchStep = 0;
+    size_t batchCount = 0;
+    for (uint32_t slot : m_pending) {
+        bool inBatch = m_isPending[slot] == PENDING_BATCH;
+        m_isPending[slot] = PENDING_NONE;
+        TweakableValue value = m_registry->GetValue(slot);
+
+        // Not written yet, so the game still holds the value from before the edit (which
+        // live sync may have changed since the journal last wrote it)
+        TweakableValue before = m_committed[slot];
+        int32_t gameValue;
+        if (DevMenuSync::ReadValue(m_registry->GetId(slot), gameValue)) {
+            before.i = gameValue;
+        }
+        if (value.i == before.i) continue;
+
+        if (inBatch) {
+            CloseOpenEntry();
+            if (batchCount++ == 0) batchStep = NewStep();
+            m_undo.push_back(Entry{ slot, before, value, batchStep });
+        } else if (m_entryOpen && m_undo.back().slot == slot) {
+            m_undo.back().after = value;
+        } else {
+            CloseOpenEntry();
+            m_undo.push_back(Entry{ slot, before, value, NewStep() });
+            m_entryOpen = true;
+        }
+        m_lastEditTick = now;
+        m_redo.clear();
+        Commit(slot, value);
+    }
+    m_pending.clear();
+    if (batchCount) {
+        LOG_VERBOSE("[Journal] " << m_batchLabel << ": " << batchCount << " values changed (one undo step)");
+    }
+
+    if (!m_writeAddresses.empty()) {
+        DevMenuSync::WriteBatch(m_writeAddresses.data(), m_writeValues.data(), m_writeValues.size());
+        m_writeAddresses.clear();
+        m_writeValues.clear();
+    }
+}
+
+void TweakableJournal::Undo() {
+    CloseOpenEntry();
+    if (m_undo.empty()) return;
+
+    uint32_t step = m_undo.back().step;
+    size_t count = 0;
+    while (!m_undo.empty() && m_undo.back().step == step) {
+        Entry entry = m_undo.back();
+        m_undo.pop_back();
+        m_registry->SetValue(entry.slot, entry.before);
+        Commit(entry.slot, entry.before);
+        m_redo.push_back(entry);
+        if (count++ == 0 && (m_undo.empty() || m_undo.back().step != step)) {
+            LogChange("Undo", entry.slot, entry.after, entry.before);
+        }
+    }
+    if (count > 1) LOG_VERBOSE("[Journal] Undo: " << count << " values restored");
+    m_undoSteps--;
+}
+
+void TweakableJournal::Redo() {
+    CloseOpenEntry();
+    if (m_redo.empty()) return;
+
+    uint32_t step = m_redo.back().step;
+    size_t count = 0;
+    while (!m_redo.empty() && m_redo.back().step == step) {
+        Entry entry = m_redo.back();
+        m_redo.pop_back();
+        m_registry->SetValue(entry.slot, entry.after);
+        Commit(entry.slot, entry.after);
+        m_undo.push_back(entry);
+        if (count++ == 0 && (m_redo.empty() || m_redo.back().step != step)) {
+            LogChange("Redo", entry.slot, entry.before, entry.after);
+        }
+    }
+    if (count > 1) LOG_VERBOSE("[Journal] Redo: " << count << " values reapplied");
+    m_undoSteps++;
+}
+
+void TweakableJournal::ClearHistory() {
+    m_undo.clear();
+    m_redo.clear();
+    m_undoSteps = 0;
+    m_entryOpen = false;
+}
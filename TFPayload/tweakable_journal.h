@@ -0,0 +1,92 @@
+#pragma once
+#include "tweakable_registry.h"
+#include <Windows.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Change journal for the game's tweakables (the TweakableTable rows)
+// It is the registry listener for those rows: an edit only marks the slot pending. Flush(),
+// once per frame after the menu is drawn, writes every changed value to the game in one
+// DevMenuSync::WriteBatch and records it for undo. Successive edits of the same slot within
+// COALESCE_MS (a slider drag) merge into one undo step, which is logged once when it closes.
+// Set() calls between BeginBatch and EndBatch (preset apply, Reset All) form a single step.
+// Slots ever edited through the journal are tracked, so the changes view only visits those.
+// Render thread only.
+
+class TweakableJournal : public TweakableListener {
+public:
+    static const size_t MAX_UNDO = 256;             // Oldest steps are dropped beyond this
+    static const DWORD COALESCE_MS = 500;
+
+    struct Entry {
+        uint32_t slot;
+        TweakableValue before;
+        TweakableValue after;
+        uint32_t step;                              // Entries of one undo step share this
+    };
+
+    // After the registry is built, before its first Render
+    void Bind(TweakableRegistry* registry);
+
+    void OnTweakableChanged(TweakableRegistry& registry, uint32_t slot) override;
+
+    // Set a value as if the user had edited it (undoable, written on the next Flush)
+    void Set(uint32_t slot, TweakableValue value);
+
+    // Group the Set() calls in between into one undo step; label is logged with it
+    void BeginBatch(const char* label);
+    void EndBatch();
+
+    // Write this frame's changes to the game and update the undo history
+    void Flush();
+
+    // The slot has a value waiting for the next Flush; live sync must not overwrite it
+    bool IsPending(uint32_t slot) const { return slot < m_isPending.size() && m_isPending[slot] != PENDING_NONE; }
+
+    bool CanUndo() const { return !m_undo.empty(); }
+    bool CanRedo() const { return !m_redo.empty(); }
+    void Undo();
+    void Redo();
+
+    // Drop the undo/redo history (values are left as they are)
+    void ClearHistory();
+
+    // Slots edited through the journal, in first-edit order; some may be back at their default
+    const std::vector<uint32_t>& GetTouchedSlots() const { return m_touched; }
+
+private:
+    enum Pending : uint8_t {
+        PENDING_NONE = 0,
+        PENDING_EDIT,
+        PENDING_BATCH,
+    };
+
+    void MarkPending(uint32_t slot, Pending kind);
+    void Commit(uint32_t slot, TweakableValue value);
+    void CloseOpenEntry();
+    uint32_t NewStep();
+    void LogChange(const char* action, uint32_t slot, TweakableValue from, TweakableValue to) const;
+
+    TweakableRegistry* m_registry = nullptr;
+
+    // Per slot
+    std::vector<TweakableValue> m_committed;        // Last value the journal wrote (fallback when the game can't be read)
+    std::vector<uint8_t> m_isPending;               // Pending
+    std::vector<uint8_t> m_isTouched;
+
+    std::vector<uint32_t> m_pending;                // Edited this frame
+    std::vector<uint32_t> m_touched;
+    std::vector<void*> m_writeAddresses;            // Reused each Flush
+    std::vector<uint32_t> m_writeValues;
+
+    std::vector<Entry> m_undo;
+    std::vector<Entry> m_redo;
+    size_t m_undoSteps = 0;
+    uint32_t m_nextStep = 0;
+    bool m_entryOpen = false;                       // m_undo.back() still absorbs edits of its slot
+    DWORD m_lastEditTick = 0;
+
+    bool m_inBatch = false;
+    std::string m_batchLabel;                       // Of the batch pending for the next Flush
+};
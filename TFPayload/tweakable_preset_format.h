@@ -0,0 +1,113 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// On-disk format for DevMenu tweakable presets (.tfpreset)
+//
+//   FileHeader (64 bytes)
+//   int32_t  ids[count]        Strictly ascending
+//   uint32_t values[count]     Raw 32-bit value (float bits, int, or 0/1 for bools)
+//   uint8_t  types[count]      TweakableType of each value
+//
+// Arrays sit at fixed offsets behind the header, so a mapped file is read in place: Parse()
+// only validates and points a View into it, and Find() is a binary search over ids.
+// gameBuildHash identifies the executable the preset was saved from.
+// Header-only and Windows-free so tools can share it.
+
+namespace TweakablePresetFormat {
+
+    const uint32_t FILE_MAGIC = 0x52504654;     // "TFPR"
+    const uint16_t VERSION = 1;
+    const uint32_t MAX_COUNT = 1 << 16;
+
+#pragma pack(push, 1)
+    struct FileHeader {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t headerSize;
+        uint32_t count;
+        uint32_t gameBuildHash;
+        uint64_t savedUnixMicros;
+        char name[32];
+        uint8_t reserved[8];
+    };
+#pragma pack(pop)
+
+    static_assert(sizeof(FileHeader) == 64, "FileHeader must stay 64 bytes");
+
+    inline size_t FileSize(uint32_t count) {
+        return sizeof(FileHeader) + (size_t)count * (sizeof(int32_t) + sizeof(uint32_t) + sizeof(uint8_t));
+    }
+
+    // A validated preset, pointing into the caller's buffer
+    struct View {
+        const FileHeader* header = nullptr;
+        const int32_t* ids = nullptr;
+        const uint32_t* values = nullptr;
+        const uint8_t* types = nullptr;
+        uint32_t count = 0;
+    };
+
+    // Returns nullptr on success, otherwise what is wrong with the data
+    inline const char* Parse(const void* data, size_t size, View& view) {
+        if (size < sizeof(FileHeader)) return "file too small";
+
+        const FileHeader* header = (const FileHeader*)data;
+        if (header->magic != FILE_MAGIC) return "not a preset file";
+        if (header->version != VERSION) return "unsupported version";
+        if (header->headerSize != sizeof(FileHeader)) return "unexpected header size";
+        if (header->count > MAX_COUNT) return "too many values";
+        if (size < FileSize(header->count)) return "file truncated";
+
+        const uint8_t* body = (const uint8_t*)data + sizeof(FileHeader);
+        view.header = header;
+        view.count = header->count;
+        view.ids = (const int32_t*)body;
+        view.values = (const uint32_t*)(body + (size_t)view.count * sizeof(int32_t));
+        view.types = body + (size_t)view.count * (sizeof(int32_t) + sizeof(uint32_t));
+
+        for (uint32_t i = 1; i < view.count; i++) {
+            if (view.ids[i] <= view.ids[i - 1]) return "ids not sorted";
+        }
+        return nullptr;
+    }
+
+    // Index of id in the view, or -1
+    inline int Find(const View& view, int32_t id) {
+        uint32_t low = 0, high = view.count;
+        while (low < high) {
+            uint32_t mid = low + (high - low) / 2;
+            if (view.ids[mid] < id) low = mid + 1;
+            else high = mid;
+        }
+        return (low < view.count && view.ids[low] == id) ? (int)low : -1;
+    }
+
+    // Serialize entries that are already sorted by id
+    inline void Encode(std::vector<uint8_t>& out, uint32_t gameBuildHash, uint64_t savedUnixMicros, const char* name,
+                       const int32_t* ids, const uint32_t* values, const uint8_t* types, uint32_t count) {
+        FileHeader header;
+        memset(&header, 0, sizeof(header));
+        header.magic = FILE_MAGIC;
+        header.version = VERSION;
+        header.headerSize = sizeof(FileHeader);
+        header.count = count;
+        header.gameBuildHash = gameBuildHash;
+        header.savedUnixMicros = savedUnixMicros;
+        if (name) {
+            strncpy(header.name, name, sizeof(header.name) - 1);
+        }
+
+        out.resize(FileSize(count));
+        uint8_t* p = out.data();
+        memcpy(p, &header, sizeof(header));
+        p += sizeof(header);
+        memcpy(p, ids, (size_t)count * sizeof(int32_t));
+        p += (size_t)count * sizeof(int32_t);
+        memcpy(p, values, (size_t)count * sizeof(uint32_t));
+        p += (size_t)count * sizeof(uint32_t);
+        memcpy(p, types, count);
+    }
+
+} // namespace TweakablePresetFormat
@@ -0,0 +1,251 @@
+// tweakable_presets.cpp
+// Binary DevMenu presets: save, memory-mapped load, and one-frame batch apply
+#include "pch.h"
+#include "tweakable_presets.h"
+#include "tweakable_preset_format.h"
+#include "devMenu.h"
+#include "devMenuSync.h"
+#include "game_thread.h"
+#include "keybindings.h"
+#include "logging.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace TweakablePresets {
+
+    // A read-only view of a preset file, kept open while a slot is in use
+    struct MappedFile {
+        HANDLE file = INVALID_HANDLE_VALUE;
+        HANDLE mapping = NULL;
+        const void* data = nullptr;
+        size_t size = 0;
+        TweakablePresetFormat::View view;
+    };
+
+    static std::mutex s_slotMutex;                      // Slots are applied from the hotkey thread
+    static MappedFile s_slots[SLOT_COUNT];
+    static std::atomic<int> s_activeSlot{ -1 };
+
+    static const Keybindings::Action SLOT_ACTIONS[SLOT_COUNT] = {
+        Keybindings::Action::ApplyPreset1,
+        Keybindings::Action::ApplyPreset2,
+        Keybindings::Action::ApplyPreset3,
+        Keybindings::Action::ApplyPreset4,
+    };
+
+    static void UnmapFile(MappedFile& mapped) {
+        if (mapped.data) UnmapViewOfFile(mapped.data);
+        if (mapped.mapping) CloseHandle(mapped.mapping);
+        if (mapped.file != INVALID_HANDLE_VALUE) CloseHandle(mapped.file);
+        mapped = MappedFile();
+    }
+
+    // Map and validate; on failure everything is released again
+    static bool MapFile(const std::string& path, MappedFile& mapped) {
+        mapped.file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (mapped.file == INVALID_HANDLE_VALUE) {
+            LOG_WARNING("[Presets] Preset not found: " << path);
+            return false;
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(mapped.file, &size) || size.QuadPart == 0 || size.HighPart != 0) {
+            LOG_ERROR("[Presets] Unusable preset file: " << path);
+            UnmapFile(mapped);
+            return false;
+        }
+
+        mapped.mapping = CreateFileMappingA(mapped.file, NULL, PAGE_READONLY, 0, 0, NULL);
+        mapped.data = mapped.mapping ? MapViewOfFile(mapped.mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!mapped.data) {
+            LOG_ERROR("[Presets] Failed to map " << path << " (error " << GetLastError() << ")");
+            UnmapFile(mapped);
+            return false;
+        }
+        mapped.size = (size_t)size.QuadPart;
+
+        const char* error = TweakablePresetFormat::Parse(mapped.data, mapped.size, mapped.view);
+        if (error) {
+            LOG_ERROR("[Presets] " << path << ": " << error);
+            UnmapFile(mapped);
+            return false;
+        }
+        return true;
+    }
+
+    // Copy the preset out of the mapping here; the command resolves it against the registry on
+    // the render thread (the only one that touches the registry), sets the menu through the
+    // journal and has the game written in one batch
+    static bool QueueApply(TweakableRegistry& registry, const TweakablePresetFormat::View& view, const std::string& label) {
+        if (view.header->gameBuildHash != DevMenuSync::GetGameBuildHash()) {
+            LOG_WARNING("[Presets] " << label << " was saved from a different game build (0x" << std::hex
+                << view.header->gameBuildHash << ", running 0x" << DevMenuSync::GetGameBuildHash() << std::dec << ")");
+        }
+
+        std::vector<int32_t> ids(view.ids, view.ids + view.count);
+        std::vector<uint32_t> values(view.values, view.values + view.count);
+        std::vector<uint8_t> types(view.types, view.types + view.count);
+
+        // Runs before the journal's flush on the render thread, which writes the values to the
+        // game and records the whole preset as one undo step
+        TweakableRegistry* target = &registry;
+        GameThread::Post("ApplyPreset", [target, label, ids = std::move(ids), values = std::move(values), types = std::move(types)]() {
+            if (!g_DevMenu) return;
+            TweakableRegistry& registry = *target;
+            TweakableJournal& journal = g_DevMenu->GetJournal();
+
+            uint32_t applied = 0, unknown = 0, mismatched = 0, menuOnly = 0;
+            journal.BeginBatch(("Preset " + label).c_str());
+            for (size_t i = 0; i < ids.size(); i++) {
+                uint32_t slot = registry.FindSlot(ids[i]);
+                if (slot == TweakableRegistry::INVALID_SLOT) {
+                    unknown++;
+                    continue;
+                }
+                if ((uint8_t)registry.GetType(slot) != types[i]) {
+                    mismatched++;
+                    continue;
+                }
+                // Mod controls have listeners a preset can't drive; only game values are applied
+                if (!registry.GetGameValue(slot)) {
+                    menuOnly++;
+                    continue;
+                }
+                TweakableValue value;
+                value.i = (int32_t)values[i];
+                journal.Set(slot, value);
+                applied++;
+            }
+            journal.EndBatch();
+
+            if (unknown || mismatched || menuOnly) {
+                LOG_VERBOSE("[Presets] " << label << ": skipped " << unknown << " unknown, " << mismatched << " retyped and "
+                    << menuOnly << " menu-only ids");
+            }
+            LOG_INFO("[Presets] Applied " << label << ": " << applied << " values");
+        });
+        return true;
+    }
+
+    bool Save(const TweakableRegistry& registry, const std::string& path, const char* name) {
+        // Values of slots backed by game memory only, sorted by id
+        std::vector<std::pair<int, uint32_t>> entries;
+        for (uint32_t slot = 0, count = registry.GetCount(); slot < count; slot++) {
+            if (!registry.GetGameValue(slot)) continue;
+            TweakableType type = registry.GetType(slot);
+            if (type == TweakableType::Float || type == TweakableType::Int || type == TweakableType::Bool) {
+                entries.push_back(std::make_pair(registry.GetId(slot), slot));
+            }
+        }
+        std::sort(entries.begin(), entries.end());
+
+        uint32_t count = (uint32_t)entries.size();
+        std::vector<int32_t> ids(count);
+        std::vector<uint32_t> values(count);
+        std::vector<uint8_t> types(count);
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t slot = entries[i].second;
+            ids[i] = entries[i].first;
+            values[i] = (uint32_t)registry.GetValue(slot).i;
+            types[i] = (uint8_t)registry.GetType(slot);
+        }
+
+        uint64_t savedUnixMicros = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        std::vector<uint8_t> data;
+        TweakablePresetFormat::Encode(data, DevMenuSync::GetGameBuildHash(), savedUnixMicros, name,
+            ids.data(), values.data(), types.data(), count);
+
+        // Write beside the target and swap it in, so a reader never sees half a file
+        std::string tempPath = path + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                LOG_ERROR("[Presets] Failed to open file for saving: " << tempPath);
+                return false;
+            }
+            file.write((const char*)data.data(), data.size());
+            if (!file) {
+                LOG_ERROR("[Presets] Failed to write " << tempPath);
+                return false;
+            }
+        }
+        if (!MoveFileExA(tempPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING)) {
+            LOG_ERROR("[Presets] Failed to replace " << path << " (error " << GetLastError() << ")");
+            DeleteFileA(tempPath.c_str());
+            return false;
+        }
+
+        LOG_INFO("[Presets] Saved " << count << " values to " << path);
+        return true;
+    }
+
+    bool Apply(TweakableRegistry& registry, const std::string& path) {
+        MappedFile mapped;
+        if (!MapFile(path, mapped)) return false;
+        bool queued = QueueApply(registry, mapped.view, path);
+        UnmapFile(mapped);
+        return queued;
+    }
+
+    std::string GetSlotPath(int slot) {
+        return "devmenu_preset_" + std::to_string(slot + 1) + ".tfpreset";
+    }
+
+    bool HasSlot(int slot) {
+        if (slot < 0 || slot >= SLOT_COUNT) return false;
+        return GetFileAttributesA(GetSlotPath(slot).c_str()) != INVALID_FILE_ATTRIBUTES;
+    }
+
+    bool SaveSlot(const TweakableRegistry& registry, int slot) {
+        if (slot < 0 || slot >= SLOT_COUNT) return false;
+
+        // A mapped file can't be replaced; the next apply maps the new one
+        std::lock_guard<std::mutex> lock(s_slotMutex);
+        UnmapFile(s_slots[slot]);
+        return Save(registry, GetSlotPath(slot), ("Preset " + std::to_string(slot + 1)).c_str());
+    }
+
+    bool ApplySlot(TweakableRegistry& registry, int slot) {
+        if (slot < 0 || slot >= SLOT_COUNT) return false;
+
+        std::lock_guard<std::mutex> lock(s_slotMutex);
+        MappedFile& mapped = s_slots[slot];
+        if (!mapped.data && !MapFile(GetSlotPath(slot), mapped)) return false;
+
+        if (!QueueApply(registry, mapped.view, "preset " + std::to_string(slot + 1))) return false;
+        s_activeSlot = slot;
+        return true;
+    }
+
+    int GetActiveSlot() {
+        return s_activeSlot;
+    }
+
+    void CheckHotkey() {
+        if (!g_DevMenu) {
+            return;
+        }
+
+        for (int slot = 0; slot < SLOT_COUNT; slot++) {
+            if (Keybindings::IsActionPressed(SLOT_ACTIONS[slot])) {
+                std::string keyName = Keybindings::GetKeyName(Keybindings::GetKey(SLOT_ACTIONS[slot]));
+                LOG_VERBOSE("[Presets] '" << keyName << "' key pressed - applying preset " << (slot + 1));
+                ApplySlot(g_DevMenu->GetRegistry(), slot);
+            }
+        }
+    }
+
+    void Shutdown() {
+        std::lock_guard<std::mutex> lock(s_slotMutex);
+        for (int slot = 0; slot < SLOT_COUNT; slot++) {
+            UnmapFile(s_slots[slot]);
+        }
+        s_activeSlot = -1;
+    }
+}
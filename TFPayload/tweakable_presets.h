@@ -0,0 +1,37 @@
+#pragma once
+#include "tweakable_registry.h"
+#include <cstdint>
+#include <string>
+
+// Binary tweakable presets (.tfpreset, see tweakable_preset_format.h)
+// Save() writes every value backed by game memory, sorted by id (mod controls are left out).
+// Apply() maps the file read-only, copies it out and posts a single GameThread command that
+// resolves it against the registry and sets the values through the DevMenu journal, which
+// writes them to the game in one batch at the next frame boundary as a single undo step.
+// Preset slots stay mapped after first use and are bound to hotkeys for quick A/B switching.
+
+namespace TweakablePresets {
+
+    const int SLOT_COUNT = 4;
+
+    // Render thread (reads the menu values)
+    bool Save(const TweakableRegistry& registry, const std::string& path, const char* name);
+
+    // Any thread - queues the preset for the next frame; false if it can't be mapped or parsed
+    bool Apply(TweakableRegistry& registry, const std::string& path);
+
+    // Numbered slots (0 .. SLOT_COUNT - 1)
+    std::string GetSlotPath(int slot);
+    bool HasSlot(int slot);
+    bool SaveSlot(const TweakableRegistry& registry, int slot);
+    bool ApplySlot(TweakableRegistry& registry, int slot);
+
+    // Slot most recently queued by ApplySlot, -1 if none
+    int GetActiveSlot();
+
+    // Check for preset hotkeys (Numpad 1-4 by default)
+    void CheckHotkey();
+
+    // Unmap the slot files
+    void Shutdown();
+}
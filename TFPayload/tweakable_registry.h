@@ -0,0 +1,396 @@
+#pragma once
+#include "imgui/imgui.h"
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <vector>
+
+// Flat structure-of-arrays store behind DevMenu's tweakables
+// Slots are added depth first (the game's rows from TweakableTable, then DevMenu's mod folder
+// flattened from its TweakableItem objects), so every folder's contents are the contiguous slots
+// [folder + 1, end[folder]) and Render, SyncFromGame, SaveConfig and ResetAll are linear walks
+// over plain arrays. Ids map to slots through a dense table instead of a hash map.
+// A folder lists its direct children the first time it is opened; long runs of value rows
+// then go through ImGuiListClipper, so only the rows on screen are submitted.
+// An optional per-slot filter mask (TweakableSearchIndex) hides rows and expands folders.
+// Header-only, ImGui but no Windows, so tools/tweakable_registry_bench can build it.
+
+// Enum for tweakable types
+enum class TweakableType : uint8_t {
+    Float,
+    Int,
+    Bool,
+    Button,
+    Folder
+};
+
+class TweakableRegistry;
+
+// Called on the render thread when the user edits or clicks a slot
+class TweakableListener {
+public:
+    virtual ~TweakableListener() {}
+    virtual void OnTweakableChanged(TweakableRegistry& registry, uint32_t slot) = 0;
+};
+
+union TweakableValue {
+    float f;
+    int32_t i;
+
+    TweakableValue() = default;
+    constexpr explicit TweakableValue(float value) : f(value) {}
+    constexpr explicit TweakableValue(int32_t value) : i(value) {}
+
+    static TweakableValue Float(float value) { return TweakableValue(value); }
+    static TweakableValue Int(int32_t value) { return TweakableValue(value); }
+};
+
+class TweakableRegistry {
+public:
+    static const uint32_t INVALID_SLOT = 0xFFFFFFFF;
+
+    // Consecutive value rows in an open folder beyond this are clipped to the visible ones
+    static const uint32_t CLIP_MIN_ROWS = 8;
+
+    enum Flags : uint8_t {
+        FLAG_OPEN = 1 << 0                      // Folder was expanded last frame
+    };
+
+    // Per-slot filter mask values (see SetFilter)
+    enum FilterState : uint8_t {
+        FILTER_HIDDEN = 0,
+        FILTER_SHOWN = 1,                       // Drawn as usual
+        FILTER_EXPAND = 2                       // Folder on the way to a match, forced open
+    };
+
+    // ========================================================================
+    // Building (depth-first: a folder's children are added right after it)
+    // ========================================================================
+
+    void Clear() {
+        m_type.clear(); m_flags.clear(); m_id.clear(); m_parent.clear(); m_end.clear();
+        m_value.clear(); m_default.clear(); m_min.clear(); m_max.clear();
+        m_nameOffset.clear(); m_listener.clear(); m_gameValue.clear();
+        m_names.clear(); m_slotById.clear();
+        m_childOffset.clear(); m_childCount.clear(); m_children.clear();
+        m_filter = nullptr;
+        m_menuEnd = 0;
+    }
+
+    // Size the arrays up front so a known menu is added without reallocating
+    void Reserve(uint32_t slots, size_t nameBytes, int maxId) {
+        m_type.reserve(slots); m_flags.reserve(slots); m_id.reserve(slots); m_parent.reserve(slots);
+        m_end.reserve(slots); m_value.reserve(slots); m_default.reserve(slots); m_min.reserve(slots);
+        m_max.reserve(slots); m_nameOffset.reserve(slots); m_listener.reserve(slots); m_gameValue.reserve(slots);
+        m_childOffset.reserve(slots); m_childCount.reserve(slots);
+        m_children.reserve(slots);              // Every slot is some folder's child at most once
+        m_names.reserve(nameBytes);
+        if (maxId >= 0 && (size_t)maxId >= m_slotById.size()) m_slotById.resize((size_t)maxId + 1, uint32_t(INVALID_SLOT));
+    }
+
+    uint32_t Add(int id, TweakableType type, const char* name, uint32_t parent,
+                 TweakableValue value, TweakableValue minValue, TweakableValue maxValue,
+                 TweakableListener* listener, uint8_t flags = 0) {
+        uint32_t slot = (uint32_t)m_type.size();
+        m_type.push_back(type);
+        m_flags.push_back(flags);
+        m_id.push_back(id);
+        m_parent.push_back(parent);
+        m_end.push_back(slot + 1);
+        m_value.push_back(value);
+        m_default.push_back(value);
+        m_min.push_back(minValue);
+        m_max.push_back(maxValue);
+        m_nameOffset.push_back(AppendName(name));
+        m_listener.push_back(listener);
+        m_gameValue.push_back(nullptr);
+        m_childOffset.push_back(uint32_t(INVALID_SLOT));
+        m_childCount.push_back(0);
+
+        if (id >= 0) {
+            if ((size_t)id >= m_slotById.size()) m_slotById.resize((size_t)id + 1, uint32_t(INVALID_SLOT));
+            m_slotById[id] = slot;
+        }
+        return slot;
+    }
+
+    // Call after the folder's last descendant has been added
+    void EndFolder(uint32_t folder) { m_end[folder] = (uint32_t)m_type.size(); }
+
+    // Slots below this are rendered; hidden slots (config-only values) follow it
+    void EndMenu() { m_menuEnd = (uint32_t)m_type.size(); }
+
+    // ========================================================================
+    // Access
+    // ========================================================================
+
+    uint32_t GetCount() const { return (uint32_t)m_type.size(); }
+    uint32_t GetMenuEnd() const { return m_menuEnd; }
+
+    uint32_t FindSlot(int id) const {
+        return (id >= 0 && (size_t)id < m_slotById.size()) ? m_slotById[id] : INVALID_SLOT;
+    }
+
+    TweakableType GetType(uint32_t slot) const { return m_type[slot]; }
+    int GetId(uint32_t slot) const { return m_id[slot]; }
+    uint32_t GetParent(uint32_t slot) const { return m_parent[slot]; }
+    uint32_t GetEnd(uint32_t slot) const { return m_end[slot]; }
+    const char* GetName(uint32_t slot) const { return m_names.data() + m_nameOffset[slot]; }
+    bool IsOpen(uint32_t slot) const { return (m_flags[slot] & FLAG_OPEN) != 0; }
+
+    bool IsDefault(uint32_t slot) const {
+        return m_type[slot] == TweakableType::Float ? m_value[slot].f == m_default[slot].f
+                                                    : m_value[slot].i == m_default[slot].i;
+    }
+
+    TweakableValue GetValue(uint32_t slot) const { return m_value[slot]; }
+    TweakableValue GetDefault(uint32_t slot) const { return m_default[slot]; }
+    void SetValue(uint32_t slot, TweakableValue value) { m_value[slot] = value; }
+
+    float GetFloat(uint32_t slot) const { return m_value[slot].f; }
+    int GetInt(uint32_t slot) const { return m_value[slot].i; }
+    bool GetBool(uint32_t slot) const { return m_value[slot].i != 0; }
+
+    void SetFloat(uint32_t slot, float value) { m_value[slot].f = value; }
+    void SetInt(uint32_t slot, int value) { m_value[slot].i = value; }
+    void SetBool(uint32_t slot, bool value) { m_value[slot].i = value ? 1 : 0; }
+    void SetOpen(uint32_t slot, bool open) {
+        m_flags[slot] = open ? (m_flags[slot] | FLAG_OPEN) : (m_flags[slot] & ~FLAG_OPEN);
+    }
+
+    void SetRange(uint32_t slot, TweakableValue minValue, TweakableValue maxValue) {
+        m_min[slot] = minValue;
+        m_max[slot] = maxValue;
+    }
+
+    // Renames append to the pool (only button labels change, and rarely)
+    void SetName(uint32_t slot, const char* name) { m_nameOffset[slot] = AppendName(name); }
+
+    // Address of the value in game memory (DevMenuSync), nullptr if not synced
+    TweakableListener* GetListener(uint32_t slot) const { return m_listener[slot]; }
+    void* GetGameValue(uint32_t slot) const { return m_gameValue[slot]; }
+    void SetGameValue(uint32_t slot, void* address) { m_gameValue[slot] = address; }
+
+    // Filter mask with one FilterState per rendered slot, owned by the caller; nullptr shows everything
+    void SetFilter(const uint8_t* states) { m_filter = states; }
+
+    // ========================================================================
+    // Whole-registry passes
+    // ========================================================================
+
+    // Values back to their defaults, without notifying listeners (as TweakableItem::Reset did)
+    void ResetAll() {
+        for (uint32_t slot = 0, count = GetCount(); slot < count; slot++) {
+            m_value[slot] = m_default[slot];
+        }
+    }
+
+    // "id value" per line for every float/int/bool slot (the text config DevMenu used before presets)
+    void WriteConfig(std::ostream& out) const {
+        for (uint32_t slot = 0, count = GetCount(); slot < count; slot++) {
+            switch (m_type[slot]) {
+            case TweakableType::Float: out << m_id[slot] << " " << m_value[slot].f << "\n"; break;
+            case TweakableType::Int:   out << m_id[slot] << " " << m_value[slot].i << "\n"; break;
+            case TweakableType::Bool:  out << m_id[slot] << " " << (m_value[slot].i ? 1 : 0) << "\n"; break;
+            default: break;
+            }
+        }
+    }
+
+    // ========================================================================
+    // ImGui
+    // ========================================================================
+
+    // Render one slot (and, for an open folder, its contents); returns the next sibling slot
+    uint32_t Render(uint32_t slot) {
+        switch (m_type[slot]) {
+        case TweakableType::Folder: RenderFolder(slot); return m_end[slot];
+        case TweakableType::Float:  RenderFloat(slot); break;
+        case TweakableType::Int:    RenderInt(slot); break;
+        case TweakableType::Bool:   RenderBool(slot); break;
+        case TweakableType::Button: RenderButton(slot); break;
+        }
+        return slot + 1;
+    }
+
+private:
+    uint32_t AppendName(const char* name) {
+        uint32_t offset = (uint32_t)m_names.size();
+        m_names.insert(m_names.end(), name, name + strlen(name) + 1);
+        return offset;
+    }
+
+    void Notify(uint32_t slot) {
+        if (m_listener[slot]) m_listener[slot]->OnTweakableChanged(*this, slot);
+    }
+
+    // Direct children of a folder, appended to m_children on first open (structure never
+    // changes after building, so the list stays valid until Clear)
+    void BuildChildren(uint32_t folder) {
+        m_childOffset[folder] = (uint32_t)m_children.size();
+        uint32_t count = 0;
+        for (uint32_t child = folder + 1; child < m_end[folder]; child = m_end[child]) {
+            m_children.push_back(child);
+            count++;
+        }
+        m_childCount[folder] = count;
+    }
+
+    void RenderFolder(uint32_t slot) {
+        if (m_filter && m_filter[slot] == FILTER_EXPAND) ImGui::SetNextItemOpen(true);
+        ImGuiTreeNodeFlags flags = IsOpen(slot) ? ImGuiTreeNodeFlags_DefaultOpen : ImGuiTreeNodeFlags_None;
+        if (ImGui::TreeNodeEx((void*)(intptr_t)m_id[slot], flags, "%s", GetName(slot))) {
+            SetOpen(slot, true);
+            if (m_childOffset[slot] == INVALID_SLOT) BuildChildren(slot);
+            RenderChildren(m_childOffset[slot], m_childCount[slot]);
+            ImGui::TreePop();
+        } else {
+            SetOpen(slot, false);
+        }
+    }
+
+    // Folders are drawn in place; runs of value rows (all one frame high) are clipped when long.
+    // Indexes m_children by offset because opening a subfolder may grow it.
+    // Filtered, only the shown rows are drawn (few, so without the clipper).
+    void RenderChildren(uint32_t offset, uint32_t count) {
+        if (m_filter) {
+            for (uint32_t i = 0; i < count; i++) {
+                uint32_t child = m_children[offset + i];
+                if (m_filter[child] != FILTER_HIDDEN) Render(child);
+            }
+            return;
+        }
+
+        uint32_t i = 0;
+        while (i < count) {
+            uint32_t child = m_children[offset + i];
+            if (m_type[child] == TweakableType::Folder) {
+                RenderFolder(child);
+                i++;
+                continue;
+            }
+
+            uint32_t runEnd = i;
+            while (runEnd < count && m_type[m_children[offset + runEnd]] != TweakableType::Folder) runEnd++;
+
+            if (runEnd - i < CLIP_MIN_ROWS) {
+                for (; i < runEnd; i++) Render(m_children[offset + i]);
+                continue;
+            }
+
+            uint32_t runStart = offset + i;
+            ImGuiListClipper clipper;
+            clipper.Begin((int)(runEnd - i), ImGui::GetFrameHeightWithSpacing());
+            while (clipper.Step()) {
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+                    Render(m_children[runStart + row]);
+                }
+            }
+            i = runEnd;
+        }
+    }
+
+    // Reset button (value differs from default) and right-click manual input, shared by float/int
+    template <typename InputFn>
+    void RenderValueExtras(uint32_t slot, InputFn input) {
+        if (!IsDefault(slot)) {
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Reset")) {
+                m_value[slot] = m_default[slot];
+                Notify(slot);
+            }
+        }
+
+        if (ImGui::IsItemClicked(1)) {
+            ImGui::OpenPopup("Input");
+        }
+        if (ImGui::BeginPopup("Input")) {
+            ImGui::Text("Enter value:");
+            if (input()) {
+                Notify(slot);
+                ImGui::CloseCurrentPopup();
+            }
+            ImGui::EndPopup();
+        }
+    }
+
+    void RenderFloat(uint32_t slot) {
+        ImGui::PushID(m_id[slot]);
+        ImGui::PushItemWidth(200.0f);
+        if (ImGui::SliderFloat("##value", &m_value[slot].f, m_min[slot].f, m_max[slot].f, "%.3f")) {
+            Notify(slot);
+        }
+        ImGui::PopItemWidth();
+        ImGui::SameLine();
+        ImGui::TextUnformatted(GetName(slot));
+        RenderValueExtras(slot, [&]() {
+            return ImGui::InputFloat("##input", &m_value[slot].f, 0.0f, 0.0f, "%.3f", ImGuiInputTextFlags_EnterReturnsTrue);
+        });
+        ImGui::PopID();
+    }
+
+    void RenderInt(uint32_t slot) {
+        ImGui::PushID(m_id[slot]);
+        ImGui::PushItemWidth(200.0f);
+        if (ImGui::SliderInt("##value", &m_value[slot].i, m_min[slot].i, m_max[slot].i)) {
+            Notify(slot);
+        }
+        ImGui::PopItemWidth();
+        ImGui::SameLine();
+        ImGui::TextUnformatted(GetName(slot));
+        RenderValueExtras(slot, [&]() {
+            return ImGui::InputInt("##input", &m_value[slot].i, 1, 10, ImGuiInputTextFlags_EnterReturnsTrue);
+        });
+        ImGui::PopID();
+    }
+
+    void RenderBool(uint32_t slot) {
+        ImGui::PushID(m_id[slot]);
+        bool value = m_value[slot].i != 0;
+        if (ImGui::Checkbox(GetName(slot), &value)) {
+            m_value[slot].i = value ? 1 : 0;
+            Notify(slot);
+        }
+        if (!IsDefault(slot)) {
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Reset")) {
+                m_value[slot] = m_default[slot];
+                Notify(slot);
+            }
+        }
+        ImGui::PopID();
+    }
+
+    void RenderButton(uint32_t slot) {
+        ImGui::PushID(m_id[slot]);
+        if (ImGui::Button(GetName(slot))) {
+            Notify(slot);
+        }
+        ImGui::PopID();
+    }
+
+    // Hot: read by every pass
+    std::vector<TweakableType> m_type;
+    std::vector<uint8_t> m_flags;
+    std::vector<TweakableValue> m_value;
+    std::vector<TweakableValue> m_default;
+    std::vector<TweakableValue> m_min;
+    std::vector<TweakableValue> m_max;
+    std::vector<uint32_t> m_end;                // One past the last slot of a folder (slot + 1 otherwise)
+    std::vector<void*> m_gameValue;
+
+    // Warm: rendering and lookups
+    std::vector<int> m_id;
+    std::vector<uint32_t> m_parent;             // INVALID_SLOT for root folders
+    std::vector<uint32_t> m_nameOffset;         // Into m_names
+    std::vector<char> m_names;                  // NUL-terminated names, back to back
+    std::vector<TweakableListener*> m_listener;
+    std::vector<uint32_t> m_slotById;           // Dense, indexed by tweakable id
+
+    // Lazy: per-folder direct child lists, built on first open
+    std::vector<uint32_t> m_childOffset;        // Into m_children, INVALID_SLOT until built
+    std::vector<uint32_t> m_childCount;
+    std::vector<uint32_t> m_children;
+    const uint8_t* m_filter = nullptr;
+    uint32_t m_menuEnd = 0;
+};
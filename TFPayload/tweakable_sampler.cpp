@@ -0,0 +1,232 @@
+// tweakable_sampler.cpp
+// Per-frame ring buffers of selected tweakable values and frame time
+#include "pch.h"
+#include "tweakable_sampler.h"
+#include "logging.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
+namespace TweakableSampler {
+
+    static Channel s_channels[MAX_CHANNELS];
+    static const void* s_addresses[MAX_CHANNELS];       // Packed for the read loop; nullptr once a read faulted
+    static uint32_t s_raw[MAX_CHANNELS];                // Last value read per channel
+    static float s_samples[MAX_CHANNELS][HISTORY];
+    static int s_channelCount = 0;
+
+    static float s_frameMs[HISTORY];
+    static double s_time[HISTORY];                      // Seconds since the first sample
+    static int s_head = 0;                              // Next write position
+    static int s_count = 0;
+
+    static LARGE_INTEGER s_frequency = {};
+    static LARGE_INTEGER s_startTicks = {};
+    static LARGE_INTEGER s_lastTicks = {};
+    static bool s_paused = false;
+
+    // ============================================================================
+    // Channels
+    // ============================================================================
+
+    static int FindChannel(int id) {
+        for (int i = 0; i < s_channelCount; i++) {
+            if (s_channels[i].id == id) return i;
+        }
+        return -1;
+    }
+
+    bool AddChannel(const TweakableRegistry& registry, int id) {
+        if (FindChannel(id) >= 0) return true;
+        if (s_channelCount >= MAX_CHANNELS) {
+            LOG_WARNING("[Sampler] All " << MAX_CHANNELS << " channels in use, not sampling " << id);
+            return false;
+        }
+
+        uint32_t slot = registry.FindSlot(id);
+        if (slot == TweakableRegistry::INVALID_SLOT) {
+            LOG_WARNING("[Sampler] Unknown tweakable id " << id);
+            return false;
+        }
+        TweakableType type = registry.GetType(slot);
+        if (type != TweakableType::Float && type != TweakableType::Int && type != TweakableType::Bool) {
+            LOG_WARNING("[Sampler] " << registry.GetName(slot) << " (" << id << ") has no value to sample");
+            return false;
+        }
+        const void* address = registry.GetGameValue(slot);
+        if (!address) {
+            LOG_WARNING("[Sampler] " << registry.GetName(slot) << " (" << id << ") is not synced with the game");
+            return false;
+        }
+
+        int index = s_channelCount++;
+        Channel& channel = s_channels[index];
+        channel.id = id;
+        channel.slot = slot;
+        channel.address = address;
+        channel.type = type;
+        channel.faulted = false;
+        s_addresses[index] = address;
+
+        // Older frames predate the channel; show them as its current menu value rather than garbage
+        TweakableValue value = registry.GetValue(slot);
+        s_raw[index] = (uint32_t)value.i;
+        float initial = type == TweakableType::Float ? value.f : (float)value.i;
+        std::fill(s_samples[index], s_samples[index] + HISTORY, initial);
+        channel.minValue = channel.maxValue = initial;
+
+        LOG_VERBOSE("[Sampler] Sampling " << registry.GetName(slot) << " (" << id << ") at " << address);
+        return true;
+    }
+
+    void RemoveChannel(int id) {
+        int index = FindChannel(id);
+        if (index < 0) return;
+
+        // Keep the remaining channels in the order they were added
+        int tail = s_channelCount - index - 1;
+        memmove(&s_channels[index], &s_channels[index + 1], tail * sizeof(Channel));
+        memmove(&s_addresses[index], &s_addresses[index + 1], tail * sizeof(const void*));
+        memmove(&s_raw[index], &s_raw[index + 1], tail * sizeof(uint32_t));
+        memmove(s_samples[index], s_samples[index + 1], tail * sizeof(s_samples[0]));
+        s_channelCount--;
+        if (s_channelCount == 0) {
+            s_lastTicks.QuadPart = 0;           // Sample() stops here - don't record the gap as one long frame
+        }
+    }
+
+    bool IsSampling(int id) {
+        return FindChannel(id) >= 0;
+    }
+
+    void Clear() {
+        s_channelCount = 0;
+        ResetHistory();
+    }
+
+    void ResetHistory() {
+        int last = s_count ? (s_head + HISTORY - 1) % HISTORY : 0;
+        for (int i = 0; i < s_channelCount; i++) {
+            float value = s_samples[i][last];
+            std::fill(s_samples[i], s_samples[i] + HISTORY, value);
+            s_channels[i].minValue = s_channels[i].maxValue = value;
+        }
+        s_head = 0;
+        s_count = 0;
+        s_lastTicks.QuadPart = 0;
+    }
+
+    void SetPaused(bool paused) {
+        s_paused = paused;
+        s_lastTicks.QuadPart = 0;               // Don't record the pause as one long frame
+    }
+
+    bool IsPaused() {
+        return s_paused;
+    }
+
+    // ============================================================================
+    // Sampling
+    // ============================================================================
+
+    // Read channels [begin, count) into s_raw. Returns the index that faulted, or count.
+    // SEH only - no destructors here.
+    static int ReadRange(int begin, int count) {
+        volatile int i = begin;
+        __try {
+            for (; i < count; i++) {
+                const volatile uint32_t* address = (const volatile uint32_t*)s_addresses[i];
+                if (address) s_raw[i] = *address;
+            }
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER) {
+            return i;
+        }
+        return count;
+    }
+
+    void Sample() {
+        if (s_paused || s_channelCount == 0) return;
+
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        if (s_frequency.QuadPart == 0) {
+            QueryPerformanceFrequency(&s_frequency);
+        }
+        if (s_count == 0) {
+            s_startTicks = now;
+        }
+        float frameMs = s_lastTicks.QuadPart
+            ? (float)((now.QuadPart - s_lastTicks.QuadPart) * 1000.0 / s_frequency.QuadPart) : 0.0f;
+        s_lastTicks = now;
+
+        // Faulted channels stop being read and keep their last value
+        int begin = 0;
+        while ((begin = ReadRange(begin, s_channelCount)) < s_channelCount) {
+            Channel& channel = s_channels[begin];
+            LOG_WARNING("[Sampler] Read of tweakable " << channel.id << " at " << channel.address << " failed, holding last value");
+            channel.faulted = true;
+            s_addresses[begin] = nullptr;
+            begin++;
+        }
+
+        int head = s_head;
+        for (int i = 0; i < s_channelCount; i++) {
+            Channel& channel = s_channels[i];
+            float value;
+            if (channel.type == TweakableType::Float) {
+                memcpy(&value, &s_raw[i], sizeof(value));
+            } else {
+                value = (float)(int32_t)s_raw[i];
+            }
+            s_samples[i][head] = value;
+            if (value < channel.minValue) channel.minValue = value;
+            if (value > channel.maxValue) channel.maxValue = value;
+        }
+        s_frameMs[head] = frameMs;
+        s_time[head] = (double)(now.QuadPart - s_startTicks.QuadPart) / s_frequency.QuadPart;
+
+        s_head = (head + 1) % HISTORY;
+        if (s_count < HISTORY) s_count++;
+    }
+
+    // ============================================================================
+    // Access
+    // ============================================================================
+
+    int GetChannelCount() { return s_channelCount; }
+    const Channel& GetChannel(int index) { return s_channels[index]; }
+    const float* GetChannelSamples(int index) { return s_samples[index]; }
+    const float* GetFrameTimes() { return s_frameMs; }
+    int GetSampleCount() { return s_count; }
+    int GetRingOffset() { return (s_head - s_count + HISTORY) % HISTORY; }
+
+    bool ExportCsv(const TweakableRegistry& registry, const std::string& path) {
+        std::ofstream file(path, std::ios::trunc);
+        if (!file.is_open()) {
+            LOG_ERROR("[Sampler] Failed to open " << path);
+            return false;
+        }
+
+        file << "time_s,frame_ms";
+        for (int c = 0; c < s_channelCount; c++) {
+            file << "," << registry.GetName(s_channels[c].slot);
+        }
+        file << "\n";
+
+        file << std::setprecision(9);
+        int offset = GetRingOffset();
+        for (int i = 0; i < s_count; i++) {
+            int index = (offset + i) % HISTORY;
+            file << s_time[index] << "," << s_frameMs[index];
+            for (int c = 0; c < s_channelCount; c++) {
+                file << "," << s_samples[c][index];
+            }
+            file << "\n";
+        }
+
+        LOG_INFO("[Sampler] Exported " << s_count << " samples of " << s_channelCount << " tweakables to " << path);
+        return true;
+    }
+}
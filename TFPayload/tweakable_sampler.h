@@ -0,0 +1,53 @@
+#pragma once
+#include "tweakable_registry.h"
+#include <cstdint>
+#include <string>
+
+// Per-frame tweakable sampler
+// Records the game values of a few selected tweakables (through the DevMenuSync value
+// pointers) plus the frame time into fixed ring buffers, once per rendered frame.
+// Sampling costs one guarded read per channel and never allocates; the DevMenu plots the
+// rings and ExportCsv() dumps them on demand. Everything here runs on the render thread.
+
+namespace TweakableSampler {
+
+    const int MAX_CHANNELS = 16;
+    const int HISTORY = 1024;               // Samples kept per channel (~17s at 60 fps)
+
+    struct Channel {
+        int id;
+        uint32_t slot;
+        const void* address;                // Game memory, from the registry
+        TweakableType type;
+        bool faulted;                       // Address stopped being readable; channel holds its last value
+        float minValue;
+        float maxValue;
+    };
+
+    // Start sampling a synced Float/Int/Bool tweakable; false if unknown, unsynced or full
+    bool AddChannel(const TweakableRegistry& registry, int id);
+    void RemoveChannel(int id);
+    bool IsSampling(int id);
+
+    // Drop every channel, or only the recorded history
+    void Clear();
+    void ResetHistory();
+
+    void SetPaused(bool paused);
+    bool IsPaused();
+
+    // Once per frame from the render callback
+    void Sample();
+
+    // Recorded data. Ring index i is the i-th oldest sample at (GetRingOffset() + i) % HISTORY,
+    // which matches the values_offset argument of ImGui::PlotLines.
+    int GetChannelCount();
+    const Channel& GetChannel(int index);
+    const float* GetChannelSamples(int index);
+    const float* GetFrameTimes();           // Milliseconds since the previous sample
+    int GetSampleCount();
+    int GetRingOffset();
+
+    // Write "time_s,frame_ms,<name>..." rows, oldest first
+    bool ExportCsv(const TweakableRegistry& registry, const std::string& path);
+}
@@ -0,0 +1,206 @@
+#pragma once
+#include "tweakable_registry.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Search index for the DevMenu filter
+// Built once from the registry: every rendered slot gets a lowercased path
+// ("bikesound/gear1/maxrpm") and every trigram of that path a sorted posting list of slots.
+// A query starts from the rarest trigram's postings, or from the previous matches when the
+// new text contains the old (typing narrows), and confirms each candidate with a substring
+// test on its path. The result is a per-slot TweakableRegistry::FilterState mask: matches and
+// everything inside matching folders are shown, folders leading to a match are expanded.
+// Query() does not allocate: all buffers are sized in Build().
+// Header-only and Windows-free so tools/tweakable_search_bench can build it.
+
+class TweakableSearchIndex {
+public:
+    static const size_t MAX_QUERY = 255;
+
+    void Build(const TweakableRegistry& registry) {
+        uint32_t count = registry.GetMenuEnd();
+        m_pathOffset.assign(count, 0);
+        m_parent.resize(count);
+        m_end.resize(count);
+        m_paths.clear();
+        m_paths.reserve((size_t)count * 48);
+
+        // Paths: parents come before children, so each path extends an existing one
+        std::vector<uint64_t> pairs;                    // trigram << 32 | slot
+        pairs.reserve((size_t)count * 40);
+        for (uint32_t slot = 0; slot < count; slot++) {
+            uint32_t parent = registry.GetParent(slot);
+            m_parent[slot] = parent;
+            m_end[slot] = registry.GetEnd(slot);
+
+            uint32_t offset = (uint32_t)m_paths.size();
+            m_pathOffset[slot] = offset;
+            if (parent != TweakableRegistry::INVALID_SLOT) {
+                const char* parentPath = m_paths.data() + m_pathOffset[parent];
+                size_t parentLength = strlen(parentPath);
+                for (size_t i = 0; i < parentLength; i++) m_paths.push_back(m_paths[m_pathOffset[parent] + i]);
+                m_paths.push_back('/');
+            }
+            for (const char* c = registry.GetName(slot); *c; c++) m_paths.push_back(ToLower(*c));
+            m_paths.push_back('\0');
+
+            const char* path = m_paths.data() + offset;
+            size_t length = m_paths.size() - 1 - offset;
+            for (size_t i = 0; i + 3 <= length; i++) {
+                pairs.push_back(((uint64_t)Trigram(path + i) << 32) | slot);
+            }
+        }
+
+        // Postings: sorted by trigram, then slot, without duplicates
+        std::sort(pairs.begin(), pairs.end());
+        pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+        m_keys.clear();
+        m_postingOffset.clear();
+        m_postings.clear();
+        m_postings.reserve(pairs.size());
+        for (size_t i = 0; i < pairs.size(); i++) {
+            uint32_t key = (uint32_t)(pairs[i] >> 32);
+            if (m_keys.empty() || m_keys.back() != key) {
+                m_keys.push_back(key);
+                m_postingOffset.push_back((uint32_t)m_postings.size());
+            }
+            m_postings.push_back((uint32_t)pairs[i]);
+        }
+        m_postingOffset.push_back((uint32_t)m_postings.size());
+
+        m_states.assign(count, TweakableRegistry::FILTER_HIDDEN);
+        m_matches.clear();
+        m_matches.reserve(count);
+        m_query[0] = '\0';
+        m_queryLength = 0;
+        m_active = false;
+    }
+
+    // Filter to the slots whose path contains text (case-insensitive); empty text clears it
+    void Query(const char* text) {
+        char query[MAX_QUERY + 1];
+        size_t length = 0;
+        for (; text[length] && length < MAX_QUERY; length++) query[length] = ToLower(text[length]);
+        query[length] = '\0';
+
+        if (length == 0) {
+            m_active = false;
+            m_query[0] = '\0';
+            m_queryLength = 0;
+            m_matches.clear();
+            return;
+        }
+
+        // Typing more narrows: the new matches are a subset of the previous ones
+        bool narrowing = m_active && strstr(query, m_query) != nullptr;
+        if (narrowing) {
+            FilterMatches(query);
+        } else if (length >= 3) {
+            CollectFromPostings(query, length);
+        } else {
+            m_matches.clear();
+            for (uint32_t slot = 0, count = (uint32_t)m_pathOffset.size(); slot < count; slot++) {
+                if (strstr(m_paths.data() + m_pathOffset[slot], query)) m_matches.push_back(slot);
+            }
+        }
+
+        memcpy(m_query, query, length + 1);
+        m_queryLength = length;
+        m_active = true;
+        BuildStates();
+    }
+
+    bool IsActive() const { return m_active; }
+    uint32_t GetMatchCount() const { return (uint32_t)m_matches.size(); }
+
+    // Per-slot TweakableRegistry::FilterState, valid while IsActive()
+    const uint8_t* GetStates() const { return m_active ? m_states.data() : nullptr; }
+    bool IsVisible(uint32_t slot) const { return !m_active || m_states[slot] != TweakableRegistry::FILTER_HIDDEN; }
+
+    const char* GetPath(uint32_t slot) const { return m_paths.data() + m_pathOffset[slot]; }
+
+private:
+    static char ToLower(char c) { return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c; }
+
+    static uint32_t Trigram(const char* p) {
+        return ((uint32_t)(uint8_t)p[0] << 16) | ((uint32_t)(uint8_t)p[1] << 8) | (uint32_t)(uint8_t)p[2];
+    }
+
+    // Posting range for a trigram; empty if no path contains it
+    void FindPostings(uint32_t key, uint32_t& begin, uint32_t& end) const {
+        auto it = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+        if (it == m_keys.end() || *it != key) {
+            begin = end = 0;
+            return;
+        }
+        size_t index = it - m_keys.begin();
+        begin = m_postingOffset[index];
+        end = m_postingOffset[index + 1];
+    }
+
+    // Candidates from the query's rarest trigram, confirmed against the full path
+    void CollectFromPostings(const char* query, size_t length) {
+        m_matches.clear();
+        uint32_t bestBegin = 0, bestEnd = 0;
+        bool first = true;
+        for (size_t i = 0; i + 3 <= length; i++) {
+            uint32_t begin, end;
+            FindPostings(Trigram(query + i), begin, end);
+            if (begin == end) return;   // Some trigram appears nowhere
+            if (first || end - begin < bestEnd - bestBegin) {
+                bestBegin = begin;
+                bestEnd = end;
+                first = false;
+            }
+        }
+
+        for (uint32_t i = bestBegin; i < bestEnd; i++) {
+            uint32_t slot = m_postings[i];
+            if (strstr(m_paths.data() + m_pathOffset[slot], query)) m_matches.push_back(slot);
+        }
+    }
+
+    // Keep the previous matches that still contain the query (in place, order preserved)
+    void FilterMatches(const char* query) {
+        size_t kept = 0;
+        for (size_t i = 0; i < m_matches.size(); i++) {
+            uint32_t slot = m_matches[i];
+            if (strstr(m_paths.data() + m_pathOffset[slot], query)) m_matches[kept++] = slot;
+        }
+        m_matches.resize(kept);
+    }
+
+    // Matches (in slot order) show themselves and their contents and expand their ancestors
+    void BuildStates() {
+        std::fill(m_states.begin(), m_states.end(), (uint8_t)TweakableRegistry::FILTER_HIDDEN);
+        for (uint32_t slot : m_matches) {
+            if (m_states[slot] != TweakableRegistry::FILTER_HIDDEN) continue;   // Inside an earlier match
+            std::fill(m_states.begin() + slot, m_states.begin() + m_end[slot], (uint8_t)TweakableRegistry::FILTER_SHOWN);
+            for (uint32_t parent = m_parent[slot]; parent != TweakableRegistry::INVALID_SLOT; parent = m_parent[parent]) {
+                if (m_states[parent] != TweakableRegistry::FILTER_HIDDEN) break;
+                m_states[parent] = TweakableRegistry::FILTER_EXPAND;
+            }
+        }
+    }
+
+    // Per slot (rendered range only)
+    std::vector<uint32_t> m_pathOffset;         // Into m_paths
+    std::vector<uint32_t> m_parent;
+    std::vector<uint32_t> m_end;
+    std::vector<char> m_paths;                  // Lowercased, NUL-terminated
+
+    // Trigram postings (CSR): m_keys[i] owns m_postings[m_postingOffset[i], m_postingOffset[i + 1])
+    std::vector<uint32_t> m_keys;
+    std::vector<uint32_t> m_postingOffset;
+    std::vector<uint32_t> m_postings;
+
+    // Current query
+    std::vector<uint8_t> m_states;
+    std::vector<uint32_t> m_matches;            // Sorted slots
+    char m_query[MAX_QUERY + 1] = {};
+    size_t m_queryLength = 0;
+    bool m_active = false;
+};
@@ -0,0 +1,877 @@
+#pragma once
+#include "tweakable_registry.h"
+#include <cstddef>
+#include <cstdint>
+
+// The game's dev menu tweakables, as constant data
+// One row per tweakable: id (the game's tweakable id), parent folder id (0 for a root folder),
+// type, name, and default/min/max for values. Rows are depth first - every folder is followed
+// by its whole contents - so DevMenu::BuildRegistry materializes the registry in a single pass
+// with a stack of open folders; IsDepthFirst() checks that at compile time.
+// Mod-specific controls (DevMenu::InitializeMod) still build TweakableItem objects because
+// they carry custom callbacks.
+// Header-only and Windows-free so tools/tweakable_table_bench can time the materialization.
+
+namespace TweakableTable {
+
+    struct Definition {
+        uint16_t id;
+        uint16_t parent;                // Folder id, 0 = root
+        TweakableType type;
+        const char* name;
+        TweakableValue defaultValue;
+        TweakableValue minValue;
+        TweakableValue maxValue;
+    };
+
+    const int MAX_DEPTH = 8;
+
+    constexpr Definition Folder(uint16_t id, uint16_t parent, const char* name) {
+        return { id, parent, TweakableType::Folder, name, TweakableValue(0), TweakableValue(0), TweakableValue(0) };
+    }
+
+    constexpr Definition Float(uint16_t id, uint16_t parent, const char* name, float defaultValue, float minValue, float maxValue) {
+        return { id, parent, TweakableType::Float, name, TweakableValue(defaultValue), TweakableValue(minValue), TweakableValue(maxValue) };
+    }
+
+    constexpr Definition Int(uint16_t id, uint16_t parent, const char* name, int32_t defaultValue, int32_t minValue, int32_t maxValue) {
+        return { id, parent, TweakableType::Int, name, TweakableValue(defaultValue), TweakableValue(minValue), TweakableValue(maxValue) };
+    }
+
+    constexpr Definition Bool(uint16_t id, uint16_t parent, const char* name, bool defaultValue) {
+        return { id, parent, TweakableType::Bool, name, TweakableValue(defaultValue ? 1 : 0), TweakableValue(0), TweakableValue(1) };
+    }
+
+    // ========================================================================
+    // Definitions (root folders in menu order)
+    // ========================================================================
+
+    constexpr Definition DEFINITIONS[] = {
+        // BikeSound
+        Folder(1, 0, "BikeSound"),
+        Float(2, 1, "RpmIdle", 2000.0f, 0.0f, 15000.0f),
+        Float(3, 1, "RpmFull", 10000.0f, 0.0f, 20000.0f),
+        Folder(4, 1, "Gear1"),
+        Float(5, 4, "MaxRPM", 0.0f, 0.0f, 20000.0f),
+        Float(11, 4, "Min", 0.0f, 0.0f, 100.0f),
+        Float(12, 4, "Max", 10.0f, 0.0f, 100.0f),
+        Float(17, 4, "MedianRPM", 5000.0f, 0.0f, 15000.0f),
+        Float(20, 4, "ClutchSeek", 0.1f, 0.0f, 1.0f),
+        Float(23, 4, "RPMSeek", 0.1f, 0.0f, 1.0f),
+        Float(26, 4, "RPMSeekUpInAir", 0.2f, 0.0f, 1.0f),
+        Float(29, 4, "RPMSeekDownInAir", 0.1f, 0.0f, 1.0f),
+        Float(32, 4, "LoadSeek", 0.2f, 0.0f, 1.0f),
+        Float(35, 4, "ThrottleSeek", 0.25f, 0.0f, 1.0f),
+        Float(38, 4, "ExternalLoadAmount", 4.5f, 0.0f, 10.0f),
+        Float(41, 4, "InternalLoadAmount", 4.5f, 0.0f, 10.0f),
+        Float(44, 4, "ThrottleLoadAmount", 0.2f, 0.0f, 5.0f),
+        Float(47, 4, "ShiftNegativeLoadAmount", -0.5f, -5.0f, 5.0f),
+        Float(50, 4, "ThrottleRpmResponse", 1500.0f, 0.0f, 5000.0f),
+        Float(55, 4, "ExtraRPMInAir", 0.0f, 0.0f, 5000.0f),
+        Float(59, 4, "TractionSeekUp", 0.2f, 0.0f, 1.0f),
+        Float(62, 4, "TractionSeekDown", 0.2f, 0.0f, 1.0f),
+        Int(65, 4, "TractionFrames", 10, 0, 100),
+        Folder(6, 1, "Gear2"),
+        Float(7, 6, "MaxRPM", 0.0f, 0.0f, 20000.0f),
+        Float(13, 6, "Min", 10.0f, 0.0f, 100.0f),
+        Float(14, 6, "Max", 20.0f, 0.0f, 100.0f),
+        Float(18, 6, "MedianRPM", 5000.0f, 0.0f, 15000.0f),
+        Float(21, 6, "ClutchSeek", 0.1f, 0.0f, 1.0f),
+        Float(24, 6, "RPMSeek", 0.1f, 0.0f, 1.0f),
+        Float(27, 6, "RPMSeekUpInAir", 0.2f, 0.0f, 1.0f),
+        Float(30, 6, "RPMSeekDownInAir", 0.1f, 0.0f, 1.0f),
+        Float(33, 6, "LoadSeek", 0.2f, 0.0f, 1.0f),
+        Float(36, 6, "ThrottleSeek", 0.25f, 0.0f, 1.0f),
+        Float(39, 6, "ExternalLoadAmount", 4.5f, 0.0f, 10.0f),
+        Float(42, 6, "InternalLoadAmount", 4.5f, 0.0f, 10.0f),
+        Float(45, 6, "ThrottleLoadAmount", 0.2f, 0.0f, 5.0f),
+        Float(48, 6, "ShiftNegativeLoadAmount", -0.5f, -5.0f, 5.0f),
+        Float(51, 6, "ThrottleRpmResponse", 1500.0f, 0.0f, 5000.0f),
+        Float(56, 6, "ExtraRPMInAir", 0.0f, 0.0f, 5000.0f),
+        Float(60, 6, "TractionSeekUp", 0.2f, 0.0f, 1.0f),
+        Float(63, 6, "TractionSeekDown", 0.2f, 0.0f, 1.0f),
+        Int(66, 6, "TractionFrames", 10, 0, 100),
+        Folder(8, 1, "Gear3"),
+        Float(9, 8, "MaxRPM", 0.0f, 0.0f, 20000.0f),
+        Float(15, 8, "Min", 20.0f, 0.0f, 100.0f),
+        Float(16, 8, "Max", 30.0f, 0.0f, 100.0f),
+        Float(19, 8, "MedianRPM", 5000.0f, 0.0f, 15000.0f),
+        Float(22, 8, "ClutchSeek", 0.1f, 0.0f, 1.0f),
+        Float(25, 8, "RPMSeek", 0.1f, 0.0f, 1.0f),
+        Float(28, 8, "RPMSeekUpInAir", 0.2f, 0.0f, 1.0f),
+        Float(31, 8, "RPMSeekDownInAir", 0.1f, 0.0f, 1.0f),
+        Float(34, 8, "LoadSeek", 0.2f, 0.0f, 1.0f),
+        Float(37, 8, "ThrottleSeek", 0.25f, 0.0f, 1.0f),
+        Float(40, 8, "ExternalLoadAmount", 4.5f, 0.0f, 10.0f),
+        Float(43, 8, "InternalLoadAmount", 4.5f, 0.0f, 10.0f),
+        Float(46, 8, "ThrottleLoadAmount", 0.2f, 0.0f, 5.0f),
+        Float(49, 8, "ShiftNegativeLoadAmount", -0.5f, -5.0f, 5.0f),
+        Float(52, 8, "ThrottleRpmResponse", 1500.0f, 0.0f, 5000.0f),
+        Float(57, 8, "ExtraRPMInAir", 0.0f, 0.0f, 5000.0f),
+        Float(61, 8, "TractionSeekUp", 0.2f, 0.0f, 1.0f),
+        Float(64, 8, "TractionSeekDown", 0.2f, 0.0f, 1.0f),
+        Int(67, 8, "TractionFrames", 10, 0, 100),
+        Int(10, 1, "GearCount", 2, 1, 6),
+        Float(53, 1, "ShiftDuration", 0.5f, 0.0f, 2.0f),
+        Float(54, 1, "CameraDebugRadius", 0.0f, 0.0f, 10.0f),
+        Int(58, 1, "NumberOfFramesInAirRequired", 8, 0, 60),
+        Float(237, 1, "GainTire", 1.0f, 0.0f, 5.0f),
+        Float(238, 1, "GainEngine", 1.0f, 0.0f, 5.0f),
+        Float(239, 1, "GainWind", 1.0f, 0.0f, 5.0f),
+        Float(240, 1, "OverrideTireSpeed", 0.0f, 0.0f, 100.0f),
+        Bool(241, 1, "PrintTerrainSoundMaterial", false),
+        Bool(242, 1, "DebugFmod", true),
+        Int(254, 1, "skidSoundDelay", 16, 0, 100),
+        Int(255, 1, "bodyCollisionSoundDelay", 10, 0, 100),
+        Int(256, 1, "bikeCollisionSoundDelay", 16, 0, 100),
+        Int(257, 1, "wheelCollisionSoundDelay", 0, 0, 100),
+        Float(262, 1, "MinimumCollisionSoundForce", 0.5f, 0.0f, 20.0f),
+        Float(263, 1, "MaximumCollisionSoundForce", 8.5f, 0.0f, 50.0f),
+        Float(342, 1, "GainRolling", 1.0f, 0.0f, 5.0f),
+
+        // DynamicMusic
+        Folder(68, 0, "DynamicMusic"),
+        Float(69, 68, "Progress", 0.0f, 0.0f, 1.0f),
+        Float(70, 68, "MaxProgressAuto", 0.99f, 0.0f, 1.0f),
+        Float(71, 68, "LeftFront", 0.92f, 0.0f, 1.0f),
+        Float(72, 68, "RightFront", 0.92f, 0.0f, 1.0f),
+        Float(73, 68, "LeftRear", 0.68f, 0.0f, 1.0f),
+        Float(74, 68, "RightRear", 0.68f, 0.0f, 1.0f),
+        Float(75, 68, "LeftSide", 0.5f, 0.0f, 1.0f),
+        Float(76, 68, "RightSide", 0.5f, 0.0f, 1.0f),
+        Float(77, 68, "Center", 0.0f, 0.0f, 1.0f),
+        Float(78, 68, "LowFrequencyEmitter", 0.8f, 0.0f, 1.0f),
+
+        // ProgressionSystem
+        Folder(79, 0, "ProgressionSystem"),
+        Bool(80, 79, "AllBikesUnlocked", true),
+        Bool(344, 79, "FMXTricksUnlocked", true),
+        Bool(491, 79, "AllTracksUnlocked", true),
+
+        // Garage
+        Folder(81, 0, "Garage"),
+        Folder(82, 81, "Camera"),
+        Folder(83, 82, "Bike"),
+        Float(84, 83, "Shift", 1.04f, 0.0f, 10.0f),
+        Float(85, 83, "RotationShift", 1.97f, 0.0f, 10.0f),
+        Float(86, 83, "CameraRotX", 3.14159f, -10.0f, 10.0f),
+        Float(87, 83, "CameraRotY", 0.0f, -10.0f, 10.0f),
+        Float(88, 83, "ZoomOutDistance", -5.0f, -50.0f, 50.0f),
+        Float(89, 83, "ZoomOutHeight", 1.5f, -10.0f, 10.0f),
+        Float(90, 83, "ZoomOutShift", 1.0f, 0.0f, 10.0f),
+        Float(91, 83, "MinZoomCameraDistance", 1.6f, 0.0f, 20.0f),
+        Float(92, 83, "MaxZoomCameraDistance", 6.0f, 0.0f, 20.0f),
+        Float(93, 83, "CameraDistance", 3.0f, 0.0f, 20.0f),
+        Float(94, 83, "CameraRotationDistance", 4.5f, 0.0f, 20.0f),
+        Float(95, 83, "CameraHeight", 0.75f, -10.0f, 10.0f),
+        Folder(96, 82, "Rider"),
+        Float(97, 96, "Shift", 1.45f, 0.0f, 10.0f),
+        Float(98, 96, "Aspect4x3", 1.2f, 0.0f, 5.0f),
+        Float(99, 96, "ShiftHelmet", 0.3f, 0.0f, 5.0f),
+        Float(100, 96, "ShiftTop", 0.41f, 0.0f, 5.0f),
+        Float(101, 96, "ShiftBottom", 0.3f, 0.0f, 5.0f),
+        Float(102, 96, "RotationShift", 2.43f, 0.0f, 10.0f),
+        Float(103, 96, "RotationShiftHelmet", 0.52f, 0.0f, 5.0f),
+        Float(104, 96, "RotationShiftTop", 1.08f, 0.0f, 5.0f),
+        Float(105, 96, "RotationShiftBottom", 1.0f, 0.0f, 5.0f),
+        Float(106, 96, "CameraRotX", -1.78f, -10.0f, 10.0f),
+        Float(107, 96, "CameraRotY", 0.0f, -10.0f, 10.0f),
+        Float(108, 96, "ZoomOutDistance", -5.0f, -50.0f, 50.0f),
+        Float(109, 96, "ZoomOutHeight", 1.0f, -10.0f, 10.0f),
+        Float(110, 96, "ZoomOutShift", 2.2f, 0.0f, 10.0f),
+        Float(111, 96, "CameraDistance", 3.0f, 0.0f, 20.0f),
+        Float(112, 96, "CameraRotationDistance", 4.5f, 0.0f, 20.0f),
+        Float(113, 96, "CameraDistanceHelmet", 1.0f, 0.0f, 10.0f),
+        Float(114, 96, "CameraDistanceTop", 1.45f, 0.0f, 10.0f),
+        Float(115, 96, "CameraDistanceBottom", 1.4f, 0.0f, 10.0f),
+        Float(116, 96, "CameraRotationDistanceHelmet", 1.8f, 0.0f, 10.0f),
+        Float(117, 96, "CameraRotationDistanceTop", 2.5f, 0.0f, 10.0f),
+        Float(118, 96, "CameraRotationDistanceBottom", 2.5f, 0.0f, 10.0f),
+        Float(119, 96, "MinZoomCameraRotationDistance", 3.0f, 0.0f, 10.0f),
+        Float(120, 96, "MaxZoomCameraRotationDistance", 4.0f, 0.0f, 10.0f),
+        Float(121, 96, "MinZoomCameraRotationDistanceHelmet", 1.0f, 0.0f, 10.0f),
+        Float(122, 96, "MaxZoomCameraRotationDistanceHelmet", 1.8f, 0.0f, 10.0f),
+        Float(123, 96, "MinZoomCameraRotationDistanceTop", 1.2f, 0.0f, 10.0f),
+        Float(124, 96, "MaxZoomCameraRotationDistanceTop", 2.2f, 0.0f, 10.0f),
+        Float(125, 96, "MinZoomCameraRotationDistanceBottom", 1.2f, 0.0f, 10.0f),
+        Float(126, 96, "MaxZoomCameraRotationDistanceBottom", 2.2f, 0.0f, 10.0f),
+        Float(127, 96, "CameraHeight", 1.0f, -10.0f, 10.0f),
+        Float(128, 96, "CameraHeightHelmet", 0.02f, -5.0f, 5.0f),
+        Float(129, 96, "CameraHeightTop", 0.01f, -5.0f, 5.0f),
+        Float(130, 96, "CameraHeightBottom", -0.09f, -5.0f, 5.0f),
+        Float(480, 82, "Interpolation", 0.06f, 0.0f, 1.0f),
+        Float(481, 82, "RotationSpeed", 0.05f, 0.0f, 1.0f),
+        Float(482, 82, "RotationSpeedMouse", 0.25f, 0.0f, 2.0f),
+        Bool(470, 81, "DynamicDof", true),
+        Float(471, 81, "DofNearBlur", 0.1f, 0.0f, 5.0f),
+        Float(472, 81, "DofFarBlur", 1.5f, 0.0f, 10.0f),
+        Float(473, 81, "DofFarBlurStart", 0.0f, 0.0f, 50.0f),
+        Float(474, 81, "DofFarBlurEnd", 12.0f, 0.0f, 50.0f),
+        Float(475, 81, "LuminanceValue", 0.5f, 0.0f, 2.0f),
+        Float(476, 81, "LuminanceBlend", 0.5f, 0.0f, 1.0f),
+        Int(477, 81, "SunAngle", 10, 0, 360),
+        Int(478, 81, "SunIntensity", 255, 0, 255),
+        Int(479, 81, "Longitude", 50, 0, 360),
+        Folder(483, 81, "Lights"),
+        Float(484, 483, "BikeSpotIntensity", 20.0f, 0.0f, 100.0f),
+        Folder(485, 81, "Animation"),
+        Bool(486, 485, "UsePodiumAnimations", false),
+        Int(487, 485, "ActivePodiumAnimation", 1, 0, 10),
+
+        // ContentPack
+        Folder(131, 0, "ContentPack"),
+        Bool(132, 131, "Enable Advert events for content packs", true),
+        Bool(133, 131, "Owned", false),
+        Bool(134, 131, "Coming Soon", true),
+
+        // DLC
+        Folder(135, 0, "DLC"),
+        Bool(136, 135, "ConflictChecksEnabled", true),
+
+        // Editor
+        Folder(137, 0, "Editor"),
+        Bool(138, 137, "SaveLastUndo", true),
+        Bool(139, 137, "SaveTrackEnvironmentSettings", false),
+        Bool(140, 137, "PrintCurrentCameraLocation", true),
+        Folder(141, 137, "Features"),
+        Bool(142, 141, "EnableDrivingLineSplitting", true),
+        Bool(596, 141, "EnableDrivingLineEvent", true),
+        Float(149, 137, "FlipDirectionHeightAdjustment", 0.072f, 0.0f, 1.0f),
+        Int(274, 137, "FakeBikeAmount", 7, 0, 100),
+        Int(275, 137, "SimulatedDelayWithGhostsInEditor", 400, 0, 5000),
+        Bool(353, 137, "LoadHighEndLayer", true),
+        Float(369, 137, "CloudShadowTiling", 0.0025f, 0.0f, 1.0f),
+        Float(370, 137, "EdgeCollisionFactorMul", 1.0f, 0.0f, 10.0f),
+        Float(371, 137, "EdgeCollisionNormalPow", 0.2f, 0.0f, 5.0f),
+        Folder(597, 137, "Overlays"),
+        Int(598, 597, "MaxCount", 50, 0, 1000),
+        Int(599, 597, "MaxDistance", 50, 0, 1000),
+        Bool(600, 597, "DrawOverlayTexts", true),
+
+        // Multiplayer
+        Folder(143, 0, "Multiplayer"),
+        Bool(144, 143, "ShowMaxPodiumRiders", false),
+        Float(264, 143, "MP_BOOSTER_MAX_POWER", 300.0f, 0.0f, 1000.0f),
+        Bool(265, 143, "EnableSwitchFollowedPlayerWhileDriving", false),
+        Int(266, 143, "ResetCooldownTicks", 30, 0, 1000),
+        Int(267, 143, "FakeBikeTrialsDelayTicks", 3, 0, 100),
+        Int(276, 143, "HiddenRemoteBikeAmount", 0, 0, 100),
+        Int(277, 143, "RefreshRate", 17, 0, 120),
+        Int(278, 143, "TrialsDrivingLineAmount", 1, 0, 100),
+        Int(279, 143, "FollowedUpdateMinIntervalTicks", 120, 0, 1000),
+        Int(343, 143, "UpdateIngamePlayerList", 61, 0, 1000),
+        Bool(350, 143, "XCrossShowPodiumAfterEachTrack", false),
+        Float(433, 143, "FMXBoostForce", 500.0f, 0.0f, 2000.0f),
+        Float(434, 143, "FMXBoostLengthFactor", 0.00015f, 0.0f, 0.01f),
+        Bool(489, 143, "DisconnectOnOutOfSync", true),
+        Float(490, 143, "GhostFadeOutDistance", 25.0f, 0.0f, 200.0f),
+        Folder(571, 143, "ParameterDefaults"),
+        Int(572, 571, "HeatsPerRace", 2, 0, 20),
+        Bool(573, 571, "BailoutFinish", false),
+        Bool(574, 571, "FMXTricksEnabled", true),
+        Int(575, 571, "FMXTricksBoost", 0, 0, 100),
+        Bool(576, 571, "NoLean", false),
+        Bool(577, 571, "FullThrottle", false),
+        Bool(578, 571, "InvertControls", false),
+        Int(579, 571, "BikeSpeed", 100, 0, 500),
+        Int(580, 571, "Gravity", 100, 0, 500),
+        Bool(581, 571, "InvisibleRider", false),
+        Bool(582, 571, "InvisibleBike", false),
+        Bool(583, 571, "RemoveCheckpoints", false),
+        Int(584, 571, "EndingTimeLimit", 30, 0, 300),
+        Bool(585, 571, "BurningBike", false),
+        Int(586, 571, "WheelieMode", 0, 0, 10),
+        Int(587, 571, "Lives", 500, 0, 10000),
+        Bool(588, 571, "BaggieAllowed", false),
+        Bool(589, 571, "RoachAllowed", true),
+        Bool(590, 571, "PitViperAllowed", true),
+        Bool(591, 571, "FoxbatAllowed", true),
+        Bool(592, 571, "QuadAllowed", true),
+        Bool(593, 571, "BMXAllowed", true),
+        Bool(594, 571, "DonkeyAllowed", true),
+        Bool(595, 571, "UnicornAllowed", true),
+        Float(788, 143, "EstimationMinimumAdvance", 0.5f, 0.0f, 10.0f),
+        Float(789, 143, "RemoteInterpolationCap", 120.0f, 0.0f, 500.0f),
+        Float(790, 143, "DelayIncreaseDelay", 0.75f, 0.0f, 2.0f),
+        Float(791, 143, "DelayDecreaseDelay", 0.998f, 0.0f, 1.0f),
+
+        // Event
+        Folder(145, 0, "Event"),
+        Int(146, 145, "NetDelayHigh", 12, 0, 100),
+        Int(147, 145, "NetDelayMedium", 6, 0, 100),
+        Int(148, 145, "NetDelayLow", 1, 0, 100),
+
+        // FMX
+        Folder(150, 0, "FMX"),
+
+        // Bike
+        Folder(169, 0, "Bike"),
+        Bool(170, 169, "TuneEnabled", false),
+        Bool(171, 169, "newAccelerationEnabled", false),
+        Int(172, 169, "IdNumber", 3, 0, 10),
+        Folder(173, 169, "Engine"),
+        Float(174, 173, "AccelerationMultiplier", 1.0f, 0.0f, 5.0f),
+        Float(175, 173, "AccelerationSpeedDivisor", 1.0f, 0.0f, 5.0f),
+        Float(176, 173, "RpmSeekSpeedMul", 0.0107f, 0.0f, 1.0f),
+        Float(179, 173, "RpmMin", 1980.0f, 0.0f, 10000.0f),
+        Float(186, 173, "RpmMax", 8400.0f, 0.0f, 15000.0f),
+        Float(187, 173, "RpmMaxAdd", 600.0f, 0.0f, 2000.0f),
+        Float(188, 173, "RpmMul", 0.081f, 0.0f, 1.0f),
+        Float(189, 173, "RpmAccelCurrent", 0.991f, 0.0f, 1.0f),
+        Float(190, 173, "RpmDecelCurrent", 0.975f, 0.0f, 1.0f),
+        Float(191, 173, "RpmAccelTarget", 0.025f, 0.0f, 1.0f),
+        Float(192, 173, "RpmDecelTarget", 0.7f, 0.0f, 1.0f),
+        Folder(177, 169, "Transmission"),
+        Float(178, 177, "RpmClutch", 0.97f, 0.0f, 1.0f),
+        Float(180, 177, "RpmShiftDown", 6120.0f, 0.0f, 15000.0f),
+        Float(181, 177, "RpmGearDiv1", 1.99f, 0.0f, 10.0f),
+        Float(182, 177, "RpmGearDiv2", 2.46f, 0.0f, 10.0f),
+        Float(183, 177, "RpmGearDiv3", 2.56f, 0.0f, 10.0f),
+        Float(184, 177, "RpmGearDiv4", 2.66f, 0.0f, 10.0f),
+        Float(185, 177, "RpmGearDiv5", 3.0f, 0.0f, 10.0f),
+        Float(193, 177, "ShiftLoadReduce", 0.97f, 0.0f, 1.0f),
+        Folder(194, 169, "Properties"),
+        Float(195, 194, "AccelerationPower", 28.0f, 0.0f, 100.0f),
+        Float(196, 194, "AccelerationBrake", 27.0f, 0.0f, 100.0f),
+        Float(197, 194, "AccelerationForce", -0.25f, -10.0f, 10.0f),
+        Float(198, 194, "EngineDamping", 0.0f, 0.0f, 10.0f),
+        Float(199, 194, "MaximumVelocity", 20.0f, 0.0f, 100.0f),
+        Float(200, 194, "MassFactor", 1.0f, 0.0f, 10.0f),
+        Float(201, 194, "BrakePowerFront", 1.25f, 0.0f, 10.0f),
+        Float(207, 194, "BrakePowerBack", 1.25f, 0.0f, 10.0f),
+        Float(260, 194, "AccelerationPowerQuadMP", 28.0f, 0.0f, 100.0f),
+        Float(261, 194, "AccelerationBrakeQuadMP", 27.0f, 0.0f, 100.0f),
+        Float(268, 194, "UnicornWalkMultiplier", 1.0f, 0.0f, 10.0f),
+        Float(269, 194, "UnicornRunMultiplier", 0.4f, 0.0f, 10.0f),
+        Float(270, 194, "UnicornGallopMultiplier", 0.14f, 0.0f, 10.0f),
+        Float(271, 194, "UnicornRunSpeed", 42.0f, 0.0f, 200.0f),
+        Float(272, 194, "UnicornGallopSpeed", 125.0f, 0.0f, 300.0f),
+        Float(273, 194, "UnicornFireInitValue", 0.0f, 0.0f, 100.0f),
+        Folder(202, 169, "Suspension"),
+        Float(203, 202, "FrontSpringSoftness", 4000.0f, 0.0f, 20000.0f),
+        Float(204, 202, "FrontSpringDamping", 0.001f, 0.0f, 1.0f),
+        Float(205, 202, "FrontWheelSpringSoftness", 0.325f, 0.0f, 5.0f),
+        Float(206, 202, "FrontWheelSpringDamping", 0.2f, 0.0f, 5.0f),
+        Float(208, 202, "BackSpringSoftness", 4000.0f, 0.0f, 20000.0f),
+        Float(209, 202, "BackSpringDamping", 0.001f, 0.0f, 1.0f),
+        Float(210, 202, "BackWheelSpringSoftness", 0.2f, 0.0f, 5.0f),
+        Float(211, 202, "BackWheelSpringDamping", 0.3f, 0.0f, 5.0f),
+        Float(212, 202, "BackWheelSpring2Softness", 0.0f, 0.0f, 5.0f),
+        Float(213, 202, "BackWheelSpring2Damping", 1.0f, 0.0f, 5.0f),
+
+        // Rider
+        Folder(214, 0, "Rider"),
+        Bool(215, 214, "TuneEnabled", false),
+        Folder(216, 214, "Properties"),
+        Float(217, 216, "MassFactor", 1.0f, 0.0f, 10.0f),
+
+        // Vibra
+        Folder(243, 0, "Vibra"),
+        Float(244, 243, "BrakeToLT", 0.5f, 0.0f, 2.0f),
+        Float(245, 243, "LeftAndRightToLT", 1.09f, 0.0f, 5.0f),
+        Float(246, 243, "LoadToRT", 0.5f, 0.0f, 2.0f),
+        Float(247, 243, "LeftToRT", 1.35f, 0.0f, 5.0f),
+        Int(248, 243, "AirThreshold", 3, 0, 20),
+        Float(249, 243, "RTStartRPM", 0.0f, 0.0f, 1.0f),
+        Float(250, 243, "RTStartLoad", 0.59f, 0.0f, 2.0f),
+        Float(251, 243, "RTGasAddition", 0.0f, 0.0f, 2.0f),
+        Float(252, 243, "RTBackWheelStart", 0.2f, 0.0f, 2.0f),
+        Float(253, 243, "RTSlippingClutch", 0.2f, 0.0f, 2.0f),
+
+        // SoundSystem
+        Folder(258, 0, "SoundSystem"),
+        Float(259, 258, "freefallYellHeadVelocity", 10.0f, 0.0f, 50.0f),
+        Float(557, 258, "audioDuckingFadeStep", 0.0121f, 0.0f, 1.0f),
+        Float(558, 258, "audioDuckingFactor", 0.39f, 0.0f, 1.0f),
+        Int(559, 258, "audioDuckingExtraTicks", 10, 0, 100),
+        Bool(626, 258, "ForceSynchronousProcessing", false),
+        Int(627, 258, "MaxCommands", 400, 0, 2000),
+        Bool(628, 258, "PrintCommandName", true),
+
+        // Replay CRC check
+        Folder(280, 0, "Replay CRC check"),
+        Bool(281, 280, "active", false),
+
+        // Utils
+        Folder(282, 0, "Utils"),
+        Bool(283, 282, "ReplayCameraEnabled", true),
+        Bool(605, 282, "InGameCountersHidden", false),
+
+        // ReplayCamera
+        Folder(284, 0, "ReplayCamera"),
+        Folder(285, 284, "FollowCamera"),
+        Float(286, 285, "FOVSpeed", 30.0f, 0.0f, 100.0f),
+        Float(287, 285, "FOVMin", 20.0f, 0.0f, 180.0f),
+        Float(288, 285, "FOVMax", 90.0f, 0.0f, 180.0f),
+        Float(303, 285, "PanSpeed", 6.0f, 0.0f, 50.0f),
+        Float(304, 285, "PanMin", -5.0f, -50.0f, 50.0f),
+        Float(305, 285, "PanMax", 0.0f, -50.0f, 50.0f),
+        Float(306, 285, "DistanceSpeed", 10.0f, 0.0f, 100.0f),
+        Float(307, 285, "DistanceMin", 2.0f, 0.0f, 100.0f),
+        Float(308, 285, "DistanceMax", 50.0f, 0.0f, 200.0f),
+        Float(309, 285, "RollSpeed", 50.0f, 0.0f, 200.0f),
+        Float(310, 285, "HeightSpeed", 15.0f, 0.0f, 100.0f),
+        Float(311, 285, "HeightMin", -10.0f, -50.0f, 50.0f),
+        Float(312, 285, "HeightMax", 10.0f, -50.0f, 50.0f),
+        Float(313, 285, "OrbitSpeed", 180.0f, 0.0f, 360.0f),
+        Float(314, 285, "OrbitMin", -180.0f, -360.0f, 360.0f),
+        Float(315, 285, "OrbitMax", 180.0f, -360.0f, 360.0f),
+        Float(316, 285, "SensitivityX", -0.1f, -2.0f, 2.0f),
+        Float(317, 285, "SensitivityY", -0.1f, -2.0f, 2.0f),
+        Float(318, 285, "SensitivityZ", -0.1f, -2.0f, 2.0f),
+        Float(319, 285, "ApertureTime", 0.5f, 0.0f, 5.0f),
+        Float(320, 285, "FilmWidth", 0.1f, 0.0f, 5.0f),
+        Float(321, 285, "NearBlur", 0.5f, 0.0f, 10.0f),
+        Float(322, 285, "FarBlur", 50.0f, 0.0f, 200.0f),
+        Float(323, 285, "PositionInterpolation", 0.17f, 0.0f, 1.0f),
+        Float(324, 285, "TargetInterpolation", 0.05f, 0.0f, 1.0f),
+        Folder(289, 284, "SpectatorCamera"),
+        Float(290, 289, "PanSpeed", 10.0f, 0.0f, 50.0f),
+        Float(291, 289, "PanMin", 0.0f, -50.0f, 50.0f),
+        Float(292, 289, "PanMax", 0.0f, -50.0f, 50.0f),
+        Float(293, 289, "DistanceSpeed", 6.0f, 0.0f, 100.0f),
+        Float(294, 289, "DistanceMin", 5.0f, 0.0f, 100.0f),
+        Float(295, 289, "DistanceMax", 10.0f, 0.0f, 200.0f),
+        Float(296, 289, "HeightSpeed", 15.0f, 0.0f, 100.0f),
+        Float(297, 289, "HeightMin", 0.0f, -50.0f, 50.0f),
+        Float(298, 289, "HeightMax", 0.0f, -50.0f, 50.0f),
+        Float(299, 289, "OrbitSpeed", 75.0f, 0.0f, 360.0f),
+        Float(300, 289, "OrbitMin", -30.0f, -360.0f, 360.0f),
+        Float(301, 289, "OrbitMax", 5.0f, -360.0f, 360.0f),
+        Bool(302, 289, "ResetOnStickRelease", true),
+        Folder(325, 284, "FreeCamera"),
+        Float(326, 325, "FOVSpeed", 30.0f, 0.0f, 100.0f),
+        Float(327, 325, "FOVMin", 20.0f, 0.0f, 180.0f),
+        Float(328, 325, "FOVMax", 90.0f, 0.0f, 180.0f),
+        Float(329, 325, "MoveSpeed", 20.0f, 0.0f, 200.0f),
+        Float(330, 325, "MoveMin", -50.0f, -200.0f, 200.0f),
+        Float(331, 325, "MoveMax", 50.0f, -200.0f, 200.0f),
+        Float(332, 325, "TurnSpeed", 180.0f, 0.0f, 360.0f),
+        Float(333, 325, "TurnMin", -180.0f, -360.0f, 360.0f),
+        Float(334, 325, "TurnMax", 180.0f, -360.0f, 360.0f),
+        Float(335, 325, "RollSpeed", 50.0f, 0.0f, 200.0f),
+        Float(336, 325, "SensitivityX", 0.1f, -2.0f, 2.0f),
+        Float(337, 325, "SensitivityY", -0.1f, -2.0f, 2.0f),
+        Float(338, 325, "SensitivityZ", -0.1f, -2.0f, 2.0f),
+        Float(339, 325, "PositionInterpolation", 0.2f, 0.0f, 1.0f),
+        Float(340, 325, "TargetInterpolation", 0.2f, 0.0f, 1.0f),
+        Float(341, 284, "ReplayCameraYOffset", 1.65f, -10.0f, 10.0f),
+
+        // Physics
+        Folder(345, 0, "Physics"),
+        Int(346, 345, "breakEffectLoadSmall", 4, 0, 100),
+        Int(347, 345, "breakEffectLoadMedium", 10, 0, 100),
+        Int(348, 345, "breakEffectCooldownTicks", 60, 0, 1000),
+        Int(349, 345, "SuperCrossPhysicsActivationDistance", 20, 0, 200),
+
+        // FrameSkipper
+        Folder(351, 0, "FrameSkipper"),
+        Int(352, 351, "SkipAdditionalTicksOnReset", 10, 0, 100),
+        Int(488, 351, "PressLBForDelayMS", 0, 0, 10000),
+        Bool(520, 351, "enabled", true),
+        Bool(521, 351, "forceSkipperOn", false),
+        Bool(522, 351, "forceStrictMode", false),
+        Int(523, 351, "maxSkippedFrames", 4, 0, 20),
+        Int(524, 351, "maxSkippedFramesUGC", 4, 0, 20),
+        Int(525, 351, "maxSkippedFramesInFastForward", 4, 0, 20),
+        Int(526, 351, "rateIncreaseDelay", 10, 0, 100),
+        Int(527, 351, "maxLateFrames", 2, 0, 20),
+        Int(528, 351, "lateFramesDecayTime", 6, 0, 100),
+        Int(529, 351, "maxMissedFramesCumulative", 20, 0, 200),
+        Int(530, 351, "waitThreshold", -500000, -5000000, 5000000),
+        Int(531, 351, "framesBetweenSlowdowns", 10, 0, 100),
+        Int(532, 351, "speedUpThreshold", 50000, -1000000, 1000000),
+        Int(533, 351, "stopSpeedUpThreshold", -30000, -1000000, 1000000),
+        Int(534, 351, "catchUpThreshold", 500000, 0, 5000000),
+        Int(535, 351, "maxUnrenderedFrames", 5, 0, 20),
+        Float(536, 351, "catchUpMaxRatio", 0.15f, 0.0f, 1.0f),
+        Float(537, 351, "catchUpMinRatio", 0.05f, 0.0f, 1.0f),
+        Float(538, 351, "catchUpRatioIncreaseRate", 0.75f, 0.0f, 5.0f),
+        Bool(539, 351, "fakeFasterWithSkipping", true),
+        Int(540, 351, "fakeRenderDelay", 0, 0, 10000),
+        Int(723, 351, "winMissReportTime", 2, 0, 100),
+        Int(724, 351, "winAheadReportTime", 10, 0, 100),
+        Int(725, 351, "targetFrameRate", 60, 1, 240),
+        Int(726, 351, "forceVblankWaitInterval", 30, 0, 100),
+        Bool(727, 351, "vsyncWorks", true),
+        Int(728, 351, "maxValidFPS", 63, 1, 240),
+        Int(729, 351, "minValidFPS", 57, 1, 240),
+        Int(730, 351, "FPSCheckInterval", 2, 0, 100),
+        Int(731, 351, "abnormalFramesTolerated", 4, 0, 100),
+
+        // Graphic
+        Folder(354, 0, "Graphic"),
+        Folder(355, 354, "Advance"),
+        Folder(356, 355, "RenderingDebug"),
+        Bool(357, 356, "EnablePostEffects", true),
+        Float(361, 356, "UnderwaterFogExp", 0.35f, 0.0f, 5.0f),
+        Float(362, 356, "UnderwaterSkyFogExp", 1.0f, 0.0f, 5.0f),
+        Float(363, 356, "UnderwaterFogColorTint", 0.5f, 0.0f, 2.0f),
+        Float(364, 356, "UnderwaterColorTint", 0.5f, 0.0f, 2.0f),
+        Int(365, 356, "UnderwaterPostTechnqiue", 6, 0, 20),
+        Float(366, 356, "DrivingLineBikeWheelWidth", 0.12f, 0.0f, 1.0f),
+        Float(367, 356, "DrivingLineQuadWheelWidth", 0.29f, 0.0f, 1.0f),
+        Float(368, 356, "DrivingLinesQuadWheelDistance", 0.57f, 0.0f, 2.0f),
+        Float(641, 356, "lodDissolveFarest", 0.95f, 0.0f, 1.0f),
+        Float(642, 356, "lodDissolveNearest", 0.75f, 0.0f, 1.0f),
+        Float(643, 356, "lodDissolveConfine", 0.85f, 0.0f, 1.0f),
+        Float(644, 356, "lodDissolveSpeed", 0.01f, 0.0f, 1.0f),
+        Bool(653, 356, "EnableShadow", true),
+        Bool(655, 356, "EnableDebugRendering", false),
+        Int(665, 356, "DebugRenderingIndex", 0, 0, 15),
+        Bool(666, 356, "DebugSpotLightCulling", false),
+        Float(755, 356, "UnderwaterDofDist", 5.0f, 0.0f, 50.0f),
+        Float(756, 356, "UnderwaterDofNear", 0.3f, 0.0f, 5.0f),
+        Float(757, 356, "UnderwaterDofFar", 0.3f, 0.0f, 5.0f),
+        Folder(358, 355, "Occlusion"),
+        Bool(359, 358, "PredictMainCamera", true),
+        Int(360, 358, "PredictFrames", 6, 0, 20),
+        Bool(702, 358, "PredictShadowCamera", true),
+        Bool(703, 358, "UseExtraCascadeCullPlanes", true),
+        Bool(713, 358, "PerObject", true),
+        Bool(714, 358, "PerNode", true),
+        Bool(715, 358, "PerItem", true),
+        Bool(716, 358, "Enable", true),
+        Bool(721, 358, "alwaysFullCull", false),
+        Bool(722, 358, "deferredOcclusion", true),
+        Folder(376, 355, "RGBM_3DLookup"),
+        Bool(377, 376, "RGBM", false),
+        Bool(378, 376, "3DLookup", true),
+        Int(552, 355, "RGBM_3DLookup", 0, 0, 10),
+        Folder(553, 355, "MSSAO"),
+        Bool(554, 553, "MSSAOEnable", true),
+        Float(776, 553, "IntensityMSSAO", 2.2f, 0.0f, 10.0f),
+        Float(777, 553, "t_ao_near_radius", 0.3f, 0.0f, 5.0f),
+        Float(778, 553, "t_ao_far_radius", 20.0f, 0.0f, 100.0f),
+        Float(779, 553, "t_ao_far_distance", 250.0f, 0.0f, 1000.0f),
+        Float(780, 553, "t_ao_gamma_distance", 1.0f, 0.0f, 10.0f),
+        Float(781, 553, "t_ao_angle_bias", 14.0f, 0.0f, 90.0f),
+        Float(782, 553, "t_ao_front_face_strength", 0.4f, 0.0f, 2.0f),
+        Float(783, 553, "t_ao_hbao_radius", 0.5f, 0.0f, 5.0f),
+        Float(784, 553, "t_ao_hbao_max_pixel_radius", 0.25f, 0.0f, 2.0f),
+        Bool(555, 355, "ParallaxMapping", true),
+        Bool(647, 355, "DecalBlurEnable", true),
+        Int(648, 355, "DecalBlurPasses", 2, 0, 10),
+        Bool(649, 355, "DecalNewBlur", false),
+        Folder(650, 355, "Particle/Fog"),
+        Bool(651, 650, "RenderBillboards", true),
+        Bool(652, 650, "RenderParticles", true),
+        Bool(659, 650, "ParticleOverdraw", false),
+        Bool(660, 650, "forceFogOff", false),
+        Bool(661, 650, "particleFogOff", false),
+        Bool(654, 355, "Bloom", true),
+        Bool(656, 355, "ReloadShaders", false),
+        Bool(657, 355, "WireFrameMode", false),
+        Bool(658, 355, "DisableVTJittering", false),
+        Bool(662, 355, "PostMeshesEnabled", true),
+        Bool(663, 355, "LightFlareEnabled", true),
+        Bool(664, 355, "RenderLightTileWithQuads", true),
+        Bool(667, 355, "EnableAA", true),
+        Bool(668, 355, "useDownsample4x4Optimize", true),
+        Folder(669, 355, "Shadow"),
+        Float(670, 669, "shadowBias", 0.004f, 0.0f, 0.1f),
+        Float(671, 669, "PreShadowZScale", 0.97f, 0.0f, 2.0f),
+        Float(672, 669, "PreShadowZShift", 0.03f, 0.0f, 1.0f),
+        Int(673, 669, "ShadowDebugLevel", 0, 0, 10),
+        Int(674, 669, "PSSMCullingRoundedWay", 2, 0, 5),
+        Bool(675, 669, "PSSMUseUniform", false),
+        Bool(676, 669, "SpotlightBiasHack", true),
+        Float(677, 669, "PSSMCompressShadowRate", 1.0f, 0.0f, 5.0f),
+        Bool(678, 669, "PSSMInterleavedRendering", true),
+        Folder(679, 669, "Scrolling"),
+        Int(680, 679, "PSSMScrollingLogIndex", 0, 0, 10),
+        Bool(681, 679, "PSSMAlwaysInvalidCache", false),
+        Int(682, 679, "PSSMScrollingCacheDebug", 0, 0, 10),
+        Bool(683, 679, "PSSMLogPredictScrollOffset", false),
+        Bool(684, 679, "PSSMLogPredictOrthoChange", false),
+        Float(685, 679, "PSSMOrthoChangePredictRate", 2.0f, 0.0f, 10.0f),
+        Float(686, 679, "PSSMOutOfRangePredictRate", 1.5f, 0.0f, 10.0f),
+        Bool(772, 679, "ChangeTerrainDynamicFlag", true),
+        Int(773, 679, "DynamicLODThreshold", 3, 0, 10),
+        Bool(786, 679, "ChangeTerrainDynamicFlagTess", true),
+        Int(787, 679, "DynamicLODThresholdTess", 2, 0, 10),
+        Float(687, 669, "PSSMCullingAreaExtendMul", 1.05f, 0.0f, 5.0f),
+        Float(688, 669, "PSSMCullingAreaExtendAdd", 5.0f, 0.0f, 50.0f),
+        Float(689, 669, "PSSMDepthMinMaxPredict", 6.0f, 0.0f, 20.0f),
+        Bool(690, 669, "UseScryControlShadowPCFsteps", false),
+        Int(691, 669, "ShadowPCFFilter", 1, 0, 10),
+        Float(700, 669, "MaxShadowViewDistance", 400.0f, 0.0f, 2000.0f),
+        Bool(701, 669, "enableTweakingShadowDrawDistance", false),
+        Bool(704, 669, "FixedShadowRangeAllTime", false),
+        Bool(705, 669, "LimitCascadeChange", true),
+        Bool(706, 669, "LimitCascadeMinMax", true),
+        Folder(692, 355, "GlobalAmbient"),
+        Bool(693, 692, "GlobalAmbientRebake", false),
+        Bool(738, 692, "Enabled", false),
+        Float(739, 692, "GlobalAmbientBlend", 0.0f, 0.0f, 2.0f),
+        Float(740, 692, "NormalScaleXY", 1.6f, 0.0f, 10.0f),
+        Float(741, 692, "NormalScaleZ", 1.0f, 0.0f, 10.0f),
+        Float(742, 692, "MaxDeltaHeight", 200.0f, 0.0f, 1000.0f),
+        Float(743, 692, "PixelOcclusionFalloffY", 16.0f, 0.0f, 100.0f),
+        Float(744, 692, "PixelOcclusionMin", 0.65f, 0.0f, 2.0f),
+        Float(745, 692, "ZRangeMultiplier", 128.0f, 0.0f, 500.0f),
+        Float(746, 692, "ZRangeOffset", 0.0f, 0.0f, 100.0f),
+        Float(747, 692, "Intensity", 0.23f, 0.0f, 5.0f),
+        Folder(694, 355, "AverageLuminance"),
+        Bool(695, 694, "DebugEnabled", false),
+        Float(696, 694, "averageLuminance", 1.0f, 0.0f, 10.0f),
+        Float(697, 694, "averageLuminanceBlend", 0.5f, 0.0f, 2.0f),
+        Float(698, 355, "windGustStr", 1.5f, 0.0f, 10.0f),
+        Int(699, 355, "DebugSkyCubemapMipLevel", 0, 0, 10),
+        Folder(707, 355, "Bokeh"),
+        Bool(708, 707, "SingleVP", false),
+        Bool(709, 707, "DebugView", false),
+        Bool(710, 707, "Optimization", true),
+        Float(748, 707, "BrightnessThreshold", 1.2f, 0.0f, 10.0f),
+        Float(749, 707, "CoCThreshold", 0.7f, 0.0f, 2.0f),
+        Float(750, 707, "BlurSize", 32.0f, 0.0f, 100.0f),
+        Float(751, 707, "BlurLimitNear", 0.9f, 0.0f, 2.0f),
+        Float(752, 707, "BlurLimitFar", 0.5f, 0.0f, 2.0f),
+        Float(753, 707, "LowResRange", 0.75f, 0.0f, 2.0f),
+        Bool(754, 707, "EnableParamDebug", false),
+        Folder(711, 355, "CMAA"),
+        Bool(712, 711, "Enable", true),
+        Float(736, 711, "EdgeDetectionThreshold", 0.0769231f, 0.0f, 1.0f),
+        Float(737, 711, "NonDominantEdgeRemovalAmount", 0.35f, 0.0f, 2.0f),
+        Bool(717, 355, "InstancingEnable", true),
+        Float(718, 355, "lowEndLodRange", 0.6f, 0.0f, 2.0f),
+        Float(719, 355, "highEndLodRange", 1.0f, 0.0f, 2.0f),
+        Bool(720, 355, "CullSpotLightByCone", true),
+        Folder(758, 355, "LocalReflectionParameter"),
+        Float(759, 758, "MinAmbientFresnel", 0.001f, 0.0f, 1.0f),
+        Float(760, 758, "InitRayStepLength", 2.0f, 0.0f, 10.0f),
+        Float(761, 758, "MaxRayJittering", 0.1f, 0.0f, 2.0f),
+        Float(762, 758, "VignetteSizeScale", -5.0f, -20.0f, 20.0f),
+        Float(763, 758, "VignetteSizeBias", 2.5f, 0.0f, 10.0f),
+        Float(764, 758, "MaxReflectionBrightness", 0.8f, 0.0f, 5.0f),
+        Float(765, 758, "ReflectionScale", 2.0f, 0.0f, 10.0f),
+        Float(766, 758, "MaxRayDistance", 5.0f, 0.0f, 50.0f),
+        Float(767, 758, "MaxRayDelta", 0.125f, 0.0f, 2.0f),
+        Float(768, 758, "MaxRayStep", 400.0f, 0.0f, 2000.0f),
+        Float(769, 758, "FarClipDistance", 0.999f, 0.0f, 2.0f),
+        Float(770, 758, "ReflectionBlurriness", 300.0f, 0.0f, 1000.0f),
+        Float(771, 758, "MinBlurRadius", 2.0f, 0.0f, 10.0f),
+        Bool(774, 355, "TerrainLODEdgesOnly", true),
+        Bool(775, 355, "TerrainLODEdgesAreFat", true),
+        Float(785, 355, "TessQuality", 0.3f, 0.0f, 2.0f),
+
+        // Podium
+        Folder(372, 0, "Podium"),
+        Float(373, 372, "cameraOffsetX", -2.6f, -10.0f, 10.0f),
+        Float(374, 372, "cameraOffsetY", 0.0f, -10.0f, 10.0f),
+        Float(375, 372, "cameraOffsetZ", 0.0f, -10.0f, 10.0f),
+
+        // XPSystem
+        Folder(492, 0, "XPSystem"),
+        Int(493, 492, "Level1XPLimit", 100, 0, 100000),
+        Int(494, 492, "LevelXPLimitVal1 (Val1 * (Val2 * level + Val3) * (level - 1))", 12, 0, 1000),
+        Int(495, 492, "LevelXPLimitVal2", 4, 0, 1000),
+        Int(496, 492, "LevelXPLimitVal3", 72, 0, 1000),
+        Int(497, 492, "XPRewardBeginnerTrackCompleted", 0, 0, 10000),
+        Int(498, 492, "XPRewardEasyTrackCompleted", 0, 0, 10000),
+        Int(499, 492, "XPRewardMediumTrackCompleted", 0, 0, 10000),
+        Int(500, 492, "XPRewardHardTrackCompleted", 0, 0, 10000),
+        Int(501, 492, "XPRewardExtremeTrackCompleted", 0, 0, 10000),
+        Int(502, 492, "XPRewardTraining1Passed", 100, 0, 10000),
+        Int(503, 492, "XPRewardTraining2Passed", 1000, 0, 10000),
+        Int(504, 492, "XPRewardTraining3Passed", 2000, 0, 10000),
+        Int(505, 492, "XPRewardTrainingFMXPassed", 2000, 0, 10000),
+        Int(506, 492, "XPRewardTraining5Passed", 4500, 0, 10000),
+        Int(507, 492, "XPRewardBronzeMedal", 200, 0, 10000),
+        Int(508, 492, "XPRewardSilverMedal", 300, 0, 10000),
+        Int(509, 492, "XPRewardGoldMedal", 500, 0, 10000),
+        Int(510, 492, "XPRewardPlatinumMedal", 1000, 0, 10000),
+        Int(511, 492, "XPRewardUGCTrackCompleted", 50, 0, 10000),
+        Int(512, 492, "XPRewardMPTournamentPlayed", 0, 0, 10000),
+        Int(513, 492, "XPRewardAllBeginnerTracksCompleted", 0, 0, 10000),
+        Int(514, 492, "XPRewardAllEasyTracksCompleted", 0, 0, 10000),
+        Int(515, 492, "XPRewardAllMediumTracksCompleted", 0, 0, 10000),
+        Int(516, 492, "XPRewardAllHardTracksCompleted", 0, 0, 10000),
+        Int(517, 492, "XPRewardAllExtremeTracksCompleted", 0, 0, 10000),
+
+        // TrackUpload
+        Folder(518, 0, "TrackUpload"),
+        Bool(519, 518, "corruptTracks", false),
+
+        // GameOption
+        Folder(541, 0, "GameOption"),
+        Folder(542, 541, "VideoOption"),
+        Bool(543, 542, "FullScreen", true),
+        Bool(544, 542, "Vsync", true),
+        Int(545, 542, "FXAA", -1, -1, 2),
+        Bool(546, 542, "ShowFoliage", true),
+        Int(547, 542, "ShadowQuality", 1, 0, 3),
+        Int(548, 542, "GraphicQuality(low/normal/high)", 1, 0, 2),
+        Int(549, 542, "GeometryQuality(low/high)", 0, 0, 1),
+        Int(550, 542, "BloomQuality(low/high)", 0, 0, 1),
+        Int(551, 542, "ParticleQuality(normal/high/ultra)", 0, 0, 2),
+        Bool(556, 542, "BokehDof", false),
+
+        // GameSwf
+        Folder(560, 0, "GameSwf"),
+        Int(561, 560, "OnlineMenuNormalSkip", 1, 0, 10),
+        Int(562, 560, "OnlineMenuUpdateMaxSkip", 4, 0, 10),
+        Folder(620, 560, "Render"),
+        Float(621, 620, "MinTextAutoScale", 0.25f, 0.0f, 2.0f),
+        Float(622, 620, "TextScaleMultiplier", 1.0f, 0.0f, 5.0f),
+        Float(792, 620, "Z-Depth", 0.01f, 0.0f, 1.0f),
+        Float(793, 620, "Resolution", 1.0f, 0.0f, 4.0f),
+        Float(794, 620, "TextureScale", 1.0f, 0.0f, 4.0f),
+        Folder(795, 560, "Video"),
+        Float(796, 795, "TextureColorR", 1.0f, 0.0f, 2.0f),
+        Float(797, 795, "TextureColorG", 1.0f, 0.0f, 2.0f),
+        Float(798, 795, "TextureColorB", 1.0f, 0.0f, 2.0f),
+        Float(799, 795, "TextureColorA", 1.0f, 0.0f, 2.0f),
+        Float(800, 795, "TextureAddColorR", 1.0f, 0.0f, 2.0f),
+        Float(801, 795, "TextureAddColorG", 1.0f, 0.0f, 2.0f),
+        Float(802, 795, "TextureAddColorB", 1.0f, 0.0f, 2.0f),
+        Float(803, 795, "TextureAddColorA", 1.0f, 0.0f, 2.0f),
+        Int(804, 795, "FillMode", 0, 0, 5),
+        Int(805, 795, "Technique", 1, 0, 5),
+        Float(806, 795, "AlphaModX", 1.0f, 0.0f, 2.0f),
+        Float(807, 795, "AlphaModY", 1.0f, 0.0f, 2.0f),
+
+        // GameTime
+        Folder(563, 0, "GameTime"),
+        Int(564, 563, "LogicTimeMaxAhead", 4000000, 0, 100000000),
+        Int(565, 563, "LogicTimeMaxBehind", 10000000, 0, 100000000),
+
+        // VariableFramerateDebug
+        Folder(566, 0, "VariableFramerateDebug"),
+        Int(567, 566, "GPUStall", 0, 0, 100),
+        Bool(568, 566, "LimitingAllowed", true),
+        Float(569, 566, "FastForwardRatio", 2.0f, 0.0f, 10.0f),
+        Int(570, 566, "SlowMotionRatio", 5, 0, 20),
+        Float(631, 566, "CameraShowInterpolatedAmplitude", 0.0f, 0.0f, 10.0f),
+        Float(632, 566, "CameraShowInterpolatedFrequency", 1.0f, 0.0f, 10.0f),
+        Bool(633, 566, "CameraDisableWholeThing", false),
+        Bool(634, 566, "ShowInterpolatedObjects", false),
+        Bool(635, 566, "DoTranslation", true),
+        Bool(636, 566, "DoRotation", true),
+        Bool(637, 566, "DisableWholeThing", false),
+        Bool(638, 566, "DoNothingInInterpolateMatrices", false),
+        Bool(639, 566, "UseAsRotation", false),
+        Bool(640, 566, "UseAsTranslation", false),
+        Bool(645, 566, "ShowInterpolatedBoneObjects", false),
+        Bool(646, 566, "DisableWholeThingBone", true),
+        Float(732, 566, "Alpha", 1.0f, 0.0f, 2.0f),
+        Bool(733, 566, "NegAlpha", false),
+
+        // Debug
+        Folder(601, 0, "Debug"),
+        Int(602, 601, "ScoreSaveStateOverride", 0, 0, 10),
+
+        // InGameHud
+        Folder(603, 0, "InGameHud"),
+        Float(604, 603, "MultiplayerMarkerInterpolation", 0.98f, 0.0f, 1.0f),
+
+        // MainHub
+        Folder(606, 0, "MainHub"),
+        Bool(607, 606, "TournamentsEnabled", true),
+        Bool(613, 606, "Disable Uplay Check", true),
+
+        // MainMenu
+        Folder(608, 0, "MainMenu"),
+        Int(609, 608, "BannerContentPackId", 0, 0, 100),
+        Bool(610, 608, "BannerContentPackComingSoon", true),
+
+        // Flash
+        Folder(611, 0, "Flash"),
+        Bool(612, 611, "ErrorsEnabled", true),
+
+        // GarbageCollector
+        Folder(614, 0, "GarbageCollector"),
+        Bool(615, 614, "PrintObjectCtorDtor", true),
+        Int(616, 614, "SweepTreshold", 60, 0, 1000),
+        Int(617, 614, "ObjCountBegin", 10000, 0, 100000),
+        Int(618, 614, "ObjCountEnd", 20000, 0, 100000),
+        Int(619, 614, "SanityCheckInterval", 15, 0, 1000),
+        Int(623, 614, "MarkMaxMicroseconds", 1000000, 0, 10000000),
+        Bool(624, 614, "CheckAfterAlive", false),
+        Bool(625, 614, "PrintMarkInfo", true),
+
+        // Settings
+        Folder(629, 0, "Settings"),
+        Int(630, 629, "MouseActivationThreshold", 3, 0, 100),
+
+        // debug
+        Folder(734, 0, "debug"),
+        Bool(735, 734, "localization", false),
+    };
+
+    const size_t COUNT = sizeof(DEFINITIONS) / sizeof(DEFINITIONS[0]);
+
+    // ========================================================================
+    // Compile-time checks
+    // ========================================================================
+
+    // Every row's parent is an open folder (the previous row's folder or one of its ancestors)
+    constexpr bool IsDepthFirst() {
+        uint16_t open[MAX_DEPTH] = {};
+        int depth = 0;
+        for (size_t i = 0; i < COUNT; i++) {
+            const Definition& def = DEFINITIONS[i];
+            while (depth > 0 && open[depth - 1] != def.parent) depth--;
+            if (depth == 0 && def.parent != 0) return false;
+            if (def.id == 0) return false;
+            if (def.type == TweakableType::Folder) {
+                if (depth == MAX_DEPTH) return false;
+                open[depth++] = def.id;
+            }
+        }
+        return true;
+    }
+
+    // Name pool size for TweakableRegistry::Reserve (with terminators)
+    constexpr size_t CountNameBytes() {
+        size_t bytes = 0;
+        for (size_t i = 0; i < COUNT; i++) {
+            const char* name = DEFINITIONS[i].name;
+            while (*name++) bytes++;
+            bytes++;
+        }
+        return bytes;
+    }
+
+    constexpr int MaxId() {
+        int maxId = 0;
+        for (size_t i = 0; i < COUNT; i++) {
+            if (DEFINITIONS[i].id > maxId) maxId = DEFINITIONS[i].id;
+        }
+        return maxId;
+    }
+
+    const size_t NAME_BYTES = CountNameBytes();
+    const int MAX_ID = MaxId();
+
+    static_assert(IsDepthFirst(), "Tweakable definitions must be depth first, with parents before children");
+
+    // ========================================================================
+    // Materialization
+    // ========================================================================
+
+    // Append every row to the registry in one pass; value rows report edits to listener.
+    // Call registry.Reserve() first to avoid reallocating while adding.
+    inline void Materialize(TweakableRegistry& registry, TweakableListener* listener) {
+        uint32_t open[MAX_DEPTH];
+        int depth = 0;
+
+        for (size_t i = 0; i < COUNT; i++) {
+            const Definition& def = DEFINITIONS[i];
+            while (depth > 0 && registry.GetId(open[depth - 1]) != def.parent) {
+                registry.EndFolder(open[--depth]);
+            }
+
+            uint32_t parent = depth > 0 ? open[depth - 1] : TweakableRegistry::INVALID_SLOT;
+            bool isFolder = def.type == TweakableType::Folder;
+            uint32_t slot = registry.Add(def.id, def.type, def.name, parent,
+                def.defaultValue, def.minValue, def.maxValue, isFolder ? nullptr : listener);
+            if (isFolder) open[depth++] = slot;
+        }
+
+        while (depth > 0) {
+            registry.EndFolder(open[--depth]);
+        }
+    }
+
+} // namespace TweakableTable
@@ -0,0 +1,226 @@
+// fake_leaderboard_service.cpp
+// Offline stand-in for the Trials Fusion leaderboard server, used to benchmark
+// LeaderboardGovernor against the old fixed-delay pacing without the game running.
+//
+// The fake server answers page requests with a base latency plus jitter, slows down
+// as more requests are queued, and throttles clients that exceed its per-second budget:
+// a throttled request fails and the server rejects everything for a penalty period.
+//
+// Time is simulated, so a multi-minute scan finishes instantly.
+//
+// Build (Linux):
+//   g++ -std=c++14 -O2 -I../../TFPayload fake_leaderboard_service.cpp -o fake_leaderboard_service -pthread
+// Run:
+//   ./fake_leaderboard_service [--pages N] [--depth D] [--limit R] [--seed S]
+
+#include "leaderboard_governor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct ServerConfig {
+        double baseLatencyMs = 180.0;
+        double jitterMs = 120.0;
+        double perQueuedMs = 90.0;          // Extra latency per request already in flight
+        int limitPerSecond = 4;             // Requests accepted per sliding second
+        double penaltyMs = 4000.0;          // Everything fails for this long after a throttle
+    };
+
+    struct Response {
+        double completeAtMs;
+        bool ok;
+        double latencyMs;
+    };
+
+    class FakeLeaderboardService {
+    public:
+        FakeLeaderboardService(const ServerConfig& config, unsigned seed)
+            : m_config(config), m_rng(seed), m_jitter(0.0, 1.0) {}
+
+        // Submit a request at nowMs; returns when and how it completes
+        Response Submit(double nowMs, int inFlight) {
+            while (!m_window.empty() && m_window.front() <= nowMs - 1000.0) {
+                m_window.pop_front();
+            }
+            m_window.push_back(nowMs);
+
+            double latency = m_config.baseLatencyMs
+                + m_config.jitterMs * m_jitter(m_rng)
+                + m_config.perQueuedMs * inFlight;
+
+            if (nowMs < m_penaltyUntilMs) {
+                m_throttled++;
+                return { nowMs + 60.0, false, 60.0 };
+            }
+
+            if ((int)m_window.size() > m_config.limitPerSecond) {
+                m_throttled++;
+                m_penaltyUntilMs = nowMs + m_config.penaltyMs;
+                return { nowMs + 60.0, false, 60.0 };
+            }
+
+            return { nowMs + latency, true, latency };
+        }
+
+        int GetThrottledCount() const { return m_throttled; }
+
+    private:
+        ServerConfig m_config;
+        std::mt19937 m_rng;
+        std::uniform_real_distribution<double> m_jitter;
+        std::deque<double> m_window;
+        double m_penaltyUntilMs = -1.0;
+        int m_throttled = 0;
+    };
+
+    enum class Strategy {
+        FixedDelay,     // Old scanner behaviour: ~10 polls (800ms) between pages
+        Unpaced,        // Fire as soon as a pipeline slot frees up
+        Governor        // LeaderboardGovernor token bucket with AIMD feedback
+    };
+
+    const char* StrategyName(Strategy strategy) {
+        switch (strategy) {
+        case Strategy::FixedDelay: return "fixed 800ms delay";
+        case Strategy::Unpaced: return "unpaced";
+        case Strategy::Governor: return "governor";
+        }
+        return "?";
+    }
+
+    struct RunResult {
+        double elapsedMs = 0.0;
+        int completedPages = 0;
+        int requests = 0;
+        int throttled = 0;
+        std::vector<double> latencies;
+        double finalRate = 0.0;
+    };
+
+    RunResult Run(Strategy strategy, int pages, int depth, const ServerConfig& serverConfig, unsigned seed) {
+        const double tickMs = 80.0;                 // KeyMonitorThread poll interval
+        const double fixedDelayMs = 800.0;
+        const double giveUpMs = 60.0 * 60.0 * 1000.0;
+
+        FakeLeaderboardService server(serverConfig, seed);
+        LeaderboardGovernor::RequestGovernor governor;
+
+        RunResult result;
+        std::vector<Response> inFlight;
+        int completedPages = 0;
+        int nextPage = 0;
+        std::vector<int> retryQueue;
+        double nextFixedIssueMs = 0.0;
+
+        double nowMs = 0.0;
+        while (completedPages < pages && nowMs < giveUpMs) {
+            // Collect responses that arrived since the last tick
+            for (size_t i = 0; i < inFlight.size();) {
+                if (inFlight[i].completeAtMs <= nowMs) {
+                    const Response& response = inFlight[i];
+                    if (response.ok) {
+                        completedPages++;
+                        result.latencies.push_back(response.latencyMs);
+                    } else {
+                        retryQueue.push_back(0);
+                    }
+                    if (strategy == Strategy::Governor) {
+                        governor.RecordResponse(response.latencyMs,
+                            response.ok ? LeaderboardGovernor::Outcome::Ok : LeaderboardGovernor::Outcome::Failed);
+                    }
+                    if (strategy == Strategy::FixedDelay) {
+                        nextFixedIssueMs = nowMs + fixedDelayMs;
+                    }
+                    inFlight[i] = inFlight.back();
+                    inFlight.pop_back();
+                } else {
+                    i++;
+                }
+            }
+
+            // Issue as many requests as the strategy allows this tick
+            while ((int)inFlight.size() < depth && (nextPage < pages || !retryQueue.empty())) {
+                if (strategy == Strategy::FixedDelay && nowMs < nextFixedIssueMs) break;
+                if (strategy == Strategy::Governor && !governor.TryAcquire(nowMs / 1000.0)) break;
+
+                if (!retryQueue.empty()) {
+                    retryQueue.pop_back();
+                } else {
+                    nextPage++;
+                }
+
+                inFlight.push_back(server.Submit(nowMs, (int)inFlight.size()));
+                result.requests++;
+
+                if (strategy == Strategy::FixedDelay) {
+                    nextFixedIssueMs = giveUpMs;    // Wait for the response, then delay
+                    break;
+                }
+            }
+
+            nowMs += tickMs;
+        }
+
+        result.elapsedMs = nowMs;
+        result.completedPages = completedPages;
+        result.throttled = server.GetThrottledCount();
+        result.finalRate = governor.GetStats().currentRate;
+        return result;
+    }
+
+    double Percentile(std::vector<double> values, double p) {
+        if (values.empty()) return 0.0;
+        std::sort(values.begin(), values.end());
+        size_t index = (size_t)(p * (values.size() - 1));
+        return values[index];
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int pages = 500;
+    int depth = 1;
+    unsigned seed = 1;
+    ServerConfig serverConfig;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) break;
+        if (arg == "--pages") pages = std::atoi(argv[++i]);
+        else if (arg == "--depth") depth = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--limit") serverConfig.limitPerSecond = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--seed") seed = (unsigned)std::atoi(argv[++i]);
+    }
+
+    std::printf("Fake leaderboard service: %d pages, pipeline depth %d, server limit %d req/s\n\n",
+        pages, depth, serverConfig.limitPerSecond);
+    std::printf("%-20s %10s %10s %10s %10s %10s %10s\n",
+        "strategy", "time (s)", "pages/s", "requests", "throttled", "p50 ms", "p95 ms");
+
+    const Strategy strategies[] = { Strategy::FixedDelay, Strategy::Unpaced, Strategy::Governor };
+    for (Strategy strategy : strategies) {
+        RunResult result = Run(strategy, pages, depth, serverConfig, seed);
+        double seconds = result.elapsedMs / 1000.0;
+        std::printf("%-20s %10.1f %10.2f %10d %10d %10.0f %10.0f",
+            StrategyName(strategy), seconds, result.completedPages / seconds, result.requests, result.throttled,
+            Percentile(result.latencies, 0.50), Percentile(result.latencies, 0.95));
+        if (result.completedPages < pages) {
+            std::printf("   (gave up after %d/%d pages)", result.completedPages, pages);
+        }
+        if (strategy == Strategy::Governor) {
+            std::printf("   (settled at %.2f req/s)", result.finalRate);
+        }
+        std::printf("\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,456 @@
+// packet_analyzer.cpp
+// Offline analyzer for multiplayer packet captures (.tfcap) written by PacketCapture.
+//
+// The capture is mapped with mmap and its fixed-size blocks are split across worker threads.
+// Each worker builds partial statistics for its block range and the partials are merged in
+// file order, so multi-GB captures are scanned at memory bandwidth without loading them.
+//
+// Reports:
+//   - per-type packet counts, bytes, rates and inter-arrival jitter
+//   - bandwidth over time (recv/send bytes per bucket)
+//   - per-player traffic (by source and destination id)
+//
+// Build (Linux):
+//   g++ -std=c++14 -O2 -I../../TFPayload packet_analyzer.cpp -o packet_analyzer -pthread
+// Run:
+//   ./packet_analyzer capture.tfcap [--threads N] [--bucket-ms MS] [--rows R] [--csv out.csv]
+//   ./packet_analyzer --synthesize out.tfcap --packets N      (write a test capture)
+
+#include "packet_capture_format.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+    using namespace PacketCaptureFormat;
+
+    // Inter-arrival statistics that can be merged across chunks
+    struct Intervals {
+        uint64_t count = 0;
+        double sum = 0.0;
+        double sumSq = 0.0;
+        uint64_t minUs = UINT64_MAX;
+        uint64_t maxUs = 0;
+
+        void Add(uint64_t gapUs) {
+            count++;
+            sum += (double)gapUs;
+            sumSq += (double)gapUs * (double)gapUs;
+            minUs = std::min(minUs, gapUs);
+            maxUs = std::max(maxUs, gapUs);
+        }
+
+        void Merge(const Intervals& other) {
+            count += other.count;
+            sum += other.sum;
+            sumSq += other.sumSq;
+            minUs = std::min(minUs, other.minUs);
+            maxUs = std::max(maxUs, other.maxUs);
+        }
+
+        double Mean() const { return count ? sum / count : 0.0; }
+
+        double StdDev() const {
+            if (count < 2) return 0.0;
+            double mean = Mean();
+            return std::sqrt(std::max(0.0, sumSq / count - mean * mean));
+        }
+    };
+
+    struct TypeStats {
+        uint64_t packets = 0;
+        uint64_t recvPackets = 0;
+        uint64_t sendPackets = 0;
+        uint64_t bytes = 0;
+        uint64_t firstUs = 0;
+        uint64_t lastUs = 0;
+        Intervals gaps;
+    };
+
+    struct PlayerStats {
+        uint64_t packetsFrom = 0;
+        uint64_t bytesFrom = 0;
+        uint64_t packetsTo = 0;
+        uint64_t bytesTo = 0;
+    };
+
+    struct Partial {
+        uint64_t records = 0;
+        uint64_t bytes = 0;
+        uint64_t payloadBytes = 0;
+        uint64_t truncated = 0;
+        uint64_t faulted = 0;
+        uint64_t badBlocks = 0;
+        uint64_t firstUs = UINT64_MAX;
+        uint64_t lastUs = 0;
+        std::map<uint32_t, TypeStats> types;
+        std::unordered_map<uint32_t, PlayerStats> players;
+        std::map<uint64_t, std::pair<uint64_t, uint64_t>> bandwidth;   // bucket -> (recv, send)
+    };
+
+    struct Options {
+        std::string path;
+        unsigned threads = 0;
+        uint64_t bucketUs = 1000000;
+        size_t rows = 30;
+        std::string csvPath;
+        std::string synthesizePath;
+        uint64_t synthesizePackets = 1000000;
+    };
+
+    // Scan blocks [first, last) of a mapped capture
+    void ScanBlocks(const uint8_t* base, const FileHeader& header, size_t first, size_t last,
+                    uint64_t bucketUs, Partial& out) {
+        for (size_t b = first; b < last; b++) {
+            const uint8_t* block = base + header.headerSize + b * (size_t)header.blockSize;
+            BlockHeader blockHeader;
+            memcpy(&blockHeader, block, sizeof(blockHeader));
+            if (blockHeader.magic != BLOCK_MAGIC || blockHeader.usedBytes > header.blockSize) {
+                out.badBlocks++;
+                continue;
+            }
+
+            size_t offset = sizeof(BlockHeader);
+            for (uint32_t r = 0; r < blockHeader.recordCount; r++) {
+                if (offset + sizeof(RecordHeader) > blockHeader.usedBytes) {
+                    out.badBlocks++;
+                    break;
+                }
+                RecordHeader record;
+                memcpy(&record, block + offset, sizeof(record));
+                offset += sizeof(RecordHeader) + record.capturedLength;
+
+                out.records++;
+                out.bytes += record.size;
+                out.payloadBytes += record.capturedLength;
+                if (record.flags & FLAG_TRUNCATED) out.truncated++;
+                if (record.flags & FLAG_FAULTED) out.faulted++;
+                out.firstUs = std::min(out.firstUs, record.timestampUs);
+                out.lastUs = std::max(out.lastUs, record.timestampUs);
+
+                TypeStats& type = out.types[record.type];
+                if (type.packets > 0) {
+                    type.gaps.Add(record.timestampUs - type.lastUs);
+                } else {
+                    type.firstUs = record.timestampUs;
+                }
+                type.lastUs = record.timestampUs;
+                type.packets++;
+                type.bytes += record.size;
+                if (record.direction == 0) type.recvPackets++; else type.sendPackets++;
+
+                PlayerStats& source = out.players[record.sourcePlayerId];
+                source.packetsFrom++;
+                source.bytesFrom += record.size;
+                PlayerStats& dest = out.players[record.destPlayerId];
+                dest.packetsTo++;
+                dest.bytesTo += record.size;
+
+                auto& bucket = out.bandwidth[record.timestampUs / bucketUs];
+                if (record.direction == 0) bucket.first += record.size; else bucket.second += record.size;
+            }
+        }
+    }
+
+    // Merge a later chunk into an earlier one; the gap between the chunks counts as an interval
+    void Merge(Partial& into, const Partial& next) {
+        into.records += next.records;
+        into.bytes += next.bytes;
+        into.payloadBytes += next.payloadBytes;
+        into.truncated += next.truncated;
+        into.faulted += next.faulted;
+        into.badBlocks += next.badBlocks;
+        into.firstUs = std::min(into.firstUs, next.firstUs);
+        into.lastUs = std::max(into.lastUs, next.lastUs);
+
+        for (const auto& pair : next.types) {
+            TypeStats& type = into.types[pair.first];
+            const TypeStats& other = pair.second;
+            if (type.packets > 0) {
+                type.gaps.Add(other.firstUs - type.lastUs);
+            } else {
+                type.firstUs = other.firstUs;
+            }
+            type.gaps.Merge(other.gaps);
+            type.lastUs = other.lastUs;
+            type.packets += other.packets;
+            type.recvPackets += other.recvPackets;
+            type.sendPackets += other.sendPackets;
+            type.bytes += other.bytes;
+        }
+
+        for (const auto& pair : next.players) {
+            PlayerStats& player = into.players[pair.first];
+            player.packetsFrom += pair.second.packetsFrom;
+            player.bytesFrom += pair.second.bytesFrom;
+            player.packetsTo += pair.second.packetsTo;
+            player.bytesTo += pair.second.bytesTo;
+        }
+
+        for (const auto& pair : next.bandwidth) {
+            auto& bucket = into.bandwidth[pair.first];
+            bucket.first += pair.second.first;
+            bucket.second += pair.second.second;
+        }
+    }
+
+    std::string FormatBytes(double bytes) {
+        const char* units[] = { "B", "KB", "MB", "GB", "TB" };
+        int unit = 0;
+        while (bytes >= 1024.0 && unit < 4) {
+            bytes /= 1024.0;
+            unit++;
+        }
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%.1f %s", bytes, units[unit]);
+        return buffer;
+    }
+
+    void PrintReport(const FileHeader& header, const Partial& total, const Options& options, double scanSeconds, size_t fileSize) {
+        double durationSec = total.records ? (total.lastUs - total.firstUs) / 1e6 : 0.0;
+        if (durationSec <= 0.0) durationSec = 1e-6;
+
+        printf("Capture: %s\n", options.path.c_str());
+        printf("  %llu records, %s reported, %s payload captured, %.1f s of traffic\n",
+            (unsigned long long)total.records, FormatBytes((double)total.bytes).c_str(),
+            FormatBytes((double)total.payloadBytes).c_str(), durationSec);
+        printf("  snap length %u, %llu truncated, %llu unreadable, %llu bad blocks\n",
+            header.snapLength, (unsigned long long)total.truncated, (unsigned long long)total.faulted,
+            (unsigned long long)total.badBlocks);
+        printf("  scanned %s in %.3f s (%.0f MB/s)\n\n", FormatBytes((double)fileSize).c_str(), scanSeconds,
+            fileSize / 1048576.0 / std::max(scanSeconds, 1e-9));
+
+        printf("Per packet type:\n");
+        printf("  %10s %10s %8s %8s %10s %12s %10s %10s %10s %10s\n",
+            "type", "packets", "recv", "send", "pkt/s", "bytes", "B/s", "gap ms", "jitter ms", "max ms");
+        for (const auto& pair : total.types) {
+            const TypeStats& type = pair.second;
+            printf("  0x%08x %10llu %8llu %8llu %10.2f %12s %10.0f %10.2f %10.2f %10.2f\n",
+                pair.first, (unsigned long long)type.packets, (unsigned long long)type.recvPackets,
+                (unsigned long long)type.sendPackets, type.packets / durationSec,
+                FormatBytes((double)type.bytes).c_str(), type.bytes / durationSec,
+                type.gaps.Mean() / 1000.0, type.gaps.StdDev() / 1000.0, type.gaps.maxUs / 1000.0);
+        }
+
+        printf("\nBandwidth over time (%.3f s buckets", options.bucketUs / 1e6);
+        size_t buckets = total.bandwidth.empty() ? 0
+            : (size_t)(total.bandwidth.rbegin()->first - total.bandwidth.begin()->first + 1);
+        size_t perRow = std::max<size_t>(1, (buckets + options.rows - 1) / std::max<size_t>(1, options.rows));
+        if (perRow > 1) printf(", %zu per row", perRow);
+        printf("):\n");
+        printf("  %10s %12s %12s\n", "t (s)", "recv B/s", "send B/s");
+        if (!total.bandwidth.empty()) {
+            uint64_t firstBucket = total.bandwidth.begin()->first;
+            double rowSeconds = perRow * options.bucketUs / 1e6;
+            uint64_t peak = 0;
+            for (size_t row = 0; row * perRow < buckets; row++) {
+                uint64_t recv = 0, send = 0;
+                for (size_t k = 0; k < perRow; k++) {
+                    auto it = total.bandwidth.find(firstBucket + row * perRow + k);
+                    if (it == total.bandwidth.end()) continue;
+                    recv += it->second.first;
+                    send += it->second.second;
+                    peak = std::max(peak, it->second.first + it->second.second);
+                }
+                printf("  %10.1f %12.0f %12.0f\n", (firstBucket + row * perRow) * options.bucketUs / 1e6,
+                    recv / rowSeconds, send / rowSeconds);
+            }
+            printf("  peak bucket: %s/s\n", FormatBytes(peak / (options.bucketUs / 1e6)).c_str());
+        }
+
+        printf("\nPer player:\n");
+        printf("  %10s %10s %12s %10s %12s\n", "player", "pkts from", "bytes from", "pkts to", "bytes to");
+        std::vector<std::pair<uint32_t, PlayerStats>> players(total.players.begin(), total.players.end());
+        std::sort(players.begin(), players.end(), [](const std::pair<uint32_t, PlayerStats>& a, const std::pair<uint32_t, PlayerStats>& b) {
+            return a.second.bytesFrom + a.second.bytesTo > b.second.bytesFrom + b.second.bytesTo;
+        });
+        for (const auto& pair : players) {
+            printf("  %10u %10llu %12s %10llu %12s\n", pair.first,
+                (unsigned long long)pair.second.packetsFrom, FormatBytes((double)pair.second.bytesFrom).c_str(),
+                (unsigned long long)pair.second.packetsTo, FormatBytes((double)pair.second.bytesTo).c_str());
+        }
+    }
+
+    // Sequential dump of every record, payload as hex
+    void WriteCsv(const uint8_t* base, const FileHeader& header, size_t blocks, const std::string& path) {
+        std::ofstream out(path);
+        out << "TimestampUs,Direction,PacketType,Size,SourcePlayer,DestPlayer,Captured,Flags,Payload\n";
+        static const char HEX[] = "0123456789abcdef";
+        std::string hex;
+
+        for (size_t b = 0; b < blocks; b++) {
+            const uint8_t* block = base + header.headerSize + b * (size_t)header.blockSize;
+            BlockHeader blockHeader;
+            memcpy(&blockHeader, block, sizeof(blockHeader));
+            if (blockHeader.magic != BLOCK_MAGIC) continue;
+
+            size_t offset = sizeof(BlockHeader);
+            for (uint32_t r = 0; r < blockHeader.recordCount && offset + sizeof(RecordHeader) <= blockHeader.usedBytes; r++) {
+                RecordHeader record;
+                memcpy(&record, block + offset, sizeof(record));
+                const uint8_t* payload = block + offset + sizeof(RecordHeader);
+                offset += sizeof(RecordHeader) + record.capturedLength;
+
+                hex.resize(record.capturedLength * 2);
+                for (uint16_t i = 0; i < record.capturedLength; i++) {
+                    hex[i * 2] = HEX[payload[i] >> 4];
+                    hex[i * 2 + 1] = HEX[payload[i] & 0xF];
+                }
+                out << record.timestampUs << "," << (record.direction == 0 ? "RECV" : "SEND") << ","
+                    << std::hex << record.type << std::dec << "," << record.size << ","
+                    << record.sourcePlayerId << "," << record.destPlayerId << ","
+                    << record.capturedLength << "," << (int)record.flags << "," << hex << "\n";
+            }
+        }
+        printf("\nWrote CSV: %s\n", path.c_str());
+    }
+
+    // Synthetic capture: a few packet types at different rates, 8 players, bursty traffic
+    int Synthesize(const Options& options) {
+        std::ofstream out(options.synthesizePath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            fprintf(stderr, "Cannot write %s\n", options.synthesizePath.c_str());
+            return 1;
+        }
+
+        const uint32_t snapLength = 256;
+        FileHeader header = MakeFileHeader(DEFAULT_BLOCK_SIZE, snapLength, 0);
+        out.write((const char*)&header, sizeof(header));
+        BlockWriter writer(out, DEFAULT_BLOCK_SIZE);
+
+        std::mt19937_64 rng(42);
+        const uint32_t types[] = { 0x10, 0x11, 0x20, 0x31, 0x40 };
+        const double meanGapUs[] = { 16667.0, 50000.0, 100000.0, 1000000.0, 250000.0 };
+        double nextUs[5] = { 0, 0, 0, 0, 0 };
+        std::vector<uint8_t> payload(snapLength);
+
+        for (uint64_t i = 0; i < options.synthesizePackets; i++) {
+            int t = (int)(std::min_element(nextUs, nextUs + 5) - nextUs);
+            std::exponential_distribution<double> gap(1.0 / meanGapUs[t]);
+
+            RecordHeader record;
+            record.timestampUs = (uint64_t)nextUs[t];
+            record.type = types[t];
+            record.size = 24 + (uint32_t)(rng() % 400);
+            record.sourcePlayerId = (uint32_t)(rng() % 8);
+            record.destPlayerId = (uint32_t)(rng() % 8);
+            record.direction = (uint8_t)(rng() & 1);
+            record.capturedLength = (uint16_t)std::min(record.size, snapLength);
+            record.flags = record.size > snapLength ? FLAG_TRUNCATED : 0;
+            for (uint16_t k = 0; k < record.capturedLength; k++) payload[k] = (uint8_t)(i + k);
+            writer.Append(record, payload.data());
+
+            nextUs[t] += gap(rng);
+        }
+        writer.Flush();
+        printf("Wrote %llu synthetic packets in %u blocks to %s\n",
+            (unsigned long long)options.synthesizePackets, writer.GetBlocksWritten(), options.synthesizePath.c_str());
+        return 0;
+    }
+
+    bool ParseOptions(int argc, char** argv, Options& options) {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (arg == "--threads" && hasValue) options.threads = (unsigned)std::atoi(argv[++i]);
+            else if (arg == "--bucket-ms" && hasValue) options.bucketUs = std::max(1, std::atoi(argv[++i])) * 1000ULL;
+            else if (arg == "--rows" && hasValue) options.rows = (size_t)std::max(1, std::atoi(argv[++i]));
+            else if (arg == "--csv" && hasValue) options.csvPath = argv[++i];
+            else if (arg == "--synthesize" && hasValue) options.synthesizePath = argv[++i];
+            else if (arg == "--packets" && hasValue) options.synthesizePackets = std::strtoull(argv[++i], nullptr, 10);
+            else if (!arg.empty() && arg[0] != '-') options.path = arg;
+            else return false;
+        }
+        return !options.path.empty() || !options.synthesizePath.empty();
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        fprintf(stderr, "Usage: %s capture.tfcap [--threads N] [--bucket-ms MS] [--rows R] [--csv out.csv]\n"
+                        "       %s --synthesize out.tfcap [--packets N]\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    if (!options.synthesizePath.empty()) {
+        return Synthesize(options);
+    }
+
+    int fd = open(options.path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        perror("open");
+        return 1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(FileHeader)) {
+        fprintf(stderr, "%s is too small to be a capture\n", options.path.c_str());
+        close(fd);
+        return 1;
+    }
+    size_t fileSize = (size_t)st.st_size;
+
+    const uint8_t* base = (const uint8_t*)mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+    madvise((void*)base, fileSize, MADV_SEQUENTIAL);
+
+    FileHeader header;
+    memcpy(&header, base, sizeof(header));
+    if (header.magic != FILE_MAGIC || header.version != VERSION || header.blockSize < sizeof(BlockHeader)) {
+        fprintf(stderr, "%s is not a version %u .tfcap capture\n", options.path.c_str(), VERSION);
+        munmap((void*)base, fileSize);
+        return 1;
+    }
+
+    // A trailing partial block means the game was still writing - ignore it
+    size_t blocks = (fileSize - header.headerSize) / header.blockSize;
+
+    unsigned threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = (unsigned)std::max<size_t>(1, std::min<size_t>(threads, blocks));
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Partial> partials(threads);
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; t++) {
+        size_t first = blocks * t / threads;
+        size_t last = blocks * (t + 1) / threads;
+        workers.emplace_back(ScanBlocks, base, std::cref(header), first, last, options.bucketUs, std::ref(partials[t]));
+    }
+    for (auto& worker : workers) worker.join();
+
+    Partial total = std::move(partials[0]);
+    for (unsigned t = 1; t < threads; t++) {
+        Merge(total, partials[t]);
+    }
+    double scanSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    PrintReport(header, total, options, scanSeconds, fileSize);
+
+    if (!options.csvPath.empty()) {
+        WriteCsv(base, header, blocks, options.csvPath);
+    }
+
+    munmap((void*)base, fileSize);
+    return 0;
+}
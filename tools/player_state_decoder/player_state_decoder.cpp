@@ -0,0 +1,365 @@
+// player_state_decoder.cpp
+// Decoder for per-race rider state recordings (.tfstate, player_state_format.h).
+//
+// Every chunk is decoded back into full frames (tick, time, and each rider's position,
+// velocity, checkpoint and flags), so a race can be replayed or plotted offline.
+//
+// Reports:
+//   - file size, ticks, duration and bytes per rider sample
+//   - per-rider distance, top speed and last checkpoint
+//
+// Build (Linux):
+//   g++ -std=c++14 -O2 -I../../TFPayload player_state_decoder.cpp -o player_state_decoder
+// Run:
+//   ./player_state_decoder race.tfstate [--csv out.csv]               (replay every frame to CSV)
+//   ./player_state_decoder --synthesize out.tfstate [--riders N] [--seconds S] [--hz H]
+//                                                                     (write a test race and verify it)
+
+#include "player_state_format.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+    using namespace PlayerStateFormat;
+
+    struct Options {
+        std::string path;
+        std::string csvPath;
+        std::string synthesizePath;
+        int riders = 8;
+        int seconds = 180;
+        int hz = 60;
+    };
+
+    bool ParseOptions(int argc, char** argv, Options& options) {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (arg == "--csv" && hasValue) {
+                options.csvPath = argv[++i];
+            } else if (arg == "--synthesize" && hasValue) {
+                options.synthesizePath = argv[++i];
+            } else if (arg == "--riders" && hasValue) {
+                options.riders = std::max(1, std::min(MAX_RIDERS, atoi(argv[++i])));
+            } else if (arg == "--seconds" && hasValue) {
+                options.seconds = std::max(1, atoi(argv[++i]));
+            } else if (arg == "--hz" && hasValue) {
+                options.hz = std::max(1, atoi(argv[++i]));
+            } else if (!arg.empty() && arg[0] != '-' && options.path.empty()) {
+                options.path = arg;
+            } else {
+                return false;
+            }
+        }
+        return !options.path.empty() || !options.synthesizePath.empty();
+    }
+
+    bool ReadFile(const std::string& path, std::vector<uint8_t>& data) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) return false;
+        file.seekg(0, std::ios::end);
+        data.resize((size_t)file.tellg());
+        file.seekg(0, std::ios::beg);
+        file.read((char*)data.data(), data.size());
+        return (bool)file;
+    }
+
+    // ============================================================================
+    // Replay - walk every frame of every chunk
+    // ============================================================================
+
+    struct RiderSummary {
+        uint32_t playerId = 0;
+        uint64_t samples = 0;
+        double distance = 0.0;
+        double topSpeed = 0.0;
+        uint32_t checkpoint = 0;
+        bool local = false;
+        bool hasPrevious = false;
+        float previous[3] = {};
+    };
+
+    struct Replay {
+        FileHeader header;
+        uint32_t chunks = 0;
+        uint64_t frames = 0;
+        uint64_t riderSamples = 0;
+        uint32_t firstTick = 0;
+        uint32_t lastTick = 0;
+        uint64_t lastTimeUs = 0;
+        bool truncated = false;             // Trailing chunk cut short (game still writing or crashed)
+        RiderSummary riders[MAX_RIDERS];
+    };
+
+    // Calls onFrame(frame) for every decoded frame; returns false if the header is unusable
+    template <typename OnFrame>
+    bool Decode(const std::vector<uint8_t>& data, Replay& replay, OnFrame onFrame) {
+        if (data.size() < sizeof(FileHeader)) return false;
+        memcpy(&replay.header, data.data(), sizeof(FileHeader));
+        const FileHeader& header = replay.header;
+        if (header.magic != FILE_MAGIC || header.version != VERSION || header.headerSize < sizeof(FileHeader)) {
+            return false;
+        }
+
+        size_t offset = header.headerSize;
+        Frame frame;
+        while (offset + sizeof(ChunkHeader) <= data.size()) {
+            ChunkHeader chunk;
+            memcpy(&chunk, data.data() + offset, sizeof(chunk));
+            offset += sizeof(chunk);
+            if (chunk.magic != CHUNK_MAGIC || offset + chunk.payloadBytes > data.size()) {
+                replay.truncated = true;
+                break;
+            }
+
+            ChunkDecoder decoder(header, chunk, data.data() + offset);
+            uint32_t decoded = 0;
+            while (decoder.Next(frame)) {
+                if (replay.frames == 0) replay.firstTick = frame.tick;
+                replay.lastTick = frame.tick;
+                replay.lastTimeUs = frame.timeUs;
+                replay.frames++;
+                decoded++;
+                onFrame(frame);
+            }
+            if (decoded != chunk.frameCount) replay.truncated = true;
+            offset += chunk.payloadBytes;
+            replay.chunks++;
+        }
+        if (offset < data.size()) replay.truncated = true;
+        return true;
+    }
+
+    void Accumulate(Replay& replay, const Frame& frame) {
+        for (int slot = 0; slot < MAX_RIDERS; slot++) {
+            if (!(frame.presentMask & (1u << slot))) {
+                replay.riders[slot].hasPrevious = false;
+                continue;
+            }
+            const RiderSample& sample = frame.riders[slot];
+            RiderSummary& rider = replay.riders[slot];
+            rider.playerId = sample.playerId;
+            rider.samples++;
+            rider.checkpoint = sample.checkpointIndex;
+            rider.local = rider.local || (sample.flags & RIDER_LOCAL) != 0;
+            if (rider.hasPrevious) {
+                double dx = sample.position[0] - rider.previous[0];
+                double dy = sample.position[1] - rider.previous[1];
+                double dz = sample.position[2] - rider.previous[2];
+                rider.distance += std::sqrt(dx * dx + dy * dy + dz * dz);
+            }
+            double speed = std::sqrt((double)sample.velocity[0] * sample.velocity[0] +
+                                     (double)sample.velocity[1] * sample.velocity[1] +
+                                     (double)sample.velocity[2] * sample.velocity[2]);
+            rider.topSpeed = std::max(rider.topSpeed, speed);
+            memcpy(rider.previous, sample.position, sizeof(rider.previous));
+            rider.hasPrevious = true;
+            replay.riderSamples++;
+        }
+    }
+
+    void PrintSummary(const Replay& replay, size_t fileSize) {
+        const FileHeader& header = replay.header;
+        time_t start = (time_t)(header.startUnixMicros / 1000000);
+        char startText[32] = "?";
+        strftime(startText, sizeof(startText), "%Y-%m-%d %H:%M:%S", localtime(&start));
+        char track[sizeof(header.trackName) + 1] = {};
+        memcpy(track, header.trackName, sizeof(header.trackName));
+
+        double seconds = replay.lastTimeUs / 1e6;
+        printf("Race:      %s  track %s\n", startText, track[0] ? track : "(unknown)");
+        printf("Quantum:   position %.5f, velocity %.5f\n", header.positionQuantum, header.velocityQuantum);
+        printf("Recorded:  %llu ticks (%u..%u) over %.1f s in %u chunks%s\n",
+               (unsigned long long)replay.frames, replay.firstTick, replay.lastTick, seconds, replay.chunks,
+               replay.truncated ? " - trailing data truncated" : "");
+        printf("Size:      %zu bytes, %.2f bytes per rider sample (%llu samples)\n", fileSize,
+               replay.riderSamples ? (double)fileSize / replay.riderSamples : 0.0,
+               (unsigned long long)replay.riderSamples);
+
+        printf("\n%-5s %-10s %-6s %10s %12s %11s %10s\n", "Slot", "Player", "Local", "Samples", "Distance", "TopSpeed", "Checkpoint");
+        for (int slot = 0; slot < MAX_RIDERS; slot++) {
+            const RiderSummary& rider = replay.riders[slot];
+            if (rider.samples == 0) continue;
+            printf("%-5d %-10u %-6s %10llu %12.1f %11.2f %10u\n", slot, rider.playerId, rider.local ? "yes" : "",
+                   (unsigned long long)rider.samples, rider.distance, rider.topSpeed, rider.checkpoint);
+        }
+    }
+
+    // ============================================================================
+    // Synthetic race - encode, write, decode and compare
+    // ============================================================================
+
+    // Riders lapping a hilly loop at slightly different speeds, with a little physics jitter
+    void SimulateRider(int slot, double t, std::mt19937& rng, RiderSample& rider) {
+        std::normal_distribution<float> jitter(0.0f, 0.002f);
+        double speed = 0.05 + slot * 0.002;
+        double angle = t * speed;
+        double radius = 120.0 + 15.0 * std::sin(angle * 3.0);
+        rider.playerId = 1000 + (uint32_t)slot;
+        rider.position[0] = (float)(radius * std::cos(angle)) + jitter(rng);
+        rider.position[1] = (float)(8.0 * std::sin(angle * 7.0) + 3.0 * std::sin(t * 1.3 + slot)) + jitter(rng);
+        rider.position[2] = (float)(radius * std::sin(angle)) + jitter(rng);
+        rider.velocity[0] = (float)(-radius * speed * std::sin(angle)) + jitter(rng);
+        rider.velocity[1] = (float)(56.0 * speed * std::cos(angle * 7.0) + 3.9 * std::cos(t * 1.3 + slot)) + jitter(rng);
+        rider.velocity[2] = (float)(radius * speed * std::cos(angle)) + jitter(rng);
+        rider.checkpointIndex = (uint32_t)(angle / (2.0 * M_PI) * 20.0);
+        rider.flags = (uint8_t)(RIDER_READY | (slot == 0 ? RIDER_LOCAL : 0));
+    }
+
+    int Synthesize(const Options& options) {
+        const float positionQuantum = 1.0f / 512.0f;
+        const float velocityQuantum = 1.0f / 256.0f;
+        const uint16_t chunkTicks = 600;
+        uint32_t ticks = (uint32_t)(options.seconds * options.hz);
+        uint32_t presentMask = options.riders >= 32 ? 0xFFFFFFFFu : (1u << options.riders) - 1;
+
+        // Generate first so the timing below only covers encoding
+        std::mt19937 rng(1234);
+        std::vector<RiderSample> samples((size_t)ticks * MAX_RIDERS);
+        for (uint32_t tick = 0; tick < ticks; tick++) {
+            for (int slot = 0; slot < options.riders; slot++) {
+                SimulateRider(slot, (double)tick / options.hz, rng, samples[(size_t)tick * MAX_RIDERS + slot]);
+            }
+        }
+
+        std::ofstream out(options.synthesizePath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            perror("open");
+            return 1;
+        }
+        FileHeader header = MakeFileHeader(chunkTicks, positionQuantum, velocityQuantum,
+                                           (uint64_t)time(nullptr) * 1000000, "synthetic");
+        out.write((const char*)&header, sizeof(header));
+
+        ChunkEncoder encoder(positionQuantum, velocityQuantum);
+        double encodeSeconds = 0.0;
+        auto seal = [&]() {
+            ChunkHeader chunk = encoder.MakeHeader();
+            out.write((const char*)&chunk, sizeof(chunk));
+            out.write((const char*)encoder.GetPayload().data(), encoder.GetPayload().size());
+        };
+        for (uint32_t tick = 0; tick < ticks; tick++) {
+            auto start = std::chrono::steady_clock::now();
+            if (encoder.GetFrameCount() >= chunkTicks) {
+                encodeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                seal();
+                start = std::chrono::steady_clock::now();
+                encoder.Begin(tick);
+            } else if (encoder.GetFrameCount() == 0) {
+                encoder.Begin(tick);
+            }
+            uint64_t timeUs = (uint64_t)tick * 1000000 / options.hz;
+            encoder.AddFrame(tick, timeUs, presentMask, &samples[(size_t)tick * MAX_RIDERS]);
+            encodeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        if (encoder.GetFrameCount() > 0) seal();
+        out.close();
+
+        // Decode what was written and compare against the source samples
+        std::vector<uint8_t> data;
+        if (!ReadFile(options.synthesizePath, data)) {
+            fprintf(stderr, "Could not read back %s\n", options.synthesizePath.c_str());
+            return 1;
+        }
+        Replay replay;
+        double maxPositionError = 0.0;
+        double maxVelocityError = 0.0;
+        uint64_t mismatches = 0;
+        bool ok = Decode(data, replay, [&](const Frame& frame) {
+            Accumulate(replay, frame);
+            if (frame.tick >= ticks || frame.presentMask != presentMask) {
+                mismatches++;
+                return;
+            }
+            for (int slot = 0; slot < options.riders; slot++) {
+                const RiderSample& expected = samples[(size_t)frame.tick * MAX_RIDERS + slot];
+                const RiderSample& actual = frame.riders[slot];
+                for (int i = 0; i < 3; i++) {
+                    maxPositionError = std::max(maxPositionError, (double)std::fabs(expected.position[i] - actual.position[i]));
+                    maxVelocityError = std::max(maxVelocityError, (double)std::fabs(expected.velocity[i] - actual.velocity[i]));
+                }
+                if (expected.playerId != actual.playerId || expected.checkpointIndex != actual.checkpointIndex ||
+                    expected.flags != actual.flags) {
+                    mismatches++;
+                }
+            }
+        });
+
+        PrintSummary(replay, data.size());
+        uint64_t riderTicks = (uint64_t)ticks * options.riders;
+        printf("\nEncode:    %.1f ns per rider per tick\n", encodeSeconds * 1e9 / riderTicks);
+        printf("Max error: position %.5f (quantum/2 %.5f), velocity %.5f (quantum/2 %.5f)\n",
+               maxPositionError, positionQuantum / 2, maxVelocityError, velocityQuantum / 2);
+
+        bool exact = ok && !replay.truncated && replay.frames == ticks && mismatches == 0 &&
+                     maxPositionError <= positionQuantum / 2 * 1.01 && maxVelocityError <= velocityQuantum / 2 * 1.01;
+        printf("Round trip: %s\n", exact ? "OK" : "FAILED");
+        return exact ? 0 : 1;
+    }
+
+    bool WriteCsv(const std::string& path, const std::vector<uint8_t>& data) {
+        FILE* csv = fopen(path.c_str(), "w");
+        if (!csv) return false;
+        fprintf(csv, "Tick,TimeUs,Slot,PlayerId,PosX,PosY,PosZ,VelX,VelY,VelZ,Checkpoint,Flags\n");
+        Replay replay;
+        Decode(data, replay, [&](const Frame& frame) {
+            for (int slot = 0; slot < MAX_RIDERS; slot++) {
+                if (!(frame.presentMask & (1u << slot))) continue;
+                const RiderSample& rider = frame.riders[slot];
+                fprintf(csv, "%u,%llu,%d,%u,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%u,%u\n",
+                        frame.tick, (unsigned long long)frame.timeUs, slot, rider.playerId,
+                        rider.position[0], rider.position[1], rider.position[2],
+                        rider.velocity[0], rider.velocity[1], rider.velocity[2],
+                        rider.checkpointIndex, rider.flags);
+            }
+        });
+        fclose(csv);
+        return true;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        fprintf(stderr, "Usage: %s race.tfstate [--csv out.csv]\n"
+                        "       %s --synthesize out.tfstate [--riders N] [--seconds S] [--hz H]\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    if (!options.synthesizePath.empty()) {
+        return Synthesize(options);
+    }
+
+    std::vector<uint8_t> data;
+    if (!ReadFile(options.path, data)) {
+        fprintf(stderr, "Could not read %s\n", options.path.c_str());
+        return 1;
+    }
+
+    Replay replay;
+    if (!Decode(data, replay, [&](const Frame& frame) { Accumulate(replay, frame); })) {
+        fprintf(stderr, "%s is not a version %u .tfstate recording\n", options.path.c_str(), VERSION);
+        return 1;
+    }
+    PrintSummary(replay, data.size());
+
+    if (!options.csvPath.empty()) {
+        if (!WriteCsv(options.csvPath, data)) {
+            fprintf(stderr, "Could not write %s\n", options.csvPath.c_str());
+            return 1;
+        }
+        printf("\nWrote %llu frames to %s\n", (unsigned long long)replay.frames, options.csvPath.c_str());
+    }
+    return 0;
+}
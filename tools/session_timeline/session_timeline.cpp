@@ -0,0 +1,645 @@
+// session_timeline.cpp
+// Phase reconstruction for session timelines (.tftl) written by SessionTimeline.
+//
+// Replays the typed hook events through a small state machine and splits every multiplayer
+// session into matchmaking -> lobby -> (load -> race -> results) x rounds, so the time between
+// leaving the lobby and the race actually starting can be compared across sessions.
+//
+// Phase boundaries:
+//   matchmaking  JoinMode / RankedRequested / PrivateCreated / MatchmakingStarted / SessionJoin
+//   lobby        LobbyOnline / LobbyLocal
+//   load         first of LobbyToRace, PrivateStarted, GameStartBroadcast, RaceLoading,
+//                StartRace, LoadAndStartRace
+//   race         GameState >= 6 (or LoadAndStartRaceReturned when no race states were recorded)
+//   results      GameState >= 9, until the next lobby, matchmaking or menu event
+//
+// Reports:
+//   - per session: id, start time, rounds and time spent in each phase
+//   - per round: lobby wait, load, race and results durations
+//   - load breakdown: when each launch hook fired, relative to the start of the load
+//   - min / mean / p50 / max of every phase across the file
+//
+// Build (Linux):
+//   g++ -std=c++14 -O2 -I../../TFPayload session_timeline.cpp -o session_timeline
+// Run:
+//   ./session_timeline mp_timeline.tftl [--csv rounds.csv] [--events]
+//   ./session_timeline --synthesize out.tftl [--sessions N]     (write a test timeline and verify it)
+
+#include "session_timeline_format.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+    using namespace SessionTimelineFormat;
+
+    enum Phase {
+        PHASE_IDLE,
+        PHASE_MATCHMAKING,
+        PHASE_LOBBY,
+        PHASE_LOAD,
+        PHASE_RACE,
+        PHASE_RESULTS,
+        PHASE_COUNT
+    };
+
+    const char* const PHASE_NAMES[PHASE_COUNT] = { "idle", "matchmaking", "lobby", "load", "race", "results" };
+
+    // Hooks whose offset from the start of the load is reported in the breakdown
+    const uint16_t LOAD_MILESTONES[] = {
+        EVENT_LOBBY_START, EVENT_LOBBY_TO_RACE, EVENT_PRIVATE_STARTED, EVENT_GAME_START_BROADCAST,
+        EVENT_GAME_START_BY_MODE, EVENT_RACE_LOADING, EVENT_START_RACE, EVENT_LOAD_AND_START,
+        EVENT_MULTIPLAYER_SESSION_START, EVENT_LOAD_AND_START_RETURNED
+    };
+    const int MILESTONE_COUNT = sizeof(LOAD_MILESTONES) / sizeof(LOAD_MILESTONES[0]);
+
+    struct Options {
+        std::string path;
+        std::string csvPath;
+        std::string synthesizePath;
+        bool events = false;
+        int sessions = 20;
+    };
+
+    bool ParseOptions(int argc, char** argv, Options& options) {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (arg == "--csv" && hasValue) {
+                options.csvPath = argv[++i];
+            } else if (arg == "--synthesize" && hasValue) {
+                options.synthesizePath = argv[++i];
+            } else if (arg == "--sessions" && hasValue) {
+                options.sessions = std::max(1, atoi(argv[++i]));
+            } else if (arg == "--events") {
+                options.events = true;
+            } else if (!arg.empty() && arg[0] != '-' && options.path.empty()) {
+                options.path = arg;
+            } else {
+                return false;
+            }
+        }
+        return !options.path.empty() || !options.synthesizePath.empty();
+    }
+
+    bool ReadTimeline(const std::string& path, FileHeader& header, std::vector<Event>& events, bool& truncated) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) return false;
+        file.seekg(0, std::ios::end);
+        size_t size = (size_t)file.tellg();
+        file.seekg(0, std::ios::beg);
+        if (size < sizeof(FileHeader)) return false;
+
+        file.read((char*)&header, sizeof(header));
+        if (header.magic != FILE_MAGIC || header.version != VERSION ||
+            header.headerSize < sizeof(FileHeader) || header.eventSize < sizeof(Event)) {
+            return false;
+        }
+
+        size_t count = (size - header.headerSize) / header.eventSize;
+        truncated = (size - header.headerSize) % header.eventSize != 0;
+        events.resize(count);
+        std::vector<char> record(header.eventSize);
+        file.seekg(header.headerSize, std::ios::beg);
+        for (size_t i = 0; i < count; i++) {
+            file.read(record.data(), record.size());
+            memcpy(&events[i], record.data(), sizeof(Event));
+        }
+        return (bool)file;
+    }
+
+    // ============================================================================
+    // Reconstruction
+    // ============================================================================
+
+    struct Round {
+        uint64_t lobbyUs = 0;                   // Lobby wait before this load
+        uint64_t phaseStartUs[PHASE_COUNT] = {};
+        uint64_t phaseUs[PHASE_COUNT] = {};
+        int64_t milestoneUs[MILESTONE_COUNT];   // Offset from load start (-1 = did not fire)
+        bool reachedRace = false;
+        bool reachedResults = false;
+
+        Round() {
+            for (int i = 0; i < MILESTONE_COUNT; i++) milestoneUs[i] = -1;
+        }
+    };
+
+    struct Session {
+        uint32_t sessionId = 0;
+        uint64_t startUs = 0;
+        uint64_t endUs = 0;
+        const char* mode = "?";
+        const char* endReason = "eof";
+        uint64_t phaseUs[PHASE_COUNT] = {};
+        uint32_t networkEvents = 0;
+        std::vector<Round> rounds;
+    };
+
+    class Reconstructor {
+    public:
+        explicit Reconstructor(bool useGameState) : m_useGameState(useGameState) {}
+
+        void Feed(const Event& event) {
+            uint64_t t = event.timeMicros;
+            switch (event.type) {
+                case EVENT_MENU_OPENED:
+                    Close(t, "menu");
+                    break;
+
+                case EVENT_JOIN_MODE:
+                case EVENT_RANKED_REQUESTED:
+                case EVENT_PRIVATE_CREATED:
+                case EVENT_MATCHMAKING_STARTED:
+                    // Queueing again after a race starts a new session
+                    if (m_phase == PHASE_LOBBY || m_phase == PHASE_RESULTS) Close(t, "requeue");
+                    Open(t);
+                    if (m_phase == PHASE_IDLE) Enter(PHASE_MATCHMAKING, t);
+                    NoteMode(event);
+                    break;
+
+                case EVENT_SESSION_INITIALIZED:
+                case EVENT_SESSION_CREATED:
+                case EVENT_SESSION_JOIN:
+                    Open(t);
+                    if (m_phase == PHASE_IDLE) Enter(PHASE_MATCHMAKING, t);
+                    if (event.type != EVENT_SESSION_INITIALIZED) Current().sessionId = event.arg0;
+                    break;
+
+                case EVENT_LOBBY_ONLINE:
+                case EVENT_LOBBY_LOCAL:
+                    Open(t);
+                    if (event.type == EVENT_LOBBY_LOCAL) Current().mode = "local";
+                    Enter(PHASE_LOBBY, t);
+                    break;
+
+                case EVENT_LOBBY_TO_RACE:
+                case EVENT_PRIVATE_STARTED:
+                case EVENT_GAME_START_BROADCAST:
+                case EVENT_RACE_LOADING:
+                case EVENT_START_RACE:
+                case EVENT_LOAD_AND_START:
+                    Open(t);
+                    if (m_phase != PHASE_LOAD && m_phase != PHASE_RACE) BeginRound(t);
+                    break;
+
+                case EVENT_LOAD_AND_START_RETURNED:
+                    if (!m_useGameState && m_phase == PHASE_LOAD) Enter(PHASE_RACE, t);
+                    break;
+
+                case EVENT_GAME_STATE:
+                    if (event.arg0 >= GAME_STATE_FINISHED) {
+                        if (m_phase == PHASE_LOAD || m_phase == PHASE_RACE) Enter(PHASE_RESULTS, t);
+                    } else if (event.arg0 >= GAME_STATE_RACING) {
+                        if (m_phase == PHASE_LOAD) Enter(PHASE_RACE, t);
+                    }
+                    break;
+
+                case EVENT_NETWORK:
+                    if (m_open) Current().networkEvents++;
+                    break;
+
+                default:
+                    break;
+            }
+            if (m_phase == PHASE_LOAD) NoteMilestone(event);
+            if (m_open && Current().sessionId == 0) Current().sessionId = event.sessionId;
+        }
+
+        void Finish(uint64_t endUs) {
+            Close(endUs, "eof");
+        }
+
+        const std::vector<Session>& GetSessions() const { return m_sessions; }
+
+    private:
+        Session& Current() { return m_sessions.back(); }
+
+        void Open(uint64_t t) {
+            if (m_open) return;
+            m_sessions.emplace_back();
+            Current().startUs = t;
+            m_open = true;
+            m_phase = PHASE_IDLE;
+            m_phaseStartUs = t;
+        }
+
+        void Enter(Phase phase, uint64_t t) {
+            if (phase == m_phase) return;
+            Leave(t);
+            m_phase = phase;
+            m_phaseStartUs = t;
+            if (!Current().rounds.empty() && phase >= PHASE_LOAD) {
+                Round& round = Current().rounds.back();
+                round.phaseStartUs[phase] = t;
+                if (phase == PHASE_RACE) round.reachedRace = true;
+                if (phase == PHASE_RESULTS) round.reachedResults = true;
+            }
+        }
+
+        // Credit the time since the last transition to the phase being left
+        void Leave(uint64_t t) {
+            if (!m_open) return;
+            uint64_t elapsed = t - m_phaseStartUs;
+            Current().phaseUs[m_phase] += elapsed;
+            if (m_phase == PHASE_LOBBY) m_lobbyWaitUs += elapsed;
+            if (m_phase >= PHASE_LOAD && !Current().rounds.empty()) {
+                Current().rounds.back().phaseUs[m_phase] += elapsed;
+            }
+        }
+
+        void BeginRound(uint64_t t) {
+            Leave(t);
+            m_phase = PHASE_IDLE;               // Already credited; Enter() must not credit it again
+            m_phaseStartUs = t;
+            Current().rounds.emplace_back();
+            Current().rounds.back().lobbyUs = m_lobbyWaitUs;
+            m_lobbyWaitUs = 0;
+            Enter(PHASE_LOAD, t);
+        }
+
+        void NoteMilestone(const Event& event) {
+            Round& round = Current().rounds.back();
+            for (int i = 0; i < MILESTONE_COUNT; i++) {
+                if (LOAD_MILESTONES[i] == event.type && round.milestoneUs[i] < 0) {
+                    round.milestoneUs[i] = (int64_t)(event.timeMicros - round.phaseStartUs[PHASE_LOAD]);
+                }
+            }
+        }
+
+        void NoteMode(const Event& event) {
+            Session& session = Current();
+            if (event.type == EVENT_RANKED_REQUESTED || (event.type == EVENT_JOIN_MODE && event.arg0 == 0)) {
+                session.mode = "ranked";
+            } else if (event.type == EVENT_PRIVATE_CREATED || (event.type == EVENT_JOIN_MODE && event.arg0 == 2)) {
+                session.mode = "private";
+            } else if (event.type == EVENT_JOIN_MODE && event.arg0 == 3) {
+                session.mode = "spectate";
+            }
+        }
+
+        void Close(uint64_t t, const char* reason) {
+            if (!m_open) return;
+            Leave(t);
+            Current().endUs = t;
+            Current().endReason = reason;
+            m_open = false;
+            m_phase = PHASE_IDLE;
+            m_lobbyWaitUs = 0;
+        }
+
+        bool m_useGameState;
+        bool m_open = false;
+        Phase m_phase = PHASE_IDLE;
+        uint64_t m_phaseStartUs = 0;
+        uint64_t m_lobbyWaitUs = 0;
+        std::vector<Session> m_sessions;
+    };
+
+    std::vector<Session> Reconstruct(const std::vector<Event>& events) {
+        bool useGameState = false;
+        for (const Event& event : events) {
+            if (event.type == EVENT_GAME_STATE) useGameState = true;
+        }
+        Reconstructor reconstructor(useGameState);
+        for (const Event& event : events) {
+            reconstructor.Feed(event);
+        }
+        reconstructor.Finish(events.empty() ? 0 : events.back().timeMicros);
+        return reconstructor.GetSessions();
+    }
+
+    // ============================================================================
+    // Reports
+    // ============================================================================
+
+    std::string FormatDuration(uint64_t us) {
+        char text[32];
+        if (us >= 60000000ULL) {
+            snprintf(text, sizeof(text), "%llum%04.1fs", (unsigned long long)(us / 60000000ULL), (us % 60000000ULL) / 1e6);
+        } else {
+            snprintf(text, sizeof(text), "%.2fs", us / 1e6);
+        }
+        return text;
+    }
+
+    std::string FormatWallClock(uint64_t unixMicros) {
+        time_t seconds = (time_t)(unixMicros / 1000000ULL);
+        struct tm local;
+        localtime_r(&seconds, &local);
+        char text[32];
+        strftime(text, sizeof(text), "%Y-%m-%d %H:%M:%S", &local);
+        return text;
+    }
+
+    struct Distribution {
+        std::vector<uint64_t> values;
+
+        void Add(uint64_t value) { values.push_back(value); }
+
+        void Print(const char* name) {
+            if (values.empty()) {
+                printf("  %-26s %6s\n", name, "-");
+                return;
+            }
+            std::sort(values.begin(), values.end());
+            uint64_t sum = 0;
+            for (uint64_t value : values) sum += value;
+            printf("  %-26s %6zu %10s %10s %10s %10s\n", name, values.size(),
+                   FormatDuration(values.front()).c_str(), FormatDuration(sum / values.size()).c_str(),
+                   FormatDuration(values[values.size() / 2]).c_str(), FormatDuration(values.back()).c_str());
+        }
+    };
+
+    void PrintEvents(const std::vector<Event>& events) {
+        printf("=== EVENTS ===\n");
+        for (const Event& event : events) {
+            printf("  %12.3fs  %-26s session 0x%08x  arg0 %u  arg1 %u\n", event.timeMicros / 1e6,
+                   GetEventName(event.type), event.sessionId, event.arg0, event.arg1);
+        }
+        printf("\n");
+    }
+
+    void PrintReport(const FileHeader& header, const std::vector<Event>& events, const std::vector<Session>& sessions) {
+        printf("=== SESSION TIMELINE ===\n");
+        printf("Started:  %s\n", FormatWallClock(header.startUnixMicros).c_str());
+        printf("Events:   %zu over %s\n", events.size(),
+               FormatDuration(events.empty() ? 0 : events.back().timeMicros).c_str());
+        printf("Sessions: %zu\n\n", sessions.size());
+
+        printf("=== SESSIONS ===\n");
+        printf("  %3s %-10s %-19s %-8s %6s %11s %10s %10s %10s %10s %9s  %s\n", "#", "Session", "Start", "Mode",
+               "Rounds", "Matchmaking", "Lobby", "Load", "Race", "Results", "NetEvents", "End");
+        for (size_t i = 0; i < sessions.size(); i++) {
+            const Session& s = sessions[i];
+            printf("  %3zu 0x%08x %-19s %-8s %6zu %11s %10s %10s %10s %10s %9u  %s\n", i + 1, s.sessionId,
+                   FormatWallClock(header.startUnixMicros + s.startUs).c_str(), s.mode, s.rounds.size(),
+                   FormatDuration(s.phaseUs[PHASE_MATCHMAKING]).c_str(), FormatDuration(s.phaseUs[PHASE_LOBBY]).c_str(),
+                   FormatDuration(s.phaseUs[PHASE_LOAD]).c_str(), FormatDuration(s.phaseUs[PHASE_RACE]).c_str(),
+                   FormatDuration(s.phaseUs[PHASE_RESULTS]).c_str(), s.networkEvents, s.endReason);
+        }
+
+        printf("\n=== ROUNDS ===\n");
+        printf("  %7s %10s %10s %10s %10s\n", "Round", "Lobby", "Load", "Race", "Results");
+        for (size_t i = 0; i < sessions.size(); i++) {
+            for (size_t r = 0; r < sessions[i].rounds.size(); r++) {
+                const Round& round = sessions[i].rounds[r];
+                char label[48];
+                snprintf(label, sizeof(label), "%zu.%zu", i + 1, r + 1);
+                printf("  %7s %10s %10s %10s %10s\n", label, FormatDuration(round.lobbyUs).c_str(),
+                       FormatDuration(round.phaseUs[PHASE_LOAD]).c_str(),
+                       round.reachedRace ? FormatDuration(round.phaseUs[PHASE_RACE]).c_str() : "-",
+                       round.reachedResults ? FormatDuration(round.phaseUs[PHASE_RESULTS]).c_str() : "-");
+            }
+        }
+
+        // Where the lobby-to-race time goes
+        printf("\n=== LOAD BREAKDOWN (offset from load start) ===\n");
+        printf("  %-26s %6s %10s %10s %10s %10s\n", "Hook", "Rounds", "Min", "Mean", "P50", "Max");
+        for (int m = 0; m < MILESTONE_COUNT; m++) {
+            Distribution offsets;
+            for (const Session& s : sessions) {
+                for (const Round& round : s.rounds) {
+                    if (round.milestoneUs[m] >= 0) offsets.Add((uint64_t)round.milestoneUs[m]);
+                }
+            }
+            if (!offsets.values.empty()) offsets.Print(GetEventName(LOAD_MILESTONES[m]));
+        }
+        Distribution raceStart;
+        for (const Session& s : sessions) {
+            for (const Round& round : s.rounds) {
+                if (round.reachedRace) raceStart.Add(round.phaseStartUs[PHASE_RACE] - round.phaseStartUs[PHASE_LOAD]);
+            }
+        }
+        raceStart.Print("(race started)");
+
+        printf("\n=== PHASE DURATIONS ===\n");
+        printf("  %-26s %6s %10s %10s %10s %10s\n", "Phase", "Count", "Min", "Mean", "P50", "Max");
+        Distribution phases[PHASE_COUNT];
+        for (const Session& s : sessions) {
+            if (s.phaseUs[PHASE_MATCHMAKING] > 0) phases[PHASE_MATCHMAKING].Add(s.phaseUs[PHASE_MATCHMAKING]);
+            for (const Round& round : s.rounds) {
+                phases[PHASE_LOBBY].Add(round.lobbyUs);
+                phases[PHASE_LOAD].Add(round.phaseUs[PHASE_LOAD]);
+                if (round.reachedRace) phases[PHASE_RACE].Add(round.phaseUs[PHASE_RACE]);
+                if (round.reachedResults) phases[PHASE_RESULTS].Add(round.phaseUs[PHASE_RESULTS]);
+            }
+        }
+        for (int p = PHASE_MATCHMAKING; p < PHASE_COUNT; p++) {
+            phases[p].Print(PHASE_NAMES[p]);
+        }
+    }
+
+    bool WriteCsv(const std::string& path, const std::vector<Session>& sessions) {
+        std::ofstream csv(path);
+        if (!csv.is_open()) return false;
+        csv << "Session,SessionId,Mode,Round,LobbyUs,LoadUs,RaceUs,ResultsUs";
+        for (int m = 0; m < MILESTONE_COUNT; m++) {
+            csv << "," << GetEventName(LOAD_MILESTONES[m]) << "Us";
+        }
+        csv << "\n";
+        for (size_t i = 0; i < sessions.size(); i++) {
+            const Session& s = sessions[i];
+            for (size_t r = 0; r < s.rounds.size(); r++) {
+                const Round& round = s.rounds[r];
+                csv << (i + 1) << "," << s.sessionId << "," << s.mode << "," << (r + 1) << ","
+                    << round.lobbyUs << "," << round.phaseUs[PHASE_LOAD] << ","
+                    << (round.reachedRace ? std::to_string(round.phaseUs[PHASE_RACE]) : "") << ","
+                    << (round.reachedResults ? std::to_string(round.phaseUs[PHASE_RESULTS]) : "");
+                for (int m = 0; m < MILESTONE_COUNT; m++) {
+                    csv << ",";
+                    if (round.milestoneUs[m] >= 0) csv << round.milestoneUs[m];
+                }
+                csv << "\n";
+            }
+        }
+        return (bool)csv;
+    }
+
+    // ============================================================================
+    // Synthetic timeline - ranked sessions with a few races each, phase lengths known up front
+    // ============================================================================
+
+    struct Expected {
+        uint64_t matchmakingUs = 0;
+        std::vector<uint64_t> lobbyUs, loadUs, raceUs, resultsUs;
+    };
+
+    int Synthesize(const Options& options) {
+        std::mt19937 rng(38);
+        std::uniform_int_distribution<uint64_t> matchmaking(5000000, 90000000);
+        std::uniform_int_distribution<uint64_t> lobby(10000000, 60000000);
+        std::uniform_int_distribution<uint64_t> step(20000, 900000);
+        std::uniform_int_distribution<uint64_t> load(3000000, 15000000);
+        std::uniform_int_distribution<uint64_t> race(60000000, 240000000);
+        std::uniform_int_distribution<uint64_t> results(5000000, 20000000);
+        std::uniform_int_distribution<int> roundCount(1, 4);
+
+        std::vector<Event> events;
+        std::vector<Expected> expected;
+        uint64_t t = 1000000;
+        uint32_t lastState = 0xFFFFFFFF;
+        auto emit = [&](uint16_t type, uint32_t sessionId, uint32_t arg0 = 0, uint32_t arg1 = 0) {
+            Event event = {};
+            event.timeMicros = t;
+            event.type = type;
+            event.sessionId = sessionId;
+            event.arg0 = arg0;
+            event.arg1 = arg1;
+            events.push_back(event);
+        };
+        auto gameState = [&](uint32_t sessionId, uint32_t state) {
+            emit(EVENT_GAME_STATE, sessionId, state, lastState);
+            lastState = state;
+        };
+
+        for (int s = 0; s < options.sessions; s++) {
+            Expected e;
+            uint32_t sessionId = 0x5E000000u + (uint32_t)s;
+            emit(EVENT_MENU_OPENED, 0);
+            t += step(rng);
+            uint64_t matchmakingStart = t;
+            emit(EVENT_JOIN_MODE, 0, 0, 0);
+            t += step(rng);
+            emit(EVENT_MATCHMAKING_STARTED, 0);
+            uint64_t queued = matchmaking(rng);
+            t += queued / 2;
+            emit(EVENT_SESSION_JOIN, sessionId, sessionId);
+            t += queued - queued / 2;
+            emit(EVENT_LOBBY_ONLINE, sessionId);
+            e.matchmakingUs = t - matchmakingStart;
+
+            int rounds = roundCount(rng);
+            for (int r = 0; r < rounds; r++) {
+                uint64_t lobbyUs = lobby(rng);
+                t += lobbyUs / 3;
+                emit(EVENT_NETWORK, sessionId, 0x12);
+                t += lobbyUs - lobbyUs / 3;
+                e.lobbyUs.push_back(lobbyUs);
+
+                uint64_t loadStart = t;
+                emit(EVENT_LOBBY_TO_RACE, sessionId, 1);
+                t += step(rng);
+                emit(EVENT_GAME_START_BROADCAST, sessionId);
+                t += step(rng);
+                emit(EVENT_START_RACE, sessionId);
+                t += step(rng) / 10;
+                emit(EVENT_LOAD_AND_START, sessionId, 1);
+                gameState(sessionId, 2);
+                t += load(rng);
+                emit(EVENT_LOAD_AND_START_RETURNED, sessionId, 1);
+                t += step(rng);
+                gameState(sessionId, GAME_STATE_RACING);
+                e.loadUs.push_back(t - loadStart);
+
+                uint64_t raceUs = race(rng);
+                t += raceUs;
+                gameState(sessionId, GAME_STATE_FINISHED);
+                e.raceUs.push_back(raceUs);
+
+                uint64_t resultsUs = results(rng);
+                t += resultsUs;
+                e.resultsUs.push_back(resultsUs);
+                emit(EVENT_LOBBY_ONLINE, sessionId);
+                gameState(sessionId, 0);
+            }
+            t += step(rng);
+            expected.push_back(e);
+        }
+        emit(EVENT_MENU_OPENED, 0);
+
+        std::ofstream file(options.synthesizePath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            fprintf(stderr, "Could not write %s\n", options.synthesizePath.c_str());
+            return 1;
+        }
+        FileHeader header = MakeFileHeader((uint64_t)time(nullptr) * 1000000ULL);
+        file.write((const char*)&header, sizeof(header));
+        file.write((const char*)events.data(), events.size() * sizeof(Event));
+        file.close();
+        printf("Wrote %zu events (%d sessions) to %s\n\n", events.size(), options.sessions, options.synthesizePath.c_str());
+
+        // Read it back and check every phase against what was generated
+        FileHeader readHeader;
+        std::vector<Event> readEvents;
+        bool truncated = false;
+        if (!ReadTimeline(options.synthesizePath, readHeader, readEvents, truncated) || truncated) {
+            fprintf(stderr, "Could not read back %s\n", options.synthesizePath.c_str());
+            return 1;
+        }
+        std::vector<Session> sessions = Reconstruct(readEvents);
+        PrintReport(readHeader, readEvents, sessions);
+
+        int mismatches = 0;
+        if (sessions.size() != expected.size()) {
+            fprintf(stderr, "Expected %zu sessions, reconstructed %zu\n", expected.size(), sessions.size());
+            return 1;
+        }
+        for (size_t s = 0; s < sessions.size(); s++) {
+            const Session& session = sessions[s];
+            const Expected& e = expected[s];
+            if (session.phaseUs[PHASE_MATCHMAKING] != e.matchmakingUs || session.rounds.size() != e.lobbyUs.size()) {
+                mismatches++;
+                continue;
+            }
+            for (size_t r = 0; r < session.rounds.size(); r++) {
+                const Round& round = session.rounds[r];
+                if (round.lobbyUs != e.lobbyUs[r] || round.phaseUs[PHASE_LOAD] != e.loadUs[r] ||
+                    round.phaseUs[PHASE_RACE] != e.raceUs[r] || round.phaseUs[PHASE_RESULTS] != e.resultsUs[r]) {
+                    mismatches++;
+                }
+            }
+        }
+        printf("\nRound trip: %s\n", mismatches == 0 ? "OK (every phase matches)" : "MISMATCH");
+        return mismatches == 0 ? 0 : 1;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        fprintf(stderr, "Usage: %s mp_timeline.tftl [--csv rounds.csv] [--events]\n"
+                        "       %s --synthesize out.tftl [--sessions N]\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    if (!options.synthesizePath.empty()) {
+        return Synthesize(options);
+    }
+
+    FileHeader header;
+    std::vector<Event> events;
+    bool truncated = false;
+    if (!ReadTimeline(options.path, header, events, truncated)) {
+        fprintf(stderr, "%s is not a version %u .tftl timeline\n", options.path.c_str(), VERSION);
+        return 1;
+    }
+    if (truncated) {
+        printf("Note: trailing partial event ignored (game still writing or crashed)\n\n");
+    }
+
+    if (options.events) {
+        PrintEvents(events);
+    }
+    std::vector<Session> sessions = Reconstruct(events);
+    PrintReport(header, events, sessions);
+
+    if (!options.csvPath.empty()) {
+        if (!WriteCsv(options.csvPath, sessions)) {
+            fprintf(stderr, "Could not write %s\n", options.csvPath.c_str());
+            return 1;
+        }
+        size_t rounds = 0;
+        for (const Session& s : sessions) rounds += s.rounds.size();
+        printf("\nWrote %zu rounds to %s\n", rounds, options.csvPath.c_str());
+    }
+    return 0;
+}
@@ -0,0 +1,13 @@
+#pragma once
+// Linux stand-in for the few Windows names tweakable_journal.cpp and devMenuSync.h use, so
+// tweakable_journal_test can build the real journal. The test drives the clock.
+#include <cstdint>
+
+typedef unsigned long DWORD;
+
+DWORD GetTickCount();
+
+// devMenuSync.h reads and writes game memory under SEH; plain memory here never faults
+#define __try try
+#define __except(filter) catch (...)
+#define EXCEPTION_EXECUTE_HANDLER 1
@@ -0,0 +1,169 @@
+// tweakable_journal_test.cpp
+// Checks that a preset applied through TweakableJournal survives live sync.
+//
+// Each simulated frame runs the render callback's order: GameThread::Drain (where a preset is
+// applied as one journal batch), DevMenuSync::ApplyLiveChanges (the poller reports every slot
+// changed, since the last Flush rewrote them) and TweakableJournal::Flush. Presets A and B are
+// switched every frame; after each Flush the fake game memory must hold the preset just
+// applied, and one Undo must restore the previous preset as a single step. The live apply is
+// replayed as ApplyLiveChanges does it, with and without the pending check, to show the check
+// is what keeps the preset.
+//
+// Build (Linux):
+//   g++ -std=c++14 -O2 -I. -I../../TFPayload -DPCH_H tweakable_journal_test.cpp
+//       ../../TFPayload/tweakable_journal.cpp -o tweakable_journal_test
+// Run:
+//   ./tweakable_journal_test [--slots N] [--frames N]
+
+#include "tweakable_journal.h"
+#include "devMenuSync.h"
+#include "logging.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// ============================================================================
+// Stand-ins for the payload modules the journal calls
+// ============================================================================
+
+static DWORD g_tick = 0;
+
+DWORD GetTickCount() {
+    return g_tick;
+}
+
+namespace Logging {
+    bool IsVerboseEnabled() { return false; }
+    void WriteToFile(const std::string&) {}
+}
+
+namespace DevMenuSync {
+    std::unordered_map<int, TweakableMemoryInfo> g_tweakableMemoryMap;
+
+    TweakableMemoryInfo* GetMemoryInfo(int tweakableId) {
+        auto it = g_tweakableMemoryMap.find(tweakableId);
+        return it != g_tweakableMemoryMap.end() ? &it->second : nullptr;
+    }
+
+    size_t WriteBatch(void* const* addresses, const uint32_t* values, size_t count) {
+        size_t written = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (!addresses[i]) continue;
+            *(uint32_t*)addresses[i] = values[i];
+            written++;
+        }
+        return written;
+    }
+}
+
+namespace {
+
+    struct Options {
+        int slots = 64;
+        int frames = 200;
+    };
+
+    struct Fixture {
+        TweakableRegistry registry;
+        TweakableJournal journal;
+        std::vector<int32_t> game;                  // Fake game memory, one value per slot
+
+        explicit Fixture(int slots) : game(slots, 0) {
+            DevMenuSync::g_tweakableMemoryMap.clear();
+            for (int i = 0; i < slots; i++) {
+                uint32_t slot = registry.Add(i, TweakableType::Int, "Value", TweakableRegistry::INVALID_SLOT,
+                    TweakableValue::Int(0), TweakableValue::Int(0), TweakableValue::Int(1000), &journal);
+                registry.SetGameValue(slot, &game[i]);
+                DevMenuSync::g_tweakableMemoryMap[i] = DevMenuSync::TweakableMemoryInfo{ &game[i], 2, 0, true };
+            }
+            registry.EndMenu();
+            journal.Bind(&registry);
+        }
+
+        // GameThread::Drain - the preset lambda from TweakablePresets::QueueApply
+        void ApplyPreset(int32_t base) {
+            journal.BeginBatch("Preset");
+            for (uint32_t slot = 0; slot < registry.GetCount(); slot++) {
+                journal.Set(slot, TweakableValue::Int(base + (int32_t)slot));
+            }
+            journal.EndBatch();
+        }
+
+        // DevMenuSync::ApplyLiveChanges with every slot reported changed by the poller
+        void ApplyLiveChanges(bool skipPending) {
+            for (uint32_t slot = 0; slot < registry.GetCount(); slot++) {
+                if (skipPending && journal.IsPending(slot)) continue;
+                registry.SetInt(slot, game[slot]);
+            }
+        }
+
+        int CountMismatches(int32_t base) const {
+            int mismatches = 0;
+            for (size_t i = 0; i < game.size(); i++) {
+                if (game[i] != base + (int32_t)i) mismatches++;
+            }
+            return mismatches;
+        }
+    };
+
+    // Lost values over all frames of A/B switching
+    int RunSwitching(const Options& options, bool skipPending, bool* undoOk) {
+        const int32_t presets[2] = { 100, 500 };
+        Fixture fixture(options.slots);
+        int lost = 0;
+        *undoOk = true;
+
+        for (int frame = 0; frame < options.frames; frame++) {
+            g_tick += 16;
+            int32_t base = presets[frame & 1];
+
+            fixture.ApplyPreset(base);
+            fixture.ApplyLiveChanges(skipPending);
+            fixture.journal.Flush();
+            lost += fixture.CountMismatches(base);
+
+            // Undo the preset and redo it: the whole preset is one step each way
+            if (frame > 0 && skipPending) {
+                fixture.journal.Undo();
+                fixture.journal.Flush();
+                if (fixture.CountMismatches(presets[(frame + 1) & 1]) != 0) *undoOk = false;
+                fixture.journal.Redo();
+                fixture.journal.Flush();
+                if (fixture.CountMismatches(base) != 0) *undoOk = false;
+            }
+        }
+        return lost;
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--slots") && i + 1 < argc) options.slots = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--frames") && i + 1 < argc) options.frames = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "Usage: %s [--slots N] [--frames N]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (options.slots < 1 || options.frames < 2) {
+        fprintf(stderr, "Need at least 1 slot and 2 frames\n");
+        return 1;
+    }
+
+    bool undoOk = true;
+    int lostUnguarded = RunSwitching(options, false, &undoOk);
+    int lostGuarded = RunSwitching(options, true, &undoOk);
+    int total = options.slots * options.frames;
+
+    printf("Preset A/B switching, %d slots x %d frames, poller marking every slot dirty\n", options.slots, options.frames);
+    printf("Live apply overwrites pending slots: %d / %d values lost\n", lostUnguarded, total);
+    printf("Live apply skips pending slots:      %d / %d values lost\n", lostGuarded, total);
+    printf("Undo/redo of a preset as one step:   %s\n", undoOk ? "OK" : "FAILED");
+
+    bool ok = lostGuarded == 0 && undoOk;
+    printf("Result: %s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,490 @@
+// tweakable_registry_bench.cpp
+// Compares the flat TweakableRegistry behind DevMenu with the shared_ptr tree it replaced.
+//
+// Both sides get the same synthetic menu (root folders with nested folders of float/int/bool
+// tweakables and buttons, somewhat larger than the game's ~800 tweakables) and are timed on the four
+// whole-menu passes: SyncFromGame, one ImGui frame of the menu (all folders open and all
+// closed), SaveConfig and ResetAll. ImGui runs headless - no window, no renderer - so the
+// render numbers cover widget submission and draw list building only.
+//
+// Build (Linux):
+//   g++ -std=c++14 -O2 -I../../TFPayload tweakable_registry_bench.cpp ../../TFPayload/imgui/imgui.cpp
+//       ../../TFPayload/imgui/imgui_draw.cpp ../../TFPayload/imgui/imgui_widgets.cpp
+//       ../../TFPayload/imgui/imgui_tables.cpp -o tweakable_registry_bench
+// Run:
+//   ./tweakable_registry_bench [--roots N] [--items N] [--iterations N]
+
+#include "tweakable_registry.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+    // ========================================================================
+    // Legacy model (the DevMenu tweakable classes before the registry)
+    // ========================================================================
+
+    namespace Legacy {
+
+        class Item {
+        public:
+            Item(int id, const std::string& name, TweakableType type) : m_id(id), m_name(name), m_type(type) {}
+            virtual ~Item() = default;
+            int GetId() const { return m_id; }
+            TweakableType GetType() const { return m_type; }
+            virtual void Render() = 0;
+            virtual void Reset() = 0;
+        protected:
+            int m_id;
+            std::string m_name;
+            TweakableType m_type;
+        };
+
+        class Float : public Item {
+        public:
+            Float(int id, const std::string& name, float value, float minValue, float maxValue)
+                : Item(id, name, TweakableType::Float), m_value(value), m_default(value), m_min(minValue), m_max(maxValue) {}
+            float GetValue() const { return m_value; }
+            void SetValue(float value) { m_value = value; }
+            void Reset() override { m_value = m_default; }
+            void Render() override {
+                std::string label = m_name + "##" + std::to_string(m_id);
+                ImGui::PushItemWidth(200.0f);
+                if (ImGui::SliderFloat(("##" + label).c_str(), &m_value, m_min, m_max, "%.3f") && m_onChange) {
+                    m_onChange(m_value);
+                }
+                ImGui::PopItemWidth();
+                ImGui::SameLine();
+                ImGui::Text("%s", m_name.c_str());
+                if (m_value != m_default) {
+                    ImGui::SameLine();
+                    if (ImGui::SmallButton(("Reset##" + label).c_str())) m_value = m_default;
+                }
+                if (ImGui::IsItemClicked(1)) ImGui::OpenPopup(("Input##" + label).c_str());
+                if (ImGui::BeginPopup(("Input##" + label).c_str())) ImGui::EndPopup();
+            }
+            std::function<void(float)> m_onChange;
+        private:
+            float m_value, m_default, m_min, m_max;
+        };
+
+        class Int : public Item {
+        public:
+            Int(int id, const std::string& name, int value, int minValue, int maxValue)
+                : Item(id, name, TweakableType::Int), m_value(value), m_default(value), m_min(minValue), m_max(maxValue) {}
+            int GetValue() const { return m_value; }
+            void SetValue(int value) { m_value = value; }
+            void Reset() override { m_value = m_default; }
+            void Render() override {
+                std::string label = m_name + "##" + std::to_string(m_id);
+                ImGui::PushItemWidth(200.0f);
+                if (ImGui::SliderInt(("##" + label).c_str(), &m_value, m_min, m_max) && m_onChange) {
+                    m_onChange(m_value);
+                }
+                ImGui::PopItemWidth();
+                ImGui::SameLine();
+                ImGui::Text("%s", m_name.c_str());
+                if (m_value != m_default) {
+                    ImGui::SameLine();
+                    if (ImGui::SmallButton(("Reset##" + label).c_str())) m_value = m_default;
+                }
+                if (ImGui::IsItemClicked(1)) ImGui::OpenPopup(("Input##" + label).c_str());
+                if (ImGui::BeginPopup(("Input##" + label).c_str())) ImGui::EndPopup();
+            }
+            std::function<void(int)> m_onChange;
+        private:
+            int m_value, m_default, m_min, m_max;
+        };
+
+        class Bool : public Item {
+        public:
+            Bool(int id, const std::string& name, bool value) : Item(id, name, TweakableType::Bool), m_value(value), m_default(value) {}
+            bool GetValue() const { return m_value; }
+            void SetValue(bool value) { m_value = value; }
+            void Reset() override { m_value = m_default; }
+            void Render() override {
+                std::string label = m_name + "##" + std::to_string(m_id);
+                if (ImGui::Checkbox(label.c_str(), &m_value) && m_onChange) m_onChange(m_value);
+                if (m_value != m_default) {
+                    ImGui::SameLine();
+                    if (ImGui::SmallButton(("Reset##" + label).c_str())) m_value = m_default;
+                }
+            }
+            std::function<void(bool)> m_onChange;
+        private:
+            bool m_value, m_default;
+        };
+
+        class Button : public Item {
+        public:
+            Button(int id, const std::string& name) : Item(id, name, TweakableType::Button) {}
+            void Reset() override {}
+            void Render() override {
+                std::string label = m_name + "##" + std::to_string(m_id);
+                if (ImGui::Button(label.c_str()) && m_onClick) m_onClick();
+            }
+            std::function<void()> m_onClick;
+        };
+
+        class Folder : public Item {
+        public:
+            Folder(int id, const std::string& name, bool open) : Item(id, name, TweakableType::Folder), m_isOpen(open) {}
+            void Add(std::shared_ptr<Item> child) { m_children.push_back(child); }
+            void SetOpen(bool open) { m_isOpen = open; }
+            void Reset() override { for (auto& child : m_children) child->Reset(); }
+            void Render() override {
+                std::string label = m_name + "##" + std::to_string(m_id);
+                if (ImGui::TreeNodeEx(label.c_str(), m_isOpen ? ImGuiTreeNodeFlags_DefaultOpen : 0)) {
+                    m_isOpen = true;
+                    for (auto& child : m_children) child->Render();
+                    ImGui::TreePop();
+                } else {
+                    m_isOpen = false;
+                }
+            }
+        private:
+            std::vector<std::shared_ptr<Item>> m_children;
+            bool m_isOpen;
+        };
+
+        struct Menu {
+            std::vector<std::shared_ptr<Folder>> roots;
+            std::unordered_map<int, std::shared_ptr<Item>> map;
+
+            template <typename T>
+            std::shared_ptr<T> Get(int id) {
+                auto it = map.find(id);
+                return it != map.end() ? std::dynamic_pointer_cast<T>(it->second) : nullptr;
+            }
+        };
+
+    } // namespace Legacy
+
+    // ========================================================================
+    // Synthetic menu
+    // ========================================================================
+
+    // Stand-in for DevMenuSync's map of game addresses (type 1=Bool 2=Int 3=Float)
+    struct GameValue {
+        void* valuePtr;
+        int type;
+        bool isValid;
+    };
+
+    struct NoopListener : public TweakableListener {
+        void OnTweakableChanged(TweakableRegistry&, uint32_t) override {}
+    };
+
+    struct Fixture {
+        Legacy::Menu legacy;
+        TweakableRegistry registry;
+        NoopListener listener;
+        std::unordered_map<int, GameValue> gameMap;
+        std::vector<int32_t> gameMemory;        // Backing store for the "game" values
+        int items = 0;
+        int folders = 0;
+    };
+
+    void AddItem(Fixture& fx, const std::shared_ptr<Legacy::Folder>& legacyFolder, uint32_t folderSlot, int id, int kind) {
+        char name[48];
+        snprintf(name, sizeof(name), "Tweakable value %d", id);
+
+        std::shared_ptr<Legacy::Item> item;
+        TweakableType type;
+        switch (kind) {
+        case 0: case 1: case 2: {
+            auto f = std::make_shared<Legacy::Float>(id, name, 1.0f, 0.0f, 10.0f);
+            f->m_onChange = [](float) {};
+            item = f;
+            type = TweakableType::Float;
+            fx.registry.Add(id, type, name, folderSlot, TweakableValue::Float(1.0f), TweakableValue::Float(0.0f),
+                            TweakableValue::Float(10.0f), &fx.listener);
+            break;
+        }
+        case 3: {
+            auto i = std::make_shared<Legacy::Int>(id, name, 5, 0, 100);
+            i->m_onChange = [](int) {};
+            item = i;
+            type = TweakableType::Int;
+            fx.registry.Add(id, type, name, folderSlot, TweakableValue::Int(5), TweakableValue::Int(0),
+                            TweakableValue::Int(100), &fx.listener);
+            break;
+        }
+        case 4: {
+            auto b = std::make_shared<Legacy::Bool>(id, name, false);
+            b->m_onChange = [](bool) {};
+            item = b;
+            type = TweakableType::Bool;
+            fx.registry.Add(id, type, name, folderSlot, TweakableValue::Int(0), TweakableValue::Int(0),
+                            TweakableValue::Int(1), &fx.listener);
+            break;
+        }
+        default: {
+            auto b = std::make_shared<Legacy::Button>(id, name);
+            b->m_onClick = []() {};
+            item = b;
+            type = TweakableType::Button;
+            fx.registry.Add(id, type, name, folderSlot, TweakableValue::Int(0), TweakableValue::Int(0),
+                            TweakableValue::Int(0), &fx.listener);
+            break;
+        }
+        }
+
+        legacyFolder->Add(item);
+        fx.legacy.map[id] = item;
+        fx.items++;
+
+        if (type != TweakableType::Button) {
+            int memType = type == TweakableType::Bool ? 1 : type == TweakableType::Int ? 2 : 3;
+            GameValue value = { nullptr, memType, true };
+            fx.gameMap[id] = value;       // Address filled in once gameMemory stops growing
+        }
+    }
+
+    // roots x 3 subfolders x itemsPerFolder items; mix of 3 float : 1 int : 1 bool : 1 button
+    void BuildFixture(Fixture& fx, int roots, int itemsPerFolder) {
+        int nextId = 1;
+        for (int r = 0; r < roots; r++) {
+            char name[48];
+            snprintf(name, sizeof(name), "Category %d", r);
+            int rootId = nextId++;
+            auto root = std::make_shared<Legacy::Folder>(rootId, name, true);
+            fx.legacy.roots.push_back(root);
+            fx.legacy.map[rootId] = root;
+            uint32_t rootSlot = fx.registry.Add(rootId, TweakableType::Folder, name, TweakableRegistry::INVALID_SLOT,
+                                                TweakableValue::Int(0), TweakableValue::Int(0), TweakableValue::Int(0),
+                                                nullptr, TweakableRegistry::FLAG_OPEN);
+            fx.folders++;
+
+            for (int s = 0; s < 3; s++) {
+                snprintf(name, sizeof(name), "Subcategory %d.%d", r, s);
+                int subId = nextId++;
+                auto sub = std::make_shared<Legacy::Folder>(subId, name, true);
+                root->Add(sub);
+                fx.legacy.map[subId] = sub;
+                uint32_t subSlot = fx.registry.Add(subId, TweakableType::Folder, name, rootSlot,
+                                                   TweakableValue::Int(0), TweakableValue::Int(0), TweakableValue::Int(0),
+                                                   nullptr, TweakableRegistry::FLAG_OPEN);
+                fx.folders++;
+
+                for (int i = 0; i < itemsPerFolder; i++) {
+                    AddItem(fx, sub, subSlot, nextId++, i % 6);
+                }
+                fx.registry.EndFolder(subSlot);
+            }
+            fx.registry.EndFolder(rootSlot);
+        }
+        fx.registry.EndMenu();
+
+        // Give every value a slot in the fake game memory, then bind both sides to it
+        fx.gameMemory.assign((size_t)nextId, 0);
+        for (auto& pair : fx.gameMap) {
+            pair.second.valuePtr = &fx.gameMemory[pair.first];
+            if (pair.second.type == 3) {
+                float value = 2.0f;
+                memcpy(&fx.gameMemory[pair.first], &value, sizeof(value));
+            } else {
+                fx.gameMemory[pair.first] = 1;
+            }
+        }
+        for (uint32_t slot = 0; slot < fx.registry.GetCount(); slot++) {
+            auto it = fx.gameMap.find(fx.registry.GetId(slot));
+            if (it != fx.gameMap.end()) fx.registry.SetGameValue(slot, it->second.valuePtr);
+        }
+    }
+
+    // ========================================================================
+    // Passes
+    // ========================================================================
+
+    void LegacySync(Fixture& fx) {
+        for (auto& pair : fx.gameMap) {
+            auto& info = pair.second;
+            if (!info.isValid || !info.valuePtr) continue;
+            if (info.type == 1) {
+                auto t = fx.legacy.Get<Legacy::Bool>(pair.first);
+                if (t) t->SetValue(*(int*)info.valuePtr != 0);
+            } else if (info.type == 2) {
+                auto t = fx.legacy.Get<Legacy::Int>(pair.first);
+                if (t) t->SetValue(*(int*)info.valuePtr);
+            } else if (info.type == 3) {
+                auto t = fx.legacy.Get<Legacy::Float>(pair.first);
+                if (t) t->SetValue(*(float*)info.valuePtr);
+            }
+        }
+    }
+
+    void RegistrySync(Fixture& fx) {
+        TweakableRegistry& registry = fx.registry;
+        for (uint32_t slot = 0, count = registry.GetCount(); slot < count; slot++) {
+            void* address = registry.GetGameValue(slot);
+            if (!address) continue;
+            switch (registry.GetType(slot)) {
+            case TweakableType::Bool: registry.SetBool(slot, *(int*)address != 0); break;
+            case TweakableType::Int: registry.SetInt(slot, *(int*)address); break;
+            case TweakableType::Float: registry.SetFloat(slot, *(float*)address); break;
+            default: break;
+            }
+        }
+    }
+
+    void LegacySave(Fixture& fx, std::ostream& out) {
+        for (auto& pair : fx.legacy.map) {
+            auto& item = pair.second;
+            switch (item->GetType()) {
+            case TweakableType::Float: out << item->GetId() << " " << std::static_pointer_cast<Legacy::Float>(item)->GetValue() << "\n"; break;
+            case TweakableType::Int: out << item->GetId() << " " << std::static_pointer_cast<Legacy::Int>(item)->GetValue() << "\n"; break;
+            case TweakableType::Bool: out << item->GetId() << " " << (std::static_pointer_cast<Legacy::Bool>(item)->GetValue() ? 1 : 0) << "\n"; break;
+            default: break;
+            }
+        }
+    }
+
+    void LegacyReset(Fixture& fx) {
+        for (auto& root : fx.legacy.roots) root->Reset();
+    }
+
+    // One headless frame with the menu inside a DevMenu-sized window
+    template <typename Fn>
+    void RenderFrame(Fn body) {
+        ImGuiIO& io = ImGui::GetIO();
+        io.DeltaTime = 1.0f / 60.0f;
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0, 0));
+        ImGui::SetNextWindowSize(ImVec2(600, 800));
+        ImGui::Begin("Dev Menu");
+        ImGui::BeginChild("ScrollingRegion", ImVec2(0, 0), false, ImGuiWindowFlags_HorizontalScrollbar);
+        body();
+        ImGui::EndChild();
+        ImGui::End();
+        ImGui::Render();
+    }
+
+    void LegacyRender(Fixture& fx) {
+        RenderFrame([&]() {
+            for (auto& root : fx.legacy.roots) root->Render();
+        });
+    }
+
+    void RegistryRender(Fixture& fx) {
+        RenderFrame([&]() {
+            for (uint32_t slot = 0; slot < fx.registry.GetMenuEnd(); slot = fx.registry.GetEnd(slot)) {
+                fx.registry.Render(slot);
+            }
+        });
+    }
+
+    // Headless ImGui: build the font atlas ourselves and never hand draw data to a renderer
+    void CreateImGui() {
+        ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.IniFilename = nullptr;
+        unsigned char* pixels = nullptr;
+        int width = 0, height = 0;
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    }
+
+    // Open or close every folder on both sides. Tree state lives in ImGui, so start a fresh
+    // context and let DefaultOpen apply the flags on the first frame.
+    void SetAllOpen(Fixture& fx, bool open) {
+        for (auto& pair : fx.legacy.map) {
+            if (pair.second->GetType() == TweakableType::Folder) {
+                std::static_pointer_cast<Legacy::Folder>(pair.second)->SetOpen(open);
+            }
+        }
+        for (uint32_t slot = 0; slot < fx.registry.GetCount(); slot++) {
+            if (fx.registry.GetType(slot) == TweakableType::Folder) fx.registry.SetOpen(slot, open);
+        }
+        ImGui::DestroyContext();
+        CreateImGui();
+    }
+
+    double NowMs() {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Average milliseconds per call over iterations (after a short warm-up)
+    template <typename Fn>
+    double Time(int iterations, Fn fn) {
+        for (int i = 0; i < 3; i++) fn();
+        double start = NowMs();
+        for (int i = 0; i < iterations; i++) fn();
+        return (NowMs() - start) / iterations;
+    }
+
+    void Report(const char* pass, double legacyMs, double registryMs) {
+        printf("  %-26s %10.4f ms %10.4f ms %8.1fx\n", pass, legacyMs, registryMs,
+               registryMs > 0.0 ? legacyMs / registryMs : 0.0);
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int roots = 36;
+    int itemsPerFolder = 12;
+    int iterations = 200;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--roots") && i + 1 < argc) roots = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--items") && i + 1 < argc) itemsPerFolder = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--iterations") && i + 1 < argc) iterations = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "Usage: %s [--roots N] [--items N] [--iterations N]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (roots < 1 || itemsPerFolder < 1 || iterations < 1) {
+        fprintf(stderr, "Counts must be positive\n");
+        return 1;
+    }
+
+    CreateImGui();
+
+    Fixture fx;
+    BuildFixture(fx, roots, itemsPerFolder);
+
+    printf("Menu: %d root folders, %d folders, %d tweakables (%zu synced), %d iterations\n\n",
+           roots, fx.folders, fx.items, fx.gameMap.size(), iterations);
+    printf("  %-26s %13s %13s %9s\n", "Pass", "shared_ptr", "registry", "speedup");
+
+    Report("SyncFromGame",
+           Time(iterations, [&]() { LegacySync(fx); }),
+           Time(iterations, [&]() { RegistrySync(fx); }));
+
+    SetAllOpen(fx, true);
+    Report("Render (all folders open)",
+           Time(iterations, [&]() { LegacyRender(fx); }),
+           Time(iterations, [&]() { RegistryRender(fx); }));
+
+    SetAllOpen(fx, false);
+    Report("Render (all closed)",
+           Time(iterations, [&]() { LegacyRender(fx); }),
+           Time(iterations, [&]() { RegistryRender(fx); }));
+
+    size_t legacyBytes = 0, registryBytes = 0;
+    Report("SaveConfig",
+           Time(iterations, [&]() { std::ostringstream out; LegacySave(fx, out); legacyBytes = out.str().size(); }),
+           Time(iterations, [&]() { std::ostringstream out; fx.registry.WriteConfig(out); registryBytes = out.str().size(); }));
+
+    Report("ResetAll",
+           Time(iterations, [&]() { LegacyReset(fx); }),
+           Time(iterations, [&]() { fx.registry.ResetAll(); }));
+
+    ImGui::DestroyContext();
+
+    if (legacyBytes != registryBytes) {
+        printf("\nFAIL: config sizes differ (%zu vs %zu bytes)\n", legacyBytes, registryBytes);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,219 @@
+// tweakable_search_bench.cpp
+// Times DevMenu's search filter on the game's tweakables: the old per-frame PassesFilter
+// (copy and lowercase every root name and the filter, every frame), a straightforward deep
+// search (lowercase every path on each keystroke) and TweakableSearchIndex.
+//
+// A set of queries is typed one character at a time and then erased, as in the search bar.
+// The deep search and the index must report the same matches for every keystroke; heap
+// allocations are counted per keystroke (the index should make none).
+//
+// Build (Linux):
+//   g++ -std=c++14 -O2 -I../../TFPayload tweakable_search_bench.cpp -o tweakable_search_bench
+// Run:
+//   ./tweakable_search_bench [--iterations N]
+
+#include "tweakable_search.h"
+#include "tweakable_table.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+// Allocation counter for every new in the process (the benchmark is single-threaded)
+static size_t g_allocations = 0;
+
+void* operator new(size_t size) {
+    g_allocations++;
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+namespace {
+
+    const char* QUERIES[] = {
+        "maxrpm", "gravity", "camera", "gear1/", "suspension", "wheel", "torque", "bike/", "zz", "e",
+    };
+
+    // Every prefix typed, then erased back to empty
+    std::vector<std::string> Keystrokes() {
+        std::vector<std::string> strokes;
+        for (const char* query : QUERIES) {
+            std::string text = query;
+            for (size_t i = 1; i <= text.size(); i++) strokes.push_back(text.substr(0, i));
+            for (size_t i = text.size(); i-- > 1;) strokes.push_back(text.substr(0, i));
+            strokes.push_back("");
+        }
+        return strokes;
+    }
+
+    // ========================================================================
+    // Old filters
+    // ========================================================================
+
+    // DevMenu::PassesFilter as it was (root folders only, run every frame)
+    bool PassesFilter(const std::string& name, const std::string& filter) {
+        if (filter.empty()) return true;
+
+        std::string lowerName = name;
+        std::string lowerFilter = filter;
+
+        std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::tolower);
+        std::transform(lowerFilter.begin(), lowerFilter.end(), lowerFilter.begin(), ::tolower);
+
+        return lowerName.find(lowerFilter) != std::string::npos;
+    }
+
+    uint32_t FilterRoots(const TweakableRegistry& registry, const std::string& filter) {
+        uint32_t shown = 0;
+        for (uint32_t slot = 0; slot < registry.GetMenuEnd(); slot = registry.GetEnd(slot)) {
+            if (PassesFilter(registry.GetName(slot), filter)) shown++;
+        }
+        return shown;
+    }
+
+    // Deep search without an index: rebuild each lowercased path and search it
+    void FilterDeep(const TweakableRegistry& registry, const std::string& filter, std::vector<uint32_t>& matches) {
+        matches.clear();
+        if (filter.empty()) return;
+
+        std::string lowerFilter = filter;
+        std::transform(lowerFilter.begin(), lowerFilter.end(), lowerFilter.begin(), ::tolower);
+
+        std::vector<std::string> paths(registry.GetMenuEnd());
+        for (uint32_t slot = 0; slot < registry.GetMenuEnd(); slot++) {
+            uint32_t parent = registry.GetParent(slot);
+            std::string name = registry.GetName(slot);
+            std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+            paths[slot] = parent == TweakableRegistry::INVALID_SLOT ? name : paths[parent] + "/" + name;
+            if (paths[slot].find(lowerFilter) != std::string::npos) matches.push_back(slot);
+        }
+    }
+
+    // ========================================================================
+    // Timing
+    // ========================================================================
+
+    struct Result {
+        double micros = 0.0;            // Per keystroke (or frame)
+        double allocations = 0.0;       // Per keystroke (or frame)
+    };
+
+    double NowMicros() {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    template <typename KeystrokeFn>
+    Result Measure(int iterations, const std::vector<std::string>& strokes, KeystrokeFn keystroke) {
+        double total = 0.0;
+        size_t allocations = 0;
+        for (int i = 0; i < iterations + 3; i++) {
+            size_t allocationsBefore = g_allocations;
+            double start = NowMicros();
+            for (const std::string& text : strokes) keystroke(text);
+            double elapsed = NowMicros() - start;
+            if (i >= 3) {   // Warm-up
+                total += elapsed;
+                allocations += g_allocations - allocationsBefore;
+            }
+        }
+        Result result;
+        result.micros = total / ((double)iterations * strokes.size());
+        result.allocations = (double)allocations / ((double)iterations * strokes.size());
+        return result;
+    }
+
+    void Report(const char* path, const Result& result) {
+        printf("  %-40s %10.2f us %10.1f\n", path, result.micros, result.allocations);
+    }
+
+    struct NoopListener : public TweakableListener {
+        void OnTweakableChanged(TweakableRegistry&, uint32_t) override {}
+    };
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int iterations = 200;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--iterations") && i + 1 < argc) iterations = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "Usage: %s [--iterations N]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (iterations < 1) {
+        fprintf(stderr, "Iterations must be positive\n");
+        return 1;
+    }
+
+    NoopListener listener;
+    TweakableRegistry registry;
+    registry.Reserve((uint32_t)TweakableTable::COUNT, TweakableTable::NAME_BYTES, TweakableTable::MAX_ID);
+    TweakableTable::Materialize(registry, &listener);
+    registry.EndMenu();
+
+    TweakableSearchIndex index;
+    double buildStart = NowMicros();
+    index.Build(registry);
+    double buildMicros = NowMicros() - buildStart;
+
+    std::vector<std::string> strokes = Keystrokes();
+
+    // Same matches on every keystroke, typed in order so narrowing is exercised
+    std::vector<uint32_t> expected;
+    for (const std::string& text : strokes) {
+        FilterDeep(registry, text, expected);
+        index.Query(text.c_str());
+        const uint8_t* states = index.GetStates();
+        uint32_t count = index.GetMatchCount();
+        if (count != expected.size() || (text.empty() != (states == nullptr))) {
+            printf("FAIL: \"%s\" matched %u slots, expected %zu\n", text.c_str(), count, expected.size());
+            return 1;
+        }
+        for (uint32_t slot : expected) {
+            if (!states || states[slot] != TweakableRegistry::FILTER_SHOWN) {
+                printf("FAIL: \"%s\" does not show %s\n", text.c_str(), index.GetPath(slot));
+                return 1;
+            }
+        }
+    }
+
+    std::vector<uint32_t> deepMatches;
+    deepMatches.reserve(registry.GetMenuEnd());
+    volatile uint32_t sink = 0;
+
+    Result roots = Measure(iterations, strokes, [&](const std::string& text) { sink = FilterRoots(registry, text); });
+    Result deep = Measure(iterations, strokes, [&](const std::string& text) { FilterDeep(registry, text, deepMatches); });
+    Result indexed = Measure(iterations, strokes, [&](const std::string& text) {
+        index.Query(text.c_str());
+        sink = index.GetMatchCount();
+    });
+    (void)sink;
+
+    printf("Tweakable search: %u slots, %zu keystrokes, index built in %.1f us, %d iterations\n\n",
+           registry.GetMenuEnd(), strokes.size(), buildMicros, iterations);
+    printf("  %-40s %13s %10s\n", "Filter", "time", "allocs");
+    Report("PassesFilter, roots only (every frame)", roots);
+    Report("Deep search, no index (per keystroke)", deep);
+    Report("TweakableSearchIndex (per keystroke)", indexed);
+
+    if (indexed.allocations != 0.0) {
+        printf("\nFAIL: TweakableSearchIndex::Query allocated\n");
+        return 1;
+    }
+    return 0;
+}
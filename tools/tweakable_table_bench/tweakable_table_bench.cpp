@@ -0,0 +1,285 @@
+// tweakable_table_bench.cpp
+// Times DevMenu's startup work for the game's tweakables: the old hand-written Initialize*
+// functions against materializing TweakableRegistry from the constexpr TweakableTable.
+//
+// The old path is replayed from the same table rows, doing what each Initialize* line did:
+// make_shared per item, a std::function change callback capturing the id and a std::string
+// name, a map insert, and AddChild into the parent folder. It is timed on its own (before
+// the registry existed) and followed by the depth-first flatten into the registry that
+// DevMenu did until the table replaced it. Heap allocations are counted per startup.
+//
+// Build (Linux):
+//   g++ -std=c++14 -O2 -I../../TFPayload tweakable_table_bench.cpp -o tweakable_table_bench
+// Run:
+//   ./tweakable_table_bench [--iterations N]
+
+#include "tweakable_table.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Allocation counter for every new in the process (the benchmark is single-threaded)
+static size_t g_allocations = 0;
+
+void* operator new(size_t size) {
+    g_allocations++;
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+namespace {
+
+    // ========================================================================
+    // Old Initialize* model
+    // ========================================================================
+
+    namespace Legacy {
+
+        struct Item {
+            Item(int id, const std::string& name, TweakableType type) : id(id), name(name), type(type) {}
+            virtual ~Item() = default;
+            int id;
+            std::string name;
+            TweakableType type;
+        };
+
+        struct Float : Item {
+            Float(int id, const std::string& name, float value, float minValue, float maxValue)
+                : Item(id, name, TweakableType::Float), value(value), defaultValue(value), minValue(minValue), maxValue(maxValue) {}
+            float value, defaultValue, minValue, maxValue;
+            std::function<void(float)> onChange;
+        };
+
+        struct Int : Item {
+            Int(int id, const std::string& name, int value, int minValue, int maxValue)
+                : Item(id, name, TweakableType::Int), value(value), defaultValue(value), minValue(minValue), maxValue(maxValue) {}
+            int value, defaultValue, minValue, maxValue;
+            std::function<void(int)> onChange;
+        };
+
+        struct Bool : Item {
+            Bool(int id, const std::string& name, bool value) : Item(id, name, TweakableType::Bool), value(value), defaultValue(value) {}
+            bool value, defaultValue;
+            std::function<void(bool)> onChange;
+        };
+
+        struct Folder : Item {
+            Folder(int id, const std::string& name) : Item(id, name, TweakableType::Folder) {}
+            std::vector<std::shared_ptr<Item>> children;
+        };
+
+        struct Menu {
+            std::vector<std::shared_ptr<Folder>> roots;
+            std::unordered_map<int, std::shared_ptr<Item>> map;
+        };
+
+        // Stand-in for DevMenuSync::WriteValue so the callbacks have a body to capture into
+        volatile int g_sink = 0;
+
+        // One CreateSynced* / make_shared<TweakableFolder> + RegisterTweakable + AddChild per row
+        void Build(Menu& menu) {
+            std::shared_ptr<Folder> open[TweakableTable::MAX_DEPTH];
+            int depth = 0;
+
+            for (size_t i = 0; i < TweakableTable::COUNT; i++) {
+                const TweakableTable::Definition& def = TweakableTable::DEFINITIONS[i];
+                while (depth > 0 && open[depth - 1]->id != def.parent) depth--;
+
+                int id = def.id;
+                std::string name = def.name;
+                std::shared_ptr<Item> item;
+                switch (def.type) {
+                case TweakableType::Folder:
+                    item = std::make_shared<Folder>(id, name);
+                    break;
+                case TweakableType::Float: {
+                    auto f = std::make_shared<Float>(id, name, def.defaultValue.f, def.minValue.f, def.maxValue.f);
+                    f->onChange = [id, name](float value) { g_sink = id + (int)value + (int)name.size(); };
+                    item = f;
+                    break;
+                }
+                case TweakableType::Int: {
+                    auto n = std::make_shared<Int>(id, name, def.defaultValue.i, def.minValue.i, def.maxValue.i);
+                    n->onChange = [id, name](int value) { g_sink = id + value + (int)name.size(); };
+                    item = n;
+                    break;
+                }
+                default: {
+                    auto b = std::make_shared<Bool>(id, name, def.defaultValue.i != 0);
+                    b->onChange = [id, name](bool value) { g_sink = id + (value ? 1 : 0) + (int)name.size(); };
+                    item = b;
+                    break;
+                }
+                }
+
+                menu.map[id] = item;
+                if (depth > 0) {
+                    open[depth - 1]->children.push_back(item);
+                } else {
+                    menu.roots.push_back(std::static_pointer_cast<Folder>(item));
+                }
+                if (def.type == TweakableType::Folder) {
+                    open[depth++] = std::static_pointer_cast<Folder>(item);
+                }
+            }
+        }
+
+        // DevMenu::AddToRegistry as it flattened the object tree
+        void Flatten(TweakableRegistry& registry, const std::shared_ptr<Item>& item, uint32_t parent) {
+            TweakableValue value(0), minValue(0), maxValue(0);
+            switch (item->type) {
+            case TweakableType::Float: {
+                auto f = std::static_pointer_cast<Float>(item);
+                value = TweakableValue(f->defaultValue); minValue = TweakableValue(f->minValue); maxValue = TweakableValue(f->maxValue);
+                break;
+            }
+            case TweakableType::Int: {
+                auto n = std::static_pointer_cast<Int>(item);
+                value = TweakableValue(n->defaultValue); minValue = TweakableValue(n->minValue); maxValue = TweakableValue(n->maxValue);
+                break;
+            }
+            case TweakableType::Bool:
+                value = TweakableValue(std::static_pointer_cast<Bool>(item)->defaultValue ? 1 : 0);
+                break;
+            default:
+                break;
+            }
+
+            uint32_t slot = registry.Add(item->id, item->type, item->name.c_str(), parent, value, minValue, maxValue, nullptr);
+            if (item->type == TweakableType::Folder) {
+                for (auto& child : std::static_pointer_cast<Folder>(item)->children) {
+                    Flatten(registry, child, slot);
+                }
+                registry.EndFolder(slot);
+            }
+        }
+
+    } // namespace Legacy
+
+    struct NoopListener : public TweakableListener {
+        void OnTweakableChanged(TweakableRegistry&, uint32_t) override {}
+    };
+
+    // ========================================================================
+    // Timing
+    // ========================================================================
+
+    struct Result {
+        double micros = 0.0;            // Per startup
+        size_t allocations = 0;         // Per startup
+        uint32_t slots = 0;
+    };
+
+    double NowMicros() {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Each run builds a menu and then tears it down; only the build is timed
+    template <typename StartupFn, typename TeardownFn>
+    Result Measure(int iterations, StartupFn startup, TeardownFn teardown) {
+        Result result;
+        double total = 0.0;
+        size_t allocations = 0;
+        for (int i = 0; i < iterations + 3; i++) {
+            size_t allocationsBefore = g_allocations;
+            double start = NowMicros();
+            uint32_t slots = startup();
+            double elapsed = NowMicros() - start;
+            teardown();
+            if (i >= 3) {   // Warm-up
+                total += elapsed;
+                allocations += g_allocations - allocationsBefore;
+            }
+            result.slots = slots;
+        }
+        result.micros = total / iterations;
+        result.allocations = allocations / iterations;
+        return result;
+    }
+
+    void Report(const char* path, const Result& result, const Result& baseline) {
+        printf("  %-34s %10.1f us %10zu %8.1fx\n", path, result.micros, result.allocations,
+               result.micros > 0.0 ? baseline.micros / result.micros : 0.0);
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int iterations = 200;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--iterations") && i + 1 < argc) iterations = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "Usage: %s [--iterations N]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (iterations < 1) {
+        fprintf(stderr, "Iterations must be positive\n");
+        return 1;
+    }
+
+    NoopListener listener;
+
+    std::unique_ptr<Legacy::Menu> legacyMenu;
+    std::unique_ptr<TweakableRegistry> registry;
+    auto teardown = [&]() {
+        legacyMenu.reset();
+        registry.reset();
+    };
+
+    Result objects = Measure(iterations, [&]() {
+        legacyMenu.reset(new Legacy::Menu());
+        Legacy::Build(*legacyMenu);
+        return (uint32_t)legacyMenu->map.size();
+    }, teardown);
+
+    Result flattened = Measure(iterations, [&]() {
+        legacyMenu.reset(new Legacy::Menu());
+        Legacy::Build(*legacyMenu);
+        registry.reset(new TweakableRegistry());
+        for (auto& root : legacyMenu->roots) {
+            Legacy::Flatten(*registry, root, TweakableRegistry::INVALID_SLOT);
+        }
+        registry->EndMenu();
+        return registry->GetCount();
+    }, teardown);
+
+    Result table = Measure(iterations, [&]() {
+        registry.reset(new TweakableRegistry());
+        registry->Reserve((uint32_t)TweakableTable::COUNT, TweakableTable::NAME_BYTES, TweakableTable::MAX_ID);
+        TweakableTable::Materialize(*registry, &listener);
+        registry->EndMenu();
+        return registry->GetCount();
+    }, teardown);
+
+    printf("Tweakable table: %zu rows, %zu bytes of definitions, %zu bytes of names, %d iterations\n\n",
+           TweakableTable::COUNT, sizeof(TweakableTable::DEFINITIONS), TweakableTable::NAME_BYTES, iterations);
+    printf("  %-34s %13s %10s %9s\n", "Startup path", "time", "allocs", "speedup");
+    Report("Initialize* objects", objects, objects);
+    Report("Initialize* objects + flatten", flattened, objects);
+    Report("TweakableTable::Materialize", table, objects);
+
+    if (objects.slots != TweakableTable::COUNT || flattened.slots != TweakableTable::COUNT || table.slots != TweakableTable::COUNT) {
+        printf("\nFAIL: expected %zu tweakables (objects %u, flattened %u, table %u)\n",
+               TweakableTable::COUNT, objects.slots, flattened.slots, table.slots);
+        return 1;
+    }
+    return 0;
+}